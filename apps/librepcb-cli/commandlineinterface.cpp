@@ -0,0 +1,238 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include "commandlineinterface.h"
+#include <librepcb/common/application.h>
+#include <librepcb/common/debug.h>
+#include <librepcb/project/project.h>
+#include <librepcb/project/boards/board.h>
+#include <librepcb/project/boards/boardgerberexport.h>
+#include <librepcb/project/erc/ercmsg.h>
+#include <librepcb/project/erc/ercmsglist.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace cli {
+
+using namespace project;
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+CommandLineInterface::CommandLineInterface(const Application& app) noexcept :
+    mApp(app)
+{
+}
+
+CommandLineInterface::~CommandLineInterface() noexcept
+{
+}
+
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+int CommandLineInterface::execute() noexcept
+{
+    QCommandLineParser parser;
+    parser.setApplicationDescription(tr("LibrePCB Command Line Interface"));
+    parser.addHelpOption();
+    QCommandLineOption versionOption(QStringList() << "V" << "version",
+                                     tr("Displays version information."));
+    QCommandLineOption verboseOption(QStringList() << "v" << "verbose",
+                                     tr("Print all debug messages."));
+    QCommandLineOption ercOption("erc", tr("Run the electrical rule check and print all "
+        "non-ignored messages. Fails if there are errors."));
+    QCommandLineOption exportGerberOption("export-gerber", tr("Export Gerber and Excellon "
+        "files of all boards."));
+    QCommandLineOption outputDirOption("output-dir", tr("Output directory of exported "
+        "files, relative to the project directory (default: \"output/<version>/gerber\"). "
+        "If a project contains several boards, a subdirectory is created for each board."),
+        tr("directory"));
+    QCommandLineOption optimizeDrillsOption("optimize-drills", tr("Optimize the drill order "
+        "in Excellon files to reduce the travel distance of the drill machine."));
+    QCommandLineOption jobsOption(QStringList() << "j" << "jobs", tr("Maximum count of threads used for "
+        "exporting (default: one per CPU core)."), tr("count"));
+    parser.addOption(versionOption);
+    parser.addOption(verboseOption);
+    parser.addOption(ercOption);
+    parser.addOption(exportGerberOption);
+    parser.addOption(outputDirOption);
+    parser.addOption(optimizeDrillsOption);
+    parser.addOption(jobsOption);
+    parser.addPositionalArgument("projects", tr("Project files (*.lpp) to process."),
+                                 tr("project [project...]"));
+
+    // note: parser.process() would call exit(), so handle the errors ourselves
+    if (!parser.parse(mApp.arguments())) {
+        printErr(parser.errorText());
+        return 2;
+    }
+    if (parser.isSet("help")) {
+        print(parser.helpText());
+        return 0;
+    }
+    if (parser.isSet(versionOption)) {
+        print(QString("LibrePCB CLI %1 (%2)").arg(mApp.getAppVersion().toPrettyStr(3),
+                                                  mApp.getGitVersion()));
+        return 0;
+    }
+    if (parser.isSet(verboseOption)) {
+        Debug::instance()->setDebugLevelStderr(Debug::DebugLevel_t::All);
+    }
+    int jobs = -1;
+    if (parser.isSet(jobsOption)) {
+        bool ok = false;
+        jobs = parser.value(jobsOption).toInt(&ok);
+        if ((!ok) || (jobs < 1)) {
+            printErr(QString(tr("Invalid count of jobs: %1")).arg(parser.value(jobsOption)));
+            return 2;
+        }
+    }
+    if (parser.positionalArguments().isEmpty()) {
+        printErr(tr("No project file specified."));
+        printErr(parser.helpText());
+        return 2;
+    }
+
+    // process all projects, even if some of them fail
+    bool success = true;
+    foreach (const QString& arg, parser.positionalArguments()) {
+        FilePath projectFile(QFileInfo(arg).absoluteFilePath());
+        if (!processProject(projectFile, parser.isSet(ercOption),
+                            parser.isSet(exportGerberOption),
+                            parser.value(outputDirOption),
+                            parser.isSet(optimizeDrillsOption), jobs)) {
+            success = false;
+        }
+    }
+    return success ? 0 : 1;
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+bool CommandLineInterface::processProject(const FilePath& projectFile, bool runErc,
+                                          bool exportGerber, const QString& outputDir,
+                                          bool optimizeDrills, int jobs) const noexcept
+{
+    QElapsedTimer timer;
+    timer.start();
+    print(QString(tr("Open project \"%1\"...")).arg(projectFile.toNative()));
+
+    try {
+        Project project(projectFile, true, true); // can throw
+        print(QString(tr("  Opened in %1 ms.")).arg(timer.elapsed()));
+
+        bool success = true;
+        if (runErc) {
+            success = this->runErc(project) && success;
+        }
+
+        if (exportGerber) {
+            QString version = FilePath::cleanFileName(project.getVersion(),
+                              FilePath::ReplaceSpaces | FilePath::KeepCase);
+            QString dir = outputDir.isEmpty() ? QString("output/%1/gerber").arg(version)
+                                              : outputDir;
+            FilePath baseDir = QDir::isAbsolutePath(dir) ? FilePath(dir)
+                                                         : project.getPath().getPathTo(dir);
+            foreach (const Board* board, project.getBoards()) {
+                FilePath boardDir = baseDir;
+                if (project.getBoards().count() > 1) {
+                    boardDir = baseDir.getPathTo(FilePath::cleanFileName(board->getName(),
+                               FilePath::ReplaceSpaces | FilePath::KeepCase));
+                }
+                try {
+                    this->exportGerber(*board, boardDir, optimizeDrills, jobs); // can throw
+                } catch (const Exception& e) {
+                    printErr(QString(tr("  ERROR: Failed to export board \"%1\": %2"))
+                             .arg(board->getName(), e.getUserMsg()));
+                    success = false;
+                }
+            }
+        }
+
+        print(QString(tr("  Finished in %1 ms.")).arg(timer.elapsed()));
+        return success;
+    } catch (const Exception& e) {
+        printErr(QString(tr("  ERROR: Failed to open project: %1")).arg(e.getUserMsg()));
+        return false;
+    }
+}
+
+bool CommandLineInterface::runErc(const Project& project) const noexcept
+{
+    int errors = 0;
+    int warnings = 0;
+    foreach (const ErcMsg* msg, project.getErcMsgList().getItems()) {
+        if ((!msg->isVisible()) || (msg->isIgnored())) continue;
+        switch (msg->getMsgType()) {
+            case ErcMsg::ErcMsgType_t::CircuitError:
+            case ErcMsg::ErcMsgType_t::SchematicError:
+            case ErcMsg::ErcMsgType_t::BoardError:
+                print(QString("    [ERROR] %1").arg(msg->getMsg()));
+                ++errors;
+                break;
+            default:
+                print(QString("    [WARNING] %1").arg(msg->getMsg()));
+                ++warnings;
+                break;
+        }
+    }
+    print(QString(tr("  ERC finished with %1 error(s) and %2 warning(s).")).arg(errors)
+          .arg(warnings));
+    return (errors == 0);
+}
+
+void CommandLineInterface::exportGerber(const Board& board, const FilePath& outputDir,
+                                        bool optimizeDrills, int jobs) const throw (Exception)
+{
+    print(QString(tr("  Export fabrication data of board \"%1\" to \"%2\"..."))
+          .arg(board.getName(), outputDir.toNative()));
+    BoardGerberExport grbExport(board, outputDir);
+    grbExport.setDrillPathOptimizationEnabled(optimizeDrills);
+    grbExport.exportAllLayers(jobs); // can throw
+}
+
+void CommandLineInterface::print(const QString& str) const noexcept
+{
+    QTextStream s(stdout);
+    s << str << endl;
+}
+
+void CommandLineInterface::printErr(const QString& str) const noexcept
+{
+    QTextStream s(stderr);
+    s << str << endl;
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace cli
+} // namespace librepcb
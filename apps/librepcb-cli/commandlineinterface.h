@@ -0,0 +1,104 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_CLI_COMMANDLINEINTERFACE_H
+#define LIBREPCB_CLI_COMMANDLINEINTERFACE_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <librepcb/common/exceptions.h>
+#include <librepcb/common/fileio/filepath.h>
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+
+class Application;
+
+namespace project {
+class Project;
+class Board;
+}
+
+namespace cli {
+
+/*****************************************************************************************
+ *  Class CommandLineInterface
+ ****************************************************************************************/
+
+/**
+ * @brief The CommandLineInterface class processes projects without any user interaction
+ *
+ * It opens each given project read-only, optionally prints the ERC messages and exports
+ * the fabrication data (Gerber and Excellon files) of all boards. This allows to
+ * generate the production data in scripts and continuous integration pipelines.
+ *
+ * Exit codes of #execute():
+ *  - 0: all projects processed successfully
+ *  - 1: at least one project failed (could not be opened, has ERC errors or the export
+ *       failed)
+ *  - 2: invalid command line arguments
+ */
+class CommandLineInterface final
+{
+        Q_DECLARE_TR_FUNCTIONS(CommandLineInterface)
+
+    public:
+
+        // Constructors / Destructor
+        CommandLineInterface() = delete;
+        CommandLineInterface(const CommandLineInterface& other) = delete;
+        explicit CommandLineInterface(const Application& app) noexcept;
+        ~CommandLineInterface() noexcept;
+
+        // General Methods
+        int execute() noexcept;
+
+        // Operator Overloadings
+        CommandLineInterface& operator=(const CommandLineInterface& rhs) = delete;
+
+
+    private:
+
+        // Private Methods
+        bool processProject(const FilePath& projectFile, bool runErc, bool exportGerber,
+                            const QString& outputDir, bool optimizeDrills,
+                            int jobs) const noexcept;
+        bool runErc(const project::Project& project) const noexcept;
+        void exportGerber(const project::Board& board, const FilePath& outputDir,
+                          bool optimizeDrills, int jobs) const throw (Exception);
+        void print(const QString& str) const noexcept;
+        void printErr(const QString& str) const noexcept;
+
+
+        // Private Member Variables
+        const Application& mApp;
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace cli
+} // namespace librepcb
+
+#endif // LIBREPCB_CLI_COMMANDLINEINTERFACE_H
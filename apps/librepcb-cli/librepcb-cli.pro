@@ -0,0 +1,57 @@
+#-------------------------------------------------
+#
+# Project created 2026-10-18
+#
+#-------------------------------------------------
+
+TEMPLATE = app
+TARGET = librepcb-cli
+
+# Set the path for the generated binary
+GENERATED_DIR = ../../generated
+
+# Use common project definitions
+include(../../common.pri)
+
+QT += core widgets opengl network xml printsupport sql
+
+CONFIG += console
+CONFIG -= app_bundle
+
+unix:!macx {
+    target.path = $${PREFIX}/bin
+    INSTALLS += target
+}
+
+# Note: The order of the libraries is very important for the linker!
+# Another order could end up in "undefined reference" errors!
+LIBS += \
+    -L$${DESTDIR} \
+    -llibrepcbproject \
+    -llibrepcblibrary \
+    -llibrepcbcommon \
+    -lquazip -lz
+
+INCLUDEPATH += \
+    ../../libs/quazip \
+    ../../libs
+
+DEPENDPATH += \
+    ../../libs/librepcb/project \
+    ../../libs/librepcb/library \
+    ../../libs/librepcb/common \
+    ../../libs/quazip
+
+PRE_TARGETDEPS += \
+    $${DESTDIR}/liblibrepcbproject.a \
+    $${DESTDIR}/liblibrepcblibrary.a \
+    $${DESTDIR}/liblibrepcbcommon.a \
+    $${DESTDIR}/libquazip.a
+
+SOURCES += \
+    commandlineinterface.cpp \
+    main.cpp \
+
+HEADERS += \
+    commandlineinterface.h \
+
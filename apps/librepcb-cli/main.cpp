@@ -0,0 +1,60 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <librepcb/common/application.h>
+#include <librepcb/common/debug.h>
+#include "commandlineinterface.h"
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+using namespace librepcb;
+using namespace librepcb::cli;
+
+/*****************************************************************************************
+ *  main()
+ ****************************************************************************************/
+
+int main(int argc, char* argv[])
+{
+    // Some classes (e.g. the graphics items of boards) need a QApplication, but we never
+    // show any window. So don't require a display, unless the platform is set explicitly.
+    if (!qEnvironmentVariableIsSet("QT_QPA_PLATFORM")) {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+
+    Application app(argc, argv);
+
+    // Set the organization / application names must be done very early because some other
+    // classes will use these values (for example QSettings, Debug)!
+    Application::setOrganizationName("LibrePCB");
+    Application::setOrganizationDomain("librepcb.org");
+    Application::setApplicationName("LibrePCB-CLI");
+
+    // Creates the Debug object which installs the message handler. Only print warnings
+    // and errors by default to keep the output readable (see "--verbose").
+    Debug::instance()->setDebugLevelStderr(Debug::DebugLevel_t::Warning);
+
+    CommandLineInterface cli(app);
+    return cli.execute();
+}
@@ -0,0 +1,159 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <algorithm>
+#include "airwiresbuilder.h"
+#include "delaunaytriangulation.h"
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+AirWiresBuilder::AirWiresBuilder() noexcept :
+    mIslandCount(0)
+{
+}
+
+AirWiresBuilder::~AirWiresBuilder() noexcept
+{
+}
+
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+int AirWiresBuilder::addPoint(const Point& pos) noexcept
+{
+    mPoints.append(pos);
+    mIslands.append(mIslands.count());
+    ++mIslandCount;
+    return mPoints.count() - 1;
+}
+
+void AirWiresBuilder::addEdge(int p1, int p2) noexcept
+{
+    Q_ASSERT((p1 >= 0) && (p1 < mPoints.count()));
+    Q_ASSERT((p2 >= 0) && (p2 < mPoints.count()));
+    if (mergeIslands(mIslands, p1, p2)) {
+        --mIslandCount;
+    }
+}
+
+QVector<AirWiresBuilder::AirWire> AirWiresBuilder::buildAirWires() const noexcept
+{
+    QVector<AirWire> airWires;
+    if (mIslandCount <= 1) {
+        return airWires; // everything is connected already
+    }
+
+    // points at the same position are not part of the triangulation, so they get
+    // connected directly
+    QVector<AirWire> candidates;
+    QVector<Point> uniquePoints;
+    QVector<int> uniquePointIds;
+    QHash<QPair<LengthBase_t, LengthBase_t>, int> pointIdsByPosition;
+    for (int i = 0; i < mPoints.count(); ++i) {
+        const Point& pos = mPoints.at(i);
+        QPair<LengthBase_t, LengthBase_t> key(pos.getX().toNm(), pos.getY().toNm());
+        int other = pointIdsByPosition.value(key, -1);
+        if (other >= 0) {
+            candidates.append(AirWire(other, i));
+        } else {
+            pointIdsByPosition.insert(key, i);
+            uniquePoints.append(pos);
+            uniquePointIds.append(i);
+        }
+    }
+    DelaunayTriangulation triangulation(uniquePoints);
+    foreach (const DelaunayTriangulation::Edge& edge, triangulation.getEdges()) {
+        candidates.append(AirWire(uniquePointIds.at(edge.first),
+                                  uniquePointIds.at(edge.second)));
+    }
+
+    // sort the candidates by length (and by IDs to get a deterministic result)
+    QVector<QPair<qreal, AirWire>> sortedCandidates;
+    sortedCandidates.reserve(candidates.count());
+    foreach (const AirWire& candidate, candidates) {
+        Point diff = mPoints.at(candidate.second) - mPoints.at(candidate.first);
+        qreal length = diff.getX().toMm() * diff.getX().toMm() +
+                       diff.getY().toMm() * diff.getY().toMm();
+        sortedCandidates.append(qMakePair(length, candidate));
+    }
+    std::sort(sortedCandidates.begin(), sortedCandidates.end());
+
+    // Kruskal's algorithm: add the shortest candidates which connect two islands
+    QVector<int> islands = mIslands;
+    int islandCount = mIslandCount;
+    for (int i = 0; (i < sortedCandidates.count()) && (islandCount > 1); ++i) {
+        const AirWire& candidate = sortedCandidates.at(i).second;
+        if (mergeIslands(islands, candidate.first, candidate.second)) {
+            airWires.append(candidate);
+            --islandCount;
+        }
+    }
+
+    // fallback for points which could not be triangulated (should never happen)
+    for (int i = 1; (i < mPoints.count()) && (islandCount > 1); ++i) {
+        if (mergeIslands(islands, 0, i)) {
+            qWarning() << "Air wire not found by the triangulation:" << i;
+            airWires.append(AirWire(0, i));
+            --islandCount;
+        }
+    }
+    return airWires;
+}
+
+/*****************************************************************************************
+ *  Static Methods
+ ****************************************************************************************/
+
+int AirWiresBuilder::findIsland(QVector<int>& islands, int point) noexcept
+{
+    while (islands.at(point) != point) {
+        islands[point] = islands.at(islands.at(point)); // path halving
+        point = islands.at(point);
+    }
+    return point;
+}
+
+bool AirWiresBuilder::mergeIslands(QVector<int>& islands, int p1, int p2) noexcept
+{
+    int island1 = findIsland(islands, p1);
+    int island2 = findIsland(islands, p2);
+    if (island1 == island2) {
+        return false;
+    }
+    islands[qMax(island1, island2)] = qMin(island1, island2);
+    return true;
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace librepcb
@@ -0,0 +1,115 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_AIRWIRESBUILDER_H
+#define LIBREPCB_AIRWIRESBUILDER_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include "../units/point.h"
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+
+/*****************************************************************************************
+ *  Class AirWiresBuilder
+ ****************************************************************************************/
+
+/**
+ * @brief The AirWiresBuilder class calculates the shortest air wires (ratsnest) needed
+ *        to connect all points of a net
+ *
+ * All points of the net are added with #addPoint(), existing connections between them
+ * (e.g. traces) with #addEdge(). Points which are connected directly or indirectly form
+ * an island. #buildAirWires() then returns the minimum spanning tree over all islands,
+ * i.e. the air wires with the smallest total length which connect all islands.
+ *
+ * Only the edges of the Delaunay triangulation of the points are considered, because
+ * they contain the shortest connection between any two islands. So the whole
+ * calculation needs O(n log n) instead of O(n^2) for n points.
+ */
+class AirWiresBuilder final
+{
+    public:
+
+        // Types
+        typedef QPair<int, int> AirWire; ///< the IDs of the two connected points
+
+        // Constructors / Destructor
+        AirWiresBuilder(const AirWiresBuilder& other) = delete;
+        AirWiresBuilder() noexcept;
+        ~AirWiresBuilder() noexcept;
+
+        // Getters
+        int getPointCount() const noexcept {return mPoints.count();}
+        const Point& getPoint(int id) const noexcept {return mPoints.at(id);}
+
+        // General Methods
+
+        /**
+         * @brief Add a point of the net
+         *
+         * @param pos   The position of the point
+         *
+         * @return The ID of the added point (consecutive numbers, starting at zero)
+         */
+        int addPoint(const Point& pos) noexcept;
+
+        /**
+         * @brief Add an existing connection between two points (no air wire needed)
+         *
+         * @param p1    The ID of the first point (returned by #addPoint())
+         * @param p2    The ID of the second point (returned by #addPoint())
+         */
+        void addEdge(int p1, int p2) noexcept;
+
+        /**
+         * @brief Calculate the air wires needed to connect all islands
+         *
+         * @return The air wires sorted by length (shortest first)
+         */
+        QVector<AirWire> buildAirWires() const noexcept;
+
+        // Operator Overloadings
+        AirWiresBuilder& operator=(const AirWiresBuilder& rhs) = delete;
+
+
+    private:
+
+        // Static Methods
+        static int findIsland(QVector<int>& islands, int point) noexcept;
+        static bool mergeIslands(QVector<int>& islands, int p1, int p2) noexcept;
+
+
+        QVector<Point> mPoints;
+        QVector<int> mIslands;  ///< union-find forest, parent point ID of each point
+        int mIslandCount;
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace librepcb
+
+#endif // LIBREPCB_AIRWIRESBUILDER_H
@@ -0,0 +1,433 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <cmath>
+#include "delaunaytriangulation.h"
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+DelaunayTriangulation::DelaunayTriangulation(const QVector<Point>& points) noexcept :
+    mHullStart(-1)
+{
+    mCoords.reserve(2 * points.count());
+    foreach (const Point& point, points) {
+        mCoords.append(point.getX().toMm());
+        mCoords.append(point.getY().toMm());
+    }
+    if (points.count() >= 3) {
+        triangulate();
+    }
+
+    // release the temporary data
+    mHullPrev.clear();
+    mHullNext.clear();
+    mHullTri.clear();
+    mHash.clear();
+    mEdgeStack.clear();
+}
+
+DelaunayTriangulation::~DelaunayTriangulation() noexcept
+{
+}
+
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+QVector<DelaunayTriangulation::Edge> DelaunayTriangulation::getEdges() const noexcept
+{
+    QVector<Edge> edges;
+    if (!mTriangles.isEmpty()) {
+        edges.reserve(mTriangles.count() / 2 + 1);
+        for (int e = 0; e < mTriangles.count(); ++e) {
+            // inner edges consist of two half-edges, but we need only one of them
+            if (e > mHalfEdges.at(e)) {
+                int next = (e % 3 == 2) ? (e - 2) : (e + 1);
+                edges.append(Edge(mTriangles.at(e), mTriangles.at(next)));
+            }
+        }
+    } else if (mCoords.count() >= 4) {
+        // collinear points can't be triangulated, so connect them along the line
+        QVector<int> ids(mCoords.count() / 2);
+        std::iota(ids.begin(), ids.end(), 0);
+        std::sort(ids.begin(), ids.end(), [this](int a, int b) {
+            return (x(a) < x(b)) || ((x(a) == x(b)) && (y(a) < y(b)));
+        });
+        edges.reserve(ids.count() - 1);
+        for (int i = 1; i < ids.count(); ++i) {
+            edges.append(Edge(ids.at(i - 1), ids.at(i)));
+        }
+    }
+    return edges;
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+void DelaunayTriangulation::triangulate() noexcept
+{
+    const int n = mCoords.count() / 2;
+    const qreal inf = std::numeric_limits<qreal>::infinity();
+
+    // the seed point is the point closest to the center of the bounding box
+    qreal minX = inf, minY = inf, maxX = -inf, maxY = -inf;
+    for (int i = 0; i < n; ++i) {
+        minX = qMin(minX, x(i));
+        minY = qMin(minY, y(i));
+        maxX = qMax(maxX, x(i));
+        maxY = qMax(maxY, y(i));
+    }
+    const qreal cx = (minX + maxX) / 2;
+    const qreal cy = (minY + maxY) / 2;
+    int i0 = -1;
+    qreal minDistance = inf;
+    for (int i = 0; i < n; ++i) {
+        qreal d = squaredDistance(cx, cy, x(i), y(i));
+        if (d < minDistance) {
+            i0 = i;
+            minDistance = d;
+        }
+    }
+
+    // the second seed point is the point closest to the first one
+    int i1 = -1;
+    minDistance = inf;
+    for (int i = 0; i < n; ++i) {
+        if (i == i0) continue;
+        qreal d = squaredDistance(x(i0), y(i0), x(i), y(i));
+        if ((d < minDistance) && (d > 0)) {
+            i1 = i;
+            minDistance = d;
+        }
+    }
+    if (i1 < 0) return; // all points are at the same position
+
+    // the third seed point forms the smallest circumcircle with the other two points
+    int i2 = -1;
+    qreal minRadius = inf;
+    for (int i = 0; i < n; ++i) {
+        if ((i == i0) || (i == i1)) continue;
+        qreal r = circumradius(x(i0), y(i0), x(i1), y(i1), x(i), y(i));
+        if (r < minRadius) {
+            i2 = i;
+            minRadius = r;
+        }
+    }
+    if (i2 < 0) return; // all points are collinear
+
+    if (orient(x(i0), y(i0), x(i1), y(i1), x(i2), y(i2))) {
+        std::swap(i1, i2);
+    }
+    mCenter = circumcenter(x(i0), y(i0), x(i1), y(i1), x(i2), y(i2));
+
+    // sort the points by their distance to the circumcenter of the seed triangle
+    QVector<qreal> distances(n);
+    QVector<int> ids(n);
+    for (int i = 0; i < n; ++i) {
+        distances[i] = squaredDistance(mCenter.x(), mCenter.y(), x(i), y(i));
+        ids[i] = i;
+    }
+    std::sort(ids.begin(), ids.end(), [&distances](int a, int b) {
+        return (distances.at(a) < distances.at(b))
+            || ((distances.at(a) == distances.at(b)) && (a < b));
+    });
+
+    // initialize the convex hull with the seed triangle
+    mHash.fill(-1, qMax(static_cast<int>(std::ceil(std::sqrt(n))), 1));
+    mHullPrev.fill(-1, n);
+    mHullNext.fill(-1, n);
+    mHullTri.fill(-1, n);
+    mHullStart = i0;
+    mHullNext[i0] = mHullPrev[i2] = i1;
+    mHullNext[i1] = mHullPrev[i0] = i2;
+    mHullNext[i2] = mHullPrev[i1] = i0;
+    mHullTri[i0] = 0;
+    mHullTri[i1] = 1;
+    mHullTri[i2] = 2;
+    mHash[hashKey(x(i0), y(i0))] = i0;
+    mHash[hashKey(x(i1), y(i1))] = i1;
+    mHash[hashKey(x(i2), y(i2))] = i2;
+    int maxTriangles = qMax(2 * n - 5, 1);
+    mTriangles.reserve(3 * maxTriangles);
+    mHalfEdges.reserve(3 * maxTriangles);
+    addTriangle(i0, i1, i2, -1, -1, -1);
+
+    const qreal epsilon = std::numeric_limits<qreal>::epsilon();
+    qreal xp = 0, yp = 0;
+    for (int k = 0; k < n; ++k) {
+        const int i = ids.at(k);
+        const qreal px = x(i);
+        const qreal py = y(i);
+
+        // skip points which are (almost) at the same position as the previous point
+        if ((k > 0) && (qAbs(px - xp) <= epsilon) && (qAbs(py - yp) <= epsilon)) continue;
+        xp = px;
+        yp = py;
+
+        // skip the seed triangle points
+        if ((i == i0) || (i == i1) || (i == i2)) continue;
+
+        // find a visible edge on the convex hull using the hash table
+        int start = 0;
+        const int key = hashKey(px, py);
+        for (int j = 0; j < mHash.count(); ++j) {
+            start = mHash.at((key + j) % mHash.count());
+            if ((start >= 0) && (start != mHullNext.at(start))) break;
+        }
+        start = mHullPrev.at(start);
+        int e = start;
+        int q = mHullNext.at(e);
+        while (!orient(px, py, x(e), y(e), x(q), y(q))) {
+            e = q;
+            if (e == start) {
+                e = -1;
+                break;
+            }
+            q = mHullNext.at(e);
+        }
+        if (e < 0) continue; // likely a near-duplicate point, skip it
+
+        // add the first triangle from the point
+        int t = addTriangle(e, i, mHullNext.at(e), -1, -1, mHullTri.at(e));
+        mHullTri[i] = legalize(t + 2);
+        mHullTri[e] = t;
+
+        // walk forward through the hull, adding more triangles
+        int next = mHullNext.at(e);
+        q = mHullNext.at(next);
+        while (orient(px, py, x(next), y(next), x(q), y(q))) {
+            t = addTriangle(next, i, q, mHullTri.at(i), -1, mHullTri.at(next));
+            mHullTri[i] = legalize(t + 2);
+            mHullNext[next] = next; // mark as removed
+            next = q;
+            q = mHullNext.at(next);
+        }
+
+        // walk backward from the other side, adding more triangles
+        if (e == start) {
+            q = mHullPrev.at(e);
+            while (orient(px, py, x(q), y(q), x(e), y(e))) {
+                t = addTriangle(q, i, e, -1, mHullTri.at(e), mHullTri.at(q));
+                legalize(t + 2);
+                mHullTri[q] = t;
+                mHullNext[e] = e; // mark as removed
+                e = q;
+                q = mHullPrev.at(e);
+            }
+        }
+
+        // update the hull and the hash table
+        mHullStart = mHullPrev[i] = e;
+        mHullNext[e] = mHullPrev[next] = i;
+        mHullNext[i] = next;
+        mHash[hashKey(px, py)] = i;
+        mHash[hashKey(x(e), y(e))] = e;
+    }
+}
+
+int DelaunayTriangulation::legalize(int a) noexcept
+{
+    int i = 0;
+    int ar = 0;
+    mEdgeStack.clear();
+
+    // flip edges until all of them fulfill the Delaunay condition (iteratively, to avoid
+    // deep recursions)
+    while (true) {
+        const int b = mHalfEdges.at(a);
+        const int a0 = a - a % 3;
+        ar = a0 + (a + 2) % 3;
+
+        if (b < 0) { // convex hull edge
+            if (i == 0) break;
+            a = mEdgeStack.at(--i);
+            continue;
+        }
+
+        const int b0 = b - b % 3;
+        const int al = a0 + (a + 1) % 3;
+        const int bl = b0 + (b + 2) % 3;
+        const int p0 = mTriangles.at(ar);
+        const int pr = mTriangles.at(a);
+        const int pl = mTriangles.at(al);
+        const int p1 = mTriangles.at(bl);
+
+        if (inCircle(x(p0), y(p0), x(pr), y(pr), x(pl), y(pl), x(p1), y(p1))) {
+            mTriangles[a] = p1;
+            mTriangles[b] = p0;
+
+            // edge swapped on the other side of the hull (rare), fix the hull reference
+            const int hbl = mHalfEdges.at(bl);
+            if (hbl < 0) {
+                int e = mHullStart;
+                do {
+                    if (mHullTri.at(e) == bl) {
+                        mHullTri[e] = a;
+                        break;
+                    }
+                    e = mHullPrev.at(e);
+                } while (e != mHullStart);
+            }
+            link(a, hbl);
+            link(b, mHalfEdges.at(ar));
+            link(ar, bl);
+
+            const int br = b0 + (b + 1) % 3;
+            if (i < mEdgeStack.count()) {
+                mEdgeStack[i] = br;
+            } else {
+                mEdgeStack.append(br);
+            }
+            ++i;
+        } else {
+            if (i == 0) break;
+            a = mEdgeStack.at(--i);
+        }
+    }
+    return ar;
+}
+
+int DelaunayTriangulation::addTriangle(int i0, int i1, int i2, int a, int b, int c) noexcept
+{
+    const int t = mTriangles.count();
+    mTriangles.append(i0);
+    mTriangles.append(i1);
+    mTriangles.append(i2);
+    link(t, a);
+    link(t + 1, b);
+    link(t + 2, c);
+    return t;
+}
+
+void DelaunayTriangulation::link(int a, int b) noexcept
+{
+    Q_ASSERT((a >= 0) && (a <= mHalfEdges.count()));
+    if (a == mHalfEdges.count()) {
+        mHalfEdges.append(b);
+    } else {
+        mHalfEdges[a] = b;
+    }
+    if (b >= 0) {
+        Q_ASSERT(b <= mHalfEdges.count());
+        if (b == mHalfEdges.count()) {
+            mHalfEdges.append(a);
+        } else {
+            mHalfEdges[b] = a;
+        }
+    }
+}
+
+int DelaunayTriangulation::hashKey(qreal px, qreal py) const noexcept
+{
+    // monotonic pseudo angle in the range [0..1] instead of the (slow) real angle
+    const qreal dx = px - mCenter.x();
+    const qreal dy = py - mCenter.y();
+    const qreal sum = qAbs(dx) + qAbs(dy);
+    const qreal p = (sum > 0) ? (dx / sum) : 0;
+    const qreal angle = ((dy > 0) ? (3 - p) : (1 + p)) / 4;
+    const int size = mHash.count();
+    const int key = static_cast<int>(std::floor(angle * size)) % size;
+    return (key < 0) ? (key + size) : key;
+}
+
+/*****************************************************************************************
+ *  Static Methods
+ ****************************************************************************************/
+
+qreal DelaunayTriangulation::squaredDistance(qreal ax, qreal ay, qreal bx, qreal by) noexcept
+{
+    const qreal dx = ax - bx;
+    const qreal dy = ay - by;
+    return dx * dx + dy * dy;
+}
+
+qreal DelaunayTriangulation::circumradius(qreal ax, qreal ay, qreal bx, qreal by,
+                                          qreal cx, qreal cy) noexcept
+{
+    const qreal dx = bx - ax;
+    const qreal dy = by - ay;
+    const qreal ex = cx - ax;
+    const qreal ey = cy - ay;
+    const qreal bl = dx * dx + dy * dy;
+    const qreal cl = ex * ex + ey * ey;
+    const qreal d = dx * ey - dy * ex;
+    if ((bl > 0) && (cl > 0) && (d != 0)) {
+        const qreal ox = (ey * bl - dy * cl) * 0.5 / d;
+        const qreal oy = (dx * cl - ex * bl) * 0.5 / d;
+        return ox * ox + oy * oy; // squared radius
+    } else {
+        return std::numeric_limits<qreal>::infinity();
+    }
+}
+
+QPointF DelaunayTriangulation::circumcenter(qreal ax, qreal ay, qreal bx, qreal by,
+                                            qreal cx, qreal cy) noexcept
+{
+    const qreal dx = bx - ax;
+    const qreal dy = by - ay;
+    const qreal ex = cx - ax;
+    const qreal ey = cy - ay;
+    const qreal bl = dx * dx + dy * dy;
+    const qreal cl = ex * ex + ey * ey;
+    const qreal d = dx * ey - dy * ex;
+    return QPointF(ax + (ey * bl - dy * cl) * 0.5 / d,
+                   ay + (dx * cl - ex * bl) * 0.5 / d);
+}
+
+bool DelaunayTriangulation::orient(qreal px, qreal py, qreal qx, qreal qy,
+                                   qreal rx, qreal ry) noexcept
+{
+    return (qy - py) * (rx - qx) - (qx - px) * (ry - qy) < 0;
+}
+
+bool DelaunayTriangulation::inCircle(qreal ax, qreal ay, qreal bx, qreal by,
+                                     qreal cx, qreal cy, qreal px, qreal py) noexcept
+{
+    const qreal dx = ax - px;
+    const qreal dy = ay - py;
+    const qreal ex = bx - px;
+    const qreal ey = by - py;
+    const qreal fx = cx - px;
+    const qreal fy = cy - py;
+    const qreal ap = dx * dx + dy * dy;
+    const qreal bp = ex * ex + ey * ey;
+    const qreal cp = fx * fx + fy * fy;
+    return dx * (ey * cp - bp * fy) - dy * (ex * cp - bp * fx) + ap * (ex * fy - ey * fx) < 0;
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace librepcb
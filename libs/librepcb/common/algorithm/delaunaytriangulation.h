@@ -0,0 +1,124 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_DELAUNAYTRIANGULATION_H
+#define LIBREPCB_DELAUNAYTRIANGULATION_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include "../units/point.h"
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+
+/*****************************************************************************************
+ *  Class DelaunayTriangulation
+ ****************************************************************************************/
+
+/**
+ * @brief The DelaunayTriangulation class calculates the Delaunay triangulation of a set
+ *        of points in O(n log n)
+ *
+ * The points are sorted by their distance to a seed triangle and then added to the
+ * triangulation one by one, connecting each of them to the visible edges of the convex
+ * hull and flipping illegal edges afterwards (sweep-hull algorithm).
+ *
+ * Points which are (almost) at the same position as another point are not part of the
+ * triangulation. If all points are collinear, there are no triangles at all, but
+ * #getEdges() still connects neighbouring points along the line.
+ */
+class DelaunayTriangulation final
+{
+    public:
+
+        // Types
+        typedef QPair<int, int> Edge; ///< the indices of the two points of an edge
+
+        // Constructors / Destructor
+        DelaunayTriangulation() = delete;
+        DelaunayTriangulation(const DelaunayTriangulation& other) = delete;
+        explicit DelaunayTriangulation(const QVector<Point>& points) noexcept;
+        ~DelaunayTriangulation() noexcept;
+
+        // Getters
+
+        /**
+         * @brief Get the triangles as point indices (three consecutive indices per
+         *        triangle)
+         */
+        const QVector<int>& getTriangles() const noexcept {return mTriangles;}
+
+        /**
+         * @brief Get all edges of the triangulation (each edge only once)
+         */
+        QVector<Edge> getEdges() const noexcept;
+
+        // Operator Overloadings
+        DelaunayTriangulation& operator=(const DelaunayTriangulation& rhs) = delete;
+
+
+    private:
+
+        // Private Methods
+        void triangulate() noexcept;
+        int legalize(int a) noexcept;
+        int addTriangle(int i0, int i1, int i2, int a, int b, int c) noexcept;
+        void link(int a, int b) noexcept;
+        int hashKey(qreal px, qreal py) const noexcept;
+        qreal x(int i) const noexcept {return mCoords.at(2 * i);}
+        qreal y(int i) const noexcept {return mCoords.at(2 * i + 1);}
+
+        // Static Methods
+        static qreal squaredDistance(qreal ax, qreal ay, qreal bx, qreal by) noexcept;
+        static qreal circumradius(qreal ax, qreal ay, qreal bx, qreal by,
+                                  qreal cx, qreal cy) noexcept;
+        static QPointF circumcenter(qreal ax, qreal ay, qreal bx, qreal by,
+                                    qreal cx, qreal cy) noexcept;
+        static bool orient(qreal px, qreal py, qreal qx, qreal qy,
+                           qreal rx, qreal ry) noexcept;
+        static bool inCircle(qreal ax, qreal ay, qreal bx, qreal by, qreal cx, qreal cy,
+                             qreal px, qreal py) noexcept;
+
+
+        // Result
+        QVector<qreal> mCoords;     ///< x/y coordinates of all points in millimeters
+        QVector<int> mTriangles;    ///< three point indices per triangle
+        QVector<int> mHalfEdges;    ///< index of the opposite half-edge (-1 on the hull)
+
+        // Temporary data, only used while triangulating
+        QVector<int> mHullPrev;     ///< previous point on the convex hull
+        QVector<int> mHullNext;     ///< next point on the convex hull
+        QVector<int> mHullTri;      ///< triangle (half-edge) of each hull edge
+        QVector<int> mHash;         ///< hull points by their angle to the center
+        QVector<int> mEdgeStack;    ///< half-edges which still need to be legalized
+        int mHullStart;
+        QPointF mCenter;
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace librepcb
+
+#endif // LIBREPCB_DELAUNAYTRIANGULATION_H
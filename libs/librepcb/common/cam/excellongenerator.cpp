@@ -21,6 +21,10 @@
  *  Includes
  ****************************************************************************************/
 #include <QtCore>
+#include <algorithm>
+#include <numeric>
+#include <limits>
+#include <cmath>
 #include "excellongenerator.h"
 #include "../fileio/smarttextfile.h"
 #include "../application.h"
@@ -35,7 +39,8 @@ namespace librepcb {
  ****************************************************************************************/
 
 ExcellonGenerator::ExcellonGenerator() noexcept :
-    mOutput()
+    mOutput(), mDrillList(), mDrillPathOptimizationEnabled(false),
+    mDrillPathOptimizationMaxPasses(0), mTravelDistanceBefore(0), mTravelDistanceAfter(0)
 {
 }
 
@@ -43,6 +48,16 @@ ExcellonGenerator::~ExcellonGenerator() noexcept
 {
 }
 
+/*****************************************************************************************
+ *  Setters
+ ****************************************************************************************/
+
+void ExcellonGenerator::setDrillPathOptimizationEnabled(bool enabled, int maxPasses) noexcept
+{
+    mDrillPathOptimizationEnabled = enabled;
+    mDrillPathOptimizationMaxPasses = qMax(maxPasses, 0);
+}
+
 /*****************************************************************************************
  *  General Methods
  ****************************************************************************************/
@@ -71,6 +86,8 @@ void ExcellonGenerator::reset() noexcept
 {
     mOutput.clear();
     mDrillList.clear();
+    mTravelDistanceBefore = 0;
+    mTravelDistanceAfter = 0;
 }
 
 /*****************************************************************************************
@@ -98,22 +115,49 @@ void ExcellonGenerator::printHeader() noexcept
 
 void ExcellonGenerator::printToolList() noexcept
 {
-    for (int i = 0; i < mDrillList.uniqueKeys().count(); ++i) {
-        Length dia = mDrillList.uniqueKeys().value(i);
-        mOutput.append(QString("T%1C%2\n").arg(i+1).arg(dia.toMmString()));
+    QList<Length> tools = mDrillList.uniqueKeys();
+    for (int i = 0; i < tools.count(); ++i) {
+        mOutput.append(QString("T%1C%2\n").arg(i+1).arg(tools.at(i).toMmString()));
     }
 }
 
 void ExcellonGenerator::printDrills() noexcept
 {
-    for (int i = 0; i < mDrillList.uniqueKeys().count(); ++i) {
+    QElapsedTimer timer;
+    timer.start();
+    Point positionBefore(0, 0);
+    Point positionAfter(0, 0);
+    mTravelDistanceBefore = 0;
+    mTravelDistanceAfter = 0;
+
+    QList<Length> tools = mDrillList.uniqueKeys();
+    for (int i = 0; i < tools.count(); ++i) {
         mOutput.append(QString("T%1\n").arg(i+1)); // Select Tool
-        Length dia = mDrillList.uniqueKeys().value(i);
-        foreach (const Point& pos, mDrillList.values(dia)) {
+        QList<Point> drills = mDrillList.values(tools.at(i));
+        mTravelDistanceBefore += calcTravelDistance(positionBefore, drills);
+        positionBefore = drills.last();
+        qreal travelDistance = calcTravelDistance(positionAfter, drills);
+        if (mDrillPathOptimizationEnabled) {
+            QList<Point> optimized = optimizeDrillPath(positionAfter, drills,
+                                                       mDrillPathOptimizationMaxPasses);
+            qreal optimizedTravelDistance = calcTravelDistance(positionAfter, optimized);
+            if (optimizedTravelDistance < travelDistance) {
+                drills = optimized;
+                travelDistance = optimizedTravelDistance;
+            }
+        }
+        mTravelDistanceAfter += travelDistance;
+        positionAfter = drills.last();
+        foreach (const Point& pos, drills) {
             mOutput.append(QString("X%1Y%2\n").arg(pos.getX().toMmString(),
                                                    pos.getY().toMmString()));
         }
     }
+
+    if (mDrillPathOptimizationEnabled) {
+        qDebug() << "Optimized drill path from" << mTravelDistanceBefore << "mm to"
+                 << mTravelDistanceAfter << "mm in" << timer.elapsed() << "ms.";
+    }
 }
 
 void ExcellonGenerator::printFooter() noexcept
@@ -122,6 +166,121 @@ void ExcellonGenerator::printFooter() noexcept
     mOutput.append("M30\n");        // End of Program Rewind
 }
 
+/*****************************************************************************************
+ *  Static Methods
+ ****************************************************************************************/
+
+QList<Point> ExcellonGenerator::optimizeDrillPath(const Point& start, const QList<Point>& drills,
+    int maxPasses) noexcept
+{
+    int n = drills.count();
+    if (n < 3) return drills;
+
+    // use floating point coordinates (in nanometers) to avoid overflows
+    QVector<QPointF> pos(n);
+    for (int i = 0; i < n; ++i) {
+        pos[i] = QPointF(drills.at(i).getX().toNm(), drills.at(i).getY().toNm());
+    }
+    QPointF startPos(start.getX().toNm(), start.getY().toNm());
+
+    // Step 1: nearest neighbour path
+    //
+    // The drills are sorted by their x coordinate and the not yet visited ones are linked
+    // in a list, so the search can start at the current position and stop as soon as the
+    // x distance alone is larger than the nearest drill found so far.
+    QVector<int> sorted(n);
+    std::iota(sorted.begin(), sorted.end(), 0);
+    std::sort(sorted.begin(), sorted.end(), [&pos](int a, int b) {
+        return pos.at(a).x() < pos.at(b).x();
+    });
+    QVector<int> prev(n), next(n); // not yet visited neighbours (indices of "sorted")
+    for (int k = 0; k < n; ++k) {
+        prev[k] = k - 1;
+        next[k] = k + 1;
+    }
+    int right = std::lower_bound(sorted.constBegin(), sorted.constEnd(), startPos.x(),
+        [&pos](int a, qreal x) {return pos.at(a).x() < x;}) - sorted.constBegin();
+    int left = right - 1;
+    QPointF current = startPos;
+    QVector<int> tour;
+    tour.reserve(n);
+    while (tour.count() < n) {
+        int nearest = -1;
+        qreal nearestDistance = std::numeric_limits<qreal>::infinity();
+        for (int k = left; k >= 0; k = prev[k]) {
+            QPointF diff = pos.at(sorted.at(k)) - current;
+            if (diff.x() * diff.x() >= nearestDistance) break;
+            qreal distance = diff.x() * diff.x() + diff.y() * diff.y();
+            if (distance < nearestDistance) {nearest = k; nearestDistance = distance;}
+        }
+        for (int k = right; k < n; k = next[k]) {
+            QPointF diff = pos.at(sorted.at(k)) - current;
+            if (diff.x() * diff.x() >= nearestDistance) break;
+            qreal distance = diff.x() * diff.x() + diff.y() * diff.y();
+            if (distance < nearestDistance) {nearest = k; nearestDistance = distance;}
+        }
+        Q_ASSERT(nearest >= 0);
+        tour.append(sorted.at(nearest));
+        current = pos.at(sorted.at(nearest));
+        // unlink the visited drill, its neighbours are the start of the next search
+        left = prev[nearest];
+        right = next[nearest];
+        if (left >= 0) next[left] = right;
+        if (right < n) prev[right] = left;
+    }
+
+    // Step 2: improve the path with 2-opt (reverse sub-paths if this makes it shorter)
+    //
+    // The nearest neighbour path is already locally good, so only edges which are close
+    // to each other in the path are considered. This bounds the work of each pass to
+    // O(n * sTwoOptWindow) and keeps the result deterministic.
+    auto point = [&](int i) {return (i < 0) ? startPos : pos.at(tour.at(i));};
+    auto distance = [](const QPointF& a, const QPointF& b) {
+        return std::hypot(a.x() - b.x(), a.y() - b.y());
+    };
+    bool improved = true;
+    for (int pass = 0; improved && (pass < maxPasses); ++pass) {
+        improved = false;
+        for (int i = -1; i < n - 2; ++i) {
+            // edges (i, i+1) and (j, j+1), where i = -1 is the start position
+            QPointF a = point(i);
+            int last = qMin(n - 1, i + 1 + sTwoOptWindow);
+            for (int j = i + 2; j <= last; ++j) {
+                QPointF b = point(i + 1);
+                QPointF c = point(j);
+                qreal delta = distance(a, c) - distance(a, b);
+                if (j < n - 1) {
+                    QPointF d = point(j + 1);
+                    delta += distance(b, d) - distance(c, d);
+                }
+                if (delta < -1.0) { // ignore improvements smaller than 1nm
+                    std::reverse(tour.begin() + i + 1, tour.begin() + j + 1);
+                    improved = true;
+                }
+            }
+        }
+    }
+
+    QList<Point> result;
+    result.reserve(n);
+    foreach (int index, tour) {
+        result.append(drills.at(index));
+    }
+    return result;
+}
+
+qreal ExcellonGenerator::calcTravelDistance(const Point& start, const QList<Point>& drills) noexcept
+{
+    qreal distance = 0;
+    Point previous = start;
+    foreach (const Point& pos, drills) {
+        Point diff = pos - previous;
+        distance += std::hypot(diff.getX().toMm(), diff.getY().toMm());
+        previous = pos;
+    }
+    return distance;
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
@@ -40,6 +40,12 @@ namespace librepcb {
 /**
  * @brief The ExcellonGenerator class
  *
+ * By default, the holes of each tool are drilled in the order they were added. With
+ * #setDrillPathOptimizationEnabled(), the order is optimized to reduce the travel
+ * distance of the drill machine (nearest neighbour path, improved with a limited count of
+ * 2-opt passes). The result only depends on the drills, so the generated files are
+ * reproducible. The file format is the same in both cases.
+ *
  * @author ubruhin
  * @date 2016-03-31
  */
@@ -58,6 +64,35 @@ class ExcellonGenerator final
         // Getters
         const QString& toStr() const noexcept {return mOutput;}
 
+        /**
+         * @brief Get the estimated travel distance of the drills in the original order
+         *
+         * @return The distance in millimeters (starting at the origin, valid after
+         *         #generate() was called)
+         */
+        qreal getTravelDistanceBeforeOptimization() const noexcept {return mTravelDistanceBefore;}
+
+        /**
+         * @brief Get the estimated travel distance of the drills in the generated order
+         *
+         * @return The distance in millimeters (equal to
+         *         #getTravelDistanceBeforeOptimization() if the optimization is disabled)
+         */
+        qreal getTravelDistanceAfterOptimization() const noexcept {return mTravelDistanceAfter;}
+
+        // Setters
+
+        /**
+         * @brief Enable or disable the optimization of the drill order
+         *
+         * @param enabled       Whether the drill order should be optimized
+         * @param maxPasses     Maximum count of 2-opt passes over the drills of each tool
+         *                      (0 means nearest neighbour only). Each pass only tries
+         *                      to reconnect drills which are at most #sTwoOptWindow
+         *                      positions apart in the path, so it needs O(n) time.
+         */
+        void setDrillPathOptimizationEnabled(bool enabled, int maxPasses = 5) noexcept;
+
         // General Methods
         void drill(const Point& pos, const Length& dia) noexcept;
         void generate() throw (Exception);
@@ -75,10 +110,24 @@ class ExcellonGenerator final
         void printDrills() noexcept;
         void printFooter() noexcept;
 
+        // Static Methods
+        static QList<Point> optimizeDrillPath(const Point& start, const QList<Point>& drills,
+                                              int maxPasses) noexcept;
+        static qreal calcTravelDistance(const Point& start, const QList<Point>& drills) noexcept;
+
+        // Constants
+        static constexpr int sTwoOptWindow = 50; ///< max. path distance of 2-opt candidates
+
 
         // Excellon Data
         QString mOutput;
         QMultiMap<Length, Point> mDrillList;
+
+        // Drill Path Optimization
+        bool mDrillPathOptimizationEnabled;
+        int mDrillPathOptimizationMaxPasses;
+        qreal mTravelDistanceBefore;            ///< in millimeters
+        qreal mTravelDistanceAfter;             ///< in millimeters
 };
 
 /*****************************************************************************************
@@ -51,8 +51,8 @@ QString GerberApertureList::generateString() const noexcept
     foreach (const QString& macro, mApertureMacros) {
         str.append(QString("%AM%1*%\n").arg(macro));
     }
-    foreach (int number, mApertures.keys()) {
-        str.append(QString("%ADD%1%2*%\n").arg(number).arg(mApertures.value(number)));
+    for (int i = 0; i < mApertures.count(); ++i) {
+        str.append(QString("%ADD%1%2*%\n").arg(i + 10).arg(generateAperture(mApertures.at(i))));
     }
     str.append("G04 --- APERTURE LIST END --- *\n");
     return str;
@@ -64,15 +64,15 @@ QString GerberApertureList::generateString() const noexcept
 
 int GerberApertureList::setCircle(const Length& dia, const Length& hole)
 {
-    return setCurrentAperture(generateCircle(dia, hole));
+    return setCurrentAperture(Aperture::Shape::Circle, dia, Length(0), Angle(0), 0, hole);
 }
 
 int GerberApertureList::setRect(const Length& w, const Length& h, const Angle& rot, const Length& hole) noexcept
 {
     if (rot % Angle::deg180() == 0) {
-        return setCurrentAperture(generateRect(w, h, hole));
+        return setCurrentAperture(Aperture::Shape::Rect, w, h, Angle(0), 0, hole);
     } else if (rot % Angle::deg90() == 0) {
-        return setCurrentAperture(generateRect(h, w, hole));
+        return setCurrentAperture(Aperture::Shape::Rect, h, w, Angle(0), 0, hole);
     } else {
         // Rotation is not a multiple of 90 degrees --> we need to use an aperture macro
         if (hole > 0) {
@@ -80,16 +80,16 @@ int GerberApertureList::setRect(const Length& w, const Length& h, const Angle& r
         } else {
             addMacro(generateRotatedRectMacro());
         }
-        return setCurrentAperture(generateRotatedRect(w, h, rot, hole));
+        return setCurrentAperture(Aperture::Shape::RotatedRect, w, h, rot, 0, hole);
     }
 }
 
 int GerberApertureList::setObround(const Length& w, const Length& h, const Angle& rot, const Length& hole) noexcept
 {
     if (rot % Angle::deg180() == 0) {
-        return setCurrentAperture(generateObround(w, h, hole));
+        return setCurrentAperture(Aperture::Shape::Obround, w, h, Angle(0), 0, hole);
     } else if (rot % Angle::deg90() == 0) {
-        return setCurrentAperture(generateObround(h, w, hole));
+        return setCurrentAperture(Aperture::Shape::Obround, h, w, Angle(0), 0, hole);
     } else {
         // Rotation is not a multiple of 90 degrees --> we need to use an aperture macro
         if (hole > 0) {
@@ -97,7 +97,7 @@ int GerberApertureList::setObround(const Length& w, const Length& h, const Angle
         } else {
             addMacro(generateRotatedObroundMacro());
         }
-        return setCurrentAperture(generateRotatedObround(w, h, rot, hole));
+        return setCurrentAperture(Aperture::Shape::RotatedObround, w, h, rot, 0, hole);
     }
 }
 
@@ -108,26 +108,30 @@ int GerberApertureList::setRegularPolygon(const Length& dia, int n, const Angle&
     }
     // Adjust rotation as its interpretation differs between LibrePCB and Gerber specs
     Angle grbRot = rot + (Angle::deg180() / (n > 0 ? n : 1));
-    return setCurrentAperture(generateRegularPolygon(dia, n, grbRot, hole));
+    return setCurrentAperture(Aperture::Shape::RegularPolygon, dia, Length(0), grbRot, n, hole);
 }
 
 void GerberApertureList::reset() noexcept
 {
     //mApertureMacros.clear();
     mApertures.clear();
+    mApertureNumbers.clear();
 }
 
 /*****************************************************************************************
  *  Private Methods
  ****************************************************************************************/
 
-int GerberApertureList::setCurrentAperture(const QString& aperture) noexcept
+int GerberApertureList::setCurrentAperture(Aperture::Shape shape, const Length& w,
+                                           const Length& h, const Angle& rot, int n,
+                                           const Length& hole) noexcept
 {
-    int number = mApertures.key(aperture, -1);
+    Aperture aperture{shape, w, h, rot, n, (hole > 0) ? hole : Length(0)};
+    int number = mApertureNumbers.value(aperture, -1);
     if (number < 0) {
         number = mApertures.count() + 10; // 10 is the number of the first aperture
-        Q_ASSERT(!mApertures.contains(number));
-        mApertures.insert(number, aperture);
+        mApertures.append(aperture);
+        mApertureNumbers.insert(aperture, number);
     }
     return number;
 }
@@ -143,6 +147,19 @@ void GerberApertureList::addMacro(const QString& macro) noexcept
  *  Aperture Generator Methods
  ****************************************************************************************/
 
+QString GerberApertureList::generateAperture(const Aperture& a) noexcept
+{
+    switch (a.shape) {
+        case Aperture::Shape::Circle:           return generateCircle(a.w, a.hole);
+        case Aperture::Shape::Rect:             return generateRect(a.w, a.h, a.hole);
+        case Aperture::Shape::Obround:          return generateObround(a.w, a.h, a.hole);
+        case Aperture::Shape::RegularPolygon:   return generateRegularPolygon(a.w, a.n, a.rot, a.hole);
+        case Aperture::Shape::RotatedRect:      return generateRotatedRect(a.w, a.h, a.rot, a.hole);
+        case Aperture::Shape::RotatedObround:   return generateRotatedObround(a.w, a.h, a.rot, a.hole);
+        default: qCritical() << "Unknown aperture shape:" << static_cast<int>(a.shape); return QString();
+    }
+}
+
 QString GerberApertureList::generateCircle(const Length& dia, const Length& hole) noexcept
 {
     if (hole > 0) {
@@ -41,6 +41,11 @@ namespace librepcb {
 /**
  * @brief The GerberApertureList class
  *
+ * Apertures are identified by a typed key (shape, dimensions, rotation, hole) which is
+ * looked up in a hash table, so getting the number of an aperture doesn't depend on the
+ * count of apertures. The aperture definition strings are only formatted once in
+ * #generateString().
+ *
  * @author ubruhin
  * @date 2016-03-31
  */
@@ -72,11 +77,37 @@ class GerberApertureList final
 
     private:
 
+        // Private Types
+        struct Aperture {
+            enum class Shape {Circle, Rect, Obround, RegularPolygon, RotatedRect, RotatedObround};
+            Shape shape;
+            Length w;       ///< width resp. diameter
+            Length h;       ///< height (0 if not applicable)
+            Angle rot;      ///< rotation (0 if not applicable)
+            int n;          ///< count of vertices (0 if not applicable)
+            Length hole;    ///< hole diameter (0 if there is no hole)
+
+            bool operator==(const Aperture& rhs) const noexcept {
+                return (shape == rhs.shape) && (w == rhs.w) && (h == rhs.h) &&
+                       (rot == rhs.rot) && (n == rhs.n) && (hole == rhs.hole);
+            }
+            friend uint qHash(const Aperture& key, uint seed) noexcept {
+                return qHash(qMakePair(qMakePair(int(key.shape), key.n),
+                                       qMakePair(key.rot.toMicroDeg(),
+                                                 qMakePair(key.w.toNm(),
+                                                           qMakePair(key.h.toNm(),
+                                                                     key.hole.toNm())))),
+                             seed);
+            }
+        };
+
         // Private Methods
-        int setCurrentAperture(const QString& aperture) noexcept;
+        int setCurrentAperture(Aperture::Shape shape, const Length& w, const Length& h,
+                               const Angle& rot, int n, const Length& hole) noexcept;
         void addMacro(const QString& macro) noexcept;
 
         // Aperture Generator Methods
+        static QString generateAperture(const Aperture& aperture) noexcept;
         static QString generateCircle(const Length& dia, const Length& hole) noexcept;
         static QString generateRect(const Length& w, const Length& h, const Length& hole) noexcept;
         static QString generateObround(const Length& w, const Length& h, const Length& hole) noexcept;
@@ -90,7 +121,8 @@ class GerberApertureList final
 
 
         QList<QString> mApertureMacros;
-        QMap<int, QString> mApertures; ///< key: aperture number (>= 10); value: aperture definition
+        QVector<Aperture> mApertures; ///< index: aperture number - 10
+        QHash<Aperture, int> mApertureNumbers; ///< value: aperture number (>= 10)
 };
 
 /*****************************************************************************************
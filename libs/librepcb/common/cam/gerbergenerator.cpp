@@ -26,6 +26,7 @@
 #include "../geometry/ellipse.h"
 #include "../geometry/polygon.h"
 #include "../fileio/smarttextfile.h"
+#include "../fileio/fileutils.h"
 #include "../application.h"
 
 /*****************************************************************************************
@@ -41,7 +42,7 @@ GerberGenerator::GerberGenerator(const QString& projName, const Uuid& projUuid,
                                  const QString& projRevision) noexcept :
     mProjectId(escapeString(projName)), mProjectUuid(projUuid),
     mProjectRevision(escapeString(projRevision)), mOutput(), mContent(),
-    mApertureList(new GerberApertureList()), mCurrentApertureNumber(-1),
+    mContentSpoolFile(), mContentSpoolError(), mApertureList(new GerberApertureList()), mCurrentApertureNumber(-1),
     mMultiQuadrantArcModeOn(false)
 {
 }
@@ -58,8 +59,8 @@ void GerberGenerator::setLayerPolarity(LayerPolarity p) noexcept
 {
     switch (p)
     {
-        case LayerPolarity::Positive: mContent.append("%LPD*%\n"); break;
-        case LayerPolarity::Negative: mContent.append("%LPC*%\n"); break;
+        case LayerPolarity::Positive: appendContent("%LPD*%\n"); break;
+        case LayerPolarity::Negative: appendContent("%LPC*%\n"); break;
         default: qCritical() << "Invalid Layer Polarity:" << static_cast<int>(p); break;
     }
 }
@@ -193,6 +194,8 @@ void GerberGenerator::reset() noexcept
 {
     mOutput.clear();
     mContent.clear();
+    mContentSpoolFile.reset();
+    mContentSpoolError.clear();
     mApertureList->reset();
     mCurrentApertureNumber = -1;
 }
@@ -200,16 +203,41 @@ void GerberGenerator::reset() noexcept
 void GerberGenerator::generate() throw (Exception)
 {
     mOutput.clear();
-    printHeader();
-    printApertureList();
-    printContent();
-    printFooter();
+    QBuffer buffer(&mOutput);
+    buffer.open(QIODevice::WriteOnly);
+    generate(buffer);
+}
+
+void GerberGenerator::generate(QIODevice& device) throw (Exception)
+{
+    QCryptographicHash md5(QCryptographicHash::Md5);
+    printHeader(device, md5);
+    printApertureList(device, md5);
+    printContent(device, md5);
+    printFooter(device, md5);
+}
+
+void GerberGenerator::generateToFile(const FilePath& filepath) throw (Exception)
+{
+    FileUtils::makePath(filepath.getParentDir()); // can throw
+    QSaveFile file(filepath.toStr());
+    if (!file.open(QIODevice::WriteOnly)) {
+        throw RuntimeError(__FILE__, __LINE__, QString("%1: %2 [%3]")
+            .arg(filepath.toStr(), file.errorString()).arg(file.error()),
+            QString(tr("Could not open or create file \"%1\": %2"))
+            .arg(filepath.toNative(), file.errorString()));
+    }
+    generate(file); // can throw
+    if (!file.commit()) {
+        throw RuntimeError(__FILE__, __LINE__, QString(), QString(tr("Could not write to "
+            "file \"%1\": %2")).arg(filepath.toNative(), file.errorString()));
+    }
 }
 
 void GerberGenerator::saveToFile(const FilePath& filepath) const throw (Exception)
 {
     QScopedPointer<SmartTextFile> file(SmartTextFile::create(filepath));
-    file->setContent(mOutput.toLatin1());
+    file->setContent(mOutput);
     file->save(true);
 }
 
@@ -217,28 +245,47 @@ void GerberGenerator::saveToFile(const FilePath& filepath) const throw (Exceptio
  *  Private Methods
  ****************************************************************************************/
 
+void GerberGenerator::appendContent(const QByteArray& data) noexcept
+{
+    mContent.append(data);
+    if ((mContent.size() > sMaxContentBufferSize) && (mContentSpoolError.isEmpty())) {
+        if (!mContentSpoolFile) {
+            mContentSpoolFile.reset(new QTemporaryFile());
+            if (!mContentSpoolFile->open()) {
+                mContentSpoolError = mContentSpoolFile->errorString();
+                return; // keep the content in memory
+            }
+        }
+        if (mContentSpoolFile->write(mContent) == mContent.size()) {
+            mContent.clear();
+        } else {
+            mContentSpoolError = mContentSpoolFile->errorString();
+        }
+    }
+}
+
 void GerberGenerator::setCurrentAperture(int number) noexcept
 {
     if (number != mCurrentApertureNumber) {
-        mContent.append(QString("D%1*\n").arg(number));
+        appendContent("D" % QByteArray::number(number) % "*\n");
         mCurrentApertureNumber = number;
     }
 }
 
 void GerberGenerator::setRegionModeOn() noexcept
 {
-    mContent.append("G36*\n");
+    appendContent("G36*\n");
 }
 
 void GerberGenerator::setRegionModeOff() noexcept
 {
-    mContent.append("G37*\n");
+    appendContent("G37*\n");
 }
 
 void GerberGenerator::setMultiQuadrantArcModeOn() noexcept
 {
     if (!mMultiQuadrantArcModeOn) {
-        mContent.append("G75*\n");
+        appendContent("G75*\n");
         mMultiQuadrantArcModeOn = true;
     }
 }
@@ -246,36 +293,34 @@ void GerberGenerator::setMultiQuadrantArcModeOn() noexcept
 void GerberGenerator::setMultiQuadrantArcModeOff() noexcept
 {
     if (mMultiQuadrantArcModeOn) {
-        mContent.append("G74*\n");
+        appendContent("G74*\n");
         mMultiQuadrantArcModeOn = false;
     }
 }
 
 void GerberGenerator::switchToLinearInterpolationModeG01() noexcept
 {
-    mContent.append("G01*\n");
+    appendContent("G01*\n");
 }
 
 void GerberGenerator::switchToCircularCwInterpolationModeG02() noexcept
 {
-    mContent.append("G02*\n");
+    appendContent("G02*\n");
 }
 
 void GerberGenerator::switchToCircularCcwInterpolationModeG03() noexcept
 {
-    mContent.append("G03*\n");
+    appendContent("G03*\n");
 }
 
 void GerberGenerator::moveToPosition(const Point& pos) noexcept
 {
-    mContent.append(QString("X%1Y%2D02*\n").arg(pos.getX().toNmString(),
-                                                pos.getY().toNmString()));
+    appendContent(coordinatesToByteArray(pos) % "D02*\n");
 }
 
 void GerberGenerator::linearInterpolateToPosition(const Point& pos) noexcept
 {
-    mContent.append(QString("X%1Y%2D01*\n").arg(pos.getX().toNmString(),
-                                                pos.getY().toNmString()));
+    appendContent(coordinatesToByteArray(pos) % "D01*\n");
 }
 
 void GerberGenerator::circularInterpolateToPosition(const Point& start, const Point& center, const Point& end) noexcept
@@ -284,84 +329,118 @@ void GerberGenerator::circularInterpolateToPosition(const Point& start, const Po
     if (!mMultiQuadrantArcModeOn) {
         diff.makeAbs(); // no sign allowed in single quadrant mode!
     }
-    mContent.append(QString("X%1Y%2I%3J%4D01*\n").arg(end.getX().toNmString(),
-                                                      end.getY().toNmString(),
-                                                      diff.getX().toNmString(),
-                                                      diff.getY().toNmString()));
+    appendContent(coordinatesToByteArray(end) % "I" % QByteArray::number(diff.getX().toNm()) %
+                  "J" % QByteArray::number(diff.getY().toNm()) % "D01*\n");
 }
 
 void GerberGenerator::flashAtPosition(const Point& pos) noexcept
 {
-    mContent.append(QString("X%1Y%2D03*\n").arg(pos.getX().toNmString(),
-                                                pos.getY().toNmString()));
+    appendContent(coordinatesToByteArray(pos) % "D03*\n");
 }
 
-void GerberGenerator::printHeader() noexcept
+void GerberGenerator::printHeader(QIODevice& device, QCryptographicHash& md5) const throw (Exception)
 {
-    mOutput.append("G04 --- HEADER BEGIN --- *\n");
+    QString output("G04 --- HEADER BEGIN --- *\n");
 
     // add some X2 attributes
     QString appVersion = qApp->getAppVersion().toPrettyStr(3);
     QString creationDate = QDateTime::currentDateTime().toString(Qt::ISODate);
-    QString projId = mProjectId.remove(',');
+    QString projId = QString(mProjectId).remove(',');
     QString projUuid = mProjectUuid.toStr();
-    QString projRevision = mProjectRevision.remove(',');
-    mOutput.append(QString("%TF.GenerationSoftware,LibrePCB,LibrePCB,%1*%\n").arg(appVersion));
-    mOutput.append(QString("%TF.CreationDate,%1*%\n").arg(creationDate));
-    mOutput.append(QString("%TF.ProjectId,%1,%2,%3*%\n").arg(projId, projUuid, projRevision));
-    mOutput.append("%TF.Part,Single*%\n"); // "Single" means "this is a PCB"
-    //mOutput.append("%TF.FilePolarity,Positive*%\n");
+    QString projRevision = QString(mProjectRevision).remove(',');
+    output.append(QString("%TF.GenerationSoftware,LibrePCB,LibrePCB,%1*%\n").arg(appVersion));
+    output.append(QString("%TF.CreationDate,%1*%\n").arg(creationDate));
+    output.append(QString("%TF.ProjectId,%1,%2,%3*%\n").arg(projId, projUuid, projRevision));
+    output.append("%TF.Part,Single*%\n"); // "Single" means "this is a PCB"
+    //output.append("%TF.FilePolarity,Positive*%\n");
 
     // coordinate format specification:
     //  - leading zeros omitted
     //  - absolute coordinates
     //  - coordiante format "6.6" --> allows us to directly use LengthBase_t (nanometers)!
-    mOutput.append("%FSLAX66Y66*%\n");
+    output.append("%FSLAX66Y66*%\n");
 
     // set unit to millimeters
-    mOutput.append("%MOMM*%\n");
+    output.append("%MOMM*%\n");
 
     // start linear interpolation mode
-    mOutput.append("G01*\n");
+    output.append("G01*\n");
 
     // use single quadrant arc mode
-    mOutput.append("G74*\n");
+    output.append("G74*\n");
 
-    mOutput.append("G04 --- HEADER END --- *\n");
+    output.append("G04 --- HEADER END --- *\n");
+    write(device, md5, output.toUtf8());
 }
 
-void GerberGenerator::printApertureList() noexcept
+void GerberGenerator::printApertureList(QIODevice& device, QCryptographicHash& md5) const throw (Exception)
 {
-    mOutput.append(mApertureList->generateString());
+    write(device, md5, mApertureList->generateString().toUtf8());
 }
 
-void GerberGenerator::printContent() noexcept
+void GerberGenerator::printContent(QIODevice& device, QCryptographicHash& md5) throw (Exception)
 {
-    mOutput.append("G04 --- BOARD BEGIN --- *\n");
-    mOutput.append(mContent);
-    mOutput.append("G04 --- BOARD END --- *\n");
+    if (!mContentSpoolError.isEmpty()) {
+        throw RuntimeError(__FILE__, __LINE__, QString(), QString(tr("Could not write "
+            "to temporary file: %1")).arg(mContentSpoolError));
+    }
+
+    write(device, md5, "G04 --- BOARD BEGIN --- *\n");
+    if (mContentSpoolFile) {
+        // copy the spilled part of the body chunk by chunk
+        if (!mContentSpoolFile->seek(0)) {
+            throw RuntimeError(__FILE__, __LINE__, QString(), QString(tr("Could not read "
+                "from temporary file: %1")).arg(mContentSpoolFile->errorString()));
+        }
+        while (!mContentSpoolFile->atEnd()) {
+            QByteArray chunk = mContentSpoolFile->read(sMaxContentBufferSize);
+            if (chunk.isEmpty()) {
+                throw RuntimeError(__FILE__, __LINE__, QString(), QString(tr("Could not "
+                    "read from temporary file: %1")).arg(mContentSpoolFile->errorString()));
+            }
+            write(device, md5, chunk);
+        }
+    }
+    write(device, md5, mContent);
+    write(device, md5, "G04 --- BOARD END --- *\n");
 }
 
-void GerberGenerator::printFooter() noexcept
+void GerberGenerator::printFooter(QIODevice& device, QCryptographicHash& md5) const throw (Exception)
 {
     // MD5 checksum over content
-    mOutput.append(QString("%TF.MD5,%1*%\n").arg(calcOutputMd5Checksum()));
+    write(device, md5, "%TF.MD5," % md5.result().toHex() % "*%\n");
 
     // end of file
-    mOutput.append("M02*\n");
+    write(device, md5, "M02*\n");
 }
 
-QString GerberGenerator::calcOutputMd5Checksum() const noexcept
+void GerberGenerator::write(QIODevice& device, QCryptographicHash& md5,
+                            const QByteArray& data) const throw (Exception)
 {
     // according to the RS-274C standard, linebreaks are not included in the checksum
-    QString data = QString(mOutput).remove(QChar('\n'));
-    return QString(QCryptographicHash::hash(data.toUtf8(), QCryptographicHash::Md5).toHex());
+    int start = 0;
+    for (int end = data.indexOf('\n'); end >= 0; end = data.indexOf('\n', start)) {
+        md5.addData(data.constData() + start, end - start);
+        start = end + 1;
+    }
+    md5.addData(data.constData() + start, data.size() - start);
+
+    if (device.write(data) != data.size()) {
+        throw RuntimeError(__FILE__, __LINE__, QString(), QString(tr("Could not write "
+            "Gerber data: %1")).arg(device.errorString()));
+    }
 }
 
 /*****************************************************************************************
  *  Static Methods
  ****************************************************************************************/
 
+QByteArray GerberGenerator::coordinatesToByteArray(const Point& pos) noexcept
+{
+    return "X" % QByteArray::number(pos.getX().toNm()) %
+           "Y" % QByteArray::number(pos.getY().toNm());
+}
+
 QString GerberGenerator::escapeString(const QString& str) noexcept
 {
     // perform compatibility decomposition (NFKD)
@@ -45,6 +45,14 @@ class GerberApertureList;
 /**
  * @brief The GerberGenerator class
  *
+ * The plot methods append the Gerber records of the layer body to a byte buffer. If this
+ * buffer becomes large (e.g. for copper layers with many fills), it is spilled to a
+ * temporary file, so the memory usage does not grow with the size of the layer. As the
+ * aperture list must be printed before the body but is only known after all plot methods
+ * were called, the file is written in a second pass with #generateToFile() (or
+ * #generate(QIODevice&)), which streams header, aperture list, body and footer directly
+ * to the output device and calculates the MD5 checksum on the fly.
+ *
  * @todo Remove/Escape illegal characters in #mProjectId and #mProjectRevision!
  * @todo Use file/aperture attributes
  *
@@ -70,7 +78,7 @@ class GerberGenerator final
         ~GerberGenerator() noexcept;
 
         // Getters
-        const QString& toStr() const noexcept {return mOutput;}
+        QString toStr() const noexcept {return QString::fromUtf8(mOutput);}
 
         // Plot Methods
         void setLayerPolarity(LayerPolarity p) noexcept;
@@ -86,7 +94,34 @@ class GerberGenerator final
 
         // General Methods
         void reset() noexcept;
+
+        /**
+         * @brief Generate the whole Gerber file in memory (see #toStr() and #saveToFile())
+         *
+         * @throw Exception If the layer body could not be read back
+         */
         void generate() throw (Exception);
+
+        /**
+         * @brief Stream the whole Gerber file to an (opened) device
+         *
+         * @param device    The device to write to
+         *
+         * @throw Exception If reading the layer body or writing to the device failed
+         */
+        void generate(QIODevice& device) throw (Exception);
+
+        /**
+         * @brief Stream the whole Gerber file directly into a file
+         *
+         * In contrast to #generate() followed by #saveToFile(), the output is never held
+         * completely in memory. The file is replaced atomically.
+         *
+         * @param filepath  The file to write (will be overwritten if it exists already)
+         *
+         * @throw Exception If an error occurs
+         */
+        void generateToFile(const FilePath& filepath) throw (Exception);
         void saveToFile(const FilePath& filepath) const throw (Exception);
 
         // Operator Overloadings
@@ -96,6 +131,7 @@ class GerberGenerator final
     private:
 
         // Private Methods
+        void appendContent(const QByteArray& data) noexcept;
         void setCurrentAperture(int number) noexcept;
         void setRegionModeOn() noexcept;
         void setRegionModeOff() noexcept;
@@ -108,13 +144,15 @@ class GerberGenerator final
         void linearInterpolateToPosition(const Point& pos) noexcept;
         void circularInterpolateToPosition(const Point& start, const Point& center, const Point& end) noexcept;
         void flashAtPosition(const Point& pos) noexcept;
-        void printHeader() noexcept;
-        void printApertureList() noexcept;
-        void printContent() noexcept;
-        void printFooter() noexcept;
-        QString calcOutputMd5Checksum() const noexcept;
+        void printHeader(QIODevice& device, QCryptographicHash& md5) const throw (Exception);
+        void printApertureList(QIODevice& device, QCryptographicHash& md5) const throw (Exception);
+        void printContent(QIODevice& device, QCryptographicHash& md5) throw (Exception);
+        void printFooter(QIODevice& device, QCryptographicHash& md5) const throw (Exception);
+        void write(QIODevice& device, QCryptographicHash& md5, const QByteArray& data) const throw (Exception);
 
         // Static Methods
+        static QByteArray coordinatesToByteArray(const Point& pos) noexcept;
+
         static QString escapeString(const QString& str) noexcept;
 
 
@@ -124,11 +162,16 @@ class GerberGenerator final
         QString mProjectRevision;
 
         // Gerber Data
-        QString mOutput;
-        QString mContent;
+        QByteArray mOutput;
+        QByteArray mContent;    ///< not yet spilled part of the layer body
+        QScopedPointer<QTemporaryFile> mContentSpoolFile;   ///< spilled part of the body
+        QString mContentSpoolError; ///< set if spilling the body failed (reported later)
         QScopedPointer<GerberApertureList> mApertureList;
         int mCurrentApertureNumber;
         bool mMultiQuadrantArcModeOn;
+
+        /// If the body buffer grows beyond this size, it is spilled to #mContentSpoolFile
+        static constexpr int sMaxContentBufferSize = 1024 * 1024;
 };
 
 /*****************************************************************************************
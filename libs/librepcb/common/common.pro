@@ -30,6 +30,8 @@ DEFINES += INSTALLATION_PREFIX="\\\"$${PREFIX}\\\""
 #DEFINES += USE_32BIT_LENGTH_UNITS          # see units/length.h
 
 HEADERS += \
+    algorithm/airwiresbuilder.h \
+    algorithm/delaunaytriangulation.h \
     alignment.h \
     application.h \
     attributes/attributetype.h \
@@ -54,6 +56,7 @@ HEADERS += \
     fileio/fileutils.h \
     fileio/if_xmlserializableobject.h \
     fileio/smartfile.h \
+    fileio/smartfilesnapshot.h \
     fileio/smarttextfile.h \
     fileio/smartversionfile.h \
     fileio/smartxmlfile.h \
@@ -79,6 +82,7 @@ HEADERS += \
     schematiclayer.h \
     scopeguard.h \
     scopeguardlist.h \
+    spatialindex.h \
     sqlitedatabase.h \
     systeminfo.h \
     undocommand.h \
@@ -93,6 +97,8 @@ HEADERS += \
     version.h \
 
 SOURCES += \
+    algorithm/airwiresbuilder.cpp \
+    algorithm/delaunaytriangulation.cpp \
     alignment.cpp \
     application.cpp \
     attributes/attributetype.cpp \
@@ -116,6 +122,7 @@ SOURCES += \
     fileio/filepath.cpp \
     fileio/fileutils.cpp \
     fileio/smartfile.cpp \
+    fileio/smartfilesnapshot.cpp \
     fileio/smarttextfile.cpp \
     fileio/smartversionfile.cpp \
     fileio/smartxmlfile.cpp \
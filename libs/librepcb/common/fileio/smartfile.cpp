@@ -22,6 +22,7 @@
  ****************************************************************************************/
 #include <QtCore>
 #include "smartfile.h"
+#include "smartfilesnapshot.h"
 #include "fileutils.h"
 
 /*****************************************************************************************
@@ -36,7 +37,8 @@ namespace librepcb {
 SmartFile::SmartFile(const FilePath& filepath, bool restore, bool readOnly, bool create) throw (Exception) :
     mFilePath(filepath), mTmpFilePath(filepath.toStr() % '~'),
     mOpenedFilePath(filepath), mIsRestored(restore), mIsReadOnly(readOnly),
-    mIsCreated(create)
+    mIsCreated(create), mRevision((create || restore) ? 1 : 0), mSavedRevision(0),
+    mTmpSavedRevision(0)
 {
     if (create)
     {
@@ -92,6 +94,22 @@ void SmartFile::removeFile(bool original) throw (Exception)
     if (filepath.isExistingFile()) {
         FileUtils::removeFile(filepath);
     }
+    if (original) {
+        mSavedRevision = mRevision;
+    } else {
+        mTmpSavedRevision = mRevision;
+    }
+}
+
+void SmartFile::backupSnapshotWritten(const SmartFileSnapshot& snapshot) noexcept
+{
+    Q_ASSERT(&snapshot.getFile() == this);
+    Q_ASSERT(snapshot.getFilePath() == mTmpFilePath);
+
+    // a newer revision could have been saved synchronously in the meantime
+    if (snapshot.getRevision() > mTmpSavedRevision) {
+        mTmpSavedRevision = snapshot.getRevision();
+    }
 }
 
 /*****************************************************************************************
@@ -114,6 +132,12 @@ void SmartFile::updateMembersAfterSaving(bool toOriginal) noexcept
 
     if (toOriginal && mIsCreated)
         mIsCreated = false;
+
+    if (toOriginal) {
+        mSavedRevision = mRevision;
+    } else {
+        mTmpSavedRevision = mRevision;
+    }
 }
 
 /*****************************************************************************************
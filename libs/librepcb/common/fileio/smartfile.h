@@ -32,6 +32,8 @@
  ****************************************************************************************/
 namespace librepcb {
 
+class SmartFileSnapshot;
+
 /*****************************************************************************************
  *  Class SmartFile
  ****************************************************************************************/
@@ -125,6 +127,37 @@ class SmartFile
          */
         bool isCreated() const noexcept {return mIsCreated;}
 
+        /**
+         * @brief Check if the content was modified since the file was saved the last time
+         *
+         * Created and restored files are always considered as modified until they are
+         * saved the first time.
+         *
+         * @param original  Specifies whether the state of the original or the backup
+         *                  file should be returned.
+         *
+         * @return true if the file needs to be saved, false if it is up to date
+         *
+         * @see #setModified()
+         */
+        bool isModified(bool original) const noexcept {
+            return mRevision != (original ? mSavedRevision : mTmpSavedRevision);
+        }
+
+
+        // Setters
+
+        /**
+         * @brief Mark the content of the file as modified
+         *
+         * This needs to be called by the owner of the file every time the content which
+         * would be written to the file has changed (for example when executing an undo
+         * command), otherwise the next save will skip this file.
+         *
+         * @see #isModified()
+         */
+        void setModified() noexcept {++mRevision;}
+
 
         // General Methods
 
@@ -137,6 +170,17 @@ class SmartFile
          */
         void removeFile(bool original) throw (Exception);
 
+        /**
+         * @brief Update the modification state after a snapshot was written
+         *
+         * Must be called after a snapshot created by this file was written successfully
+         * to the backup file. If the content was modified since the snapshot was
+         * created, the file is still considered as modified.
+         *
+         * @param snapshot  The snapshot which was written (see SmartFileSnapshot#write())
+         */
+        void backupSnapshotWritten(const SmartFileSnapshot& snapshot) noexcept;
+
 
         // Operator Overloadings
         SmartFile& operator=(const SmartFile& rhs) = delete;
@@ -167,7 +211,8 @@ class SmartFile
         const FilePath& prepareSaveAndReturnFilePath(bool toOriginal) throw (Exception);
 
         /**
-         * @brief Update the member variables #mIsRestored and #mIsCreated after saving
+         * @brief Update the member variables #mIsRestored, #mIsCreated and the saved
+         *        revision after saving
          *
          * @note This method must be called from all subclasses AFTER saving the changes
          *       to the file!
@@ -176,6 +221,13 @@ class SmartFile
          */
         void updateMembersAfterSaving(bool toOriginal) noexcept;
 
+        /**
+         * @brief Get the current revision of the content (see #setModified())
+         *
+         * @return The revision to be passed to created snapshots
+         */
+        quint32 getRevision() const noexcept {return mRevision;}
+
 
         // General Attributes
 
@@ -221,6 +273,21 @@ class SmartFile
          */
         bool mIsCreated;
 
+        /**
+         * @brief Counter which is incremented by #setModified()
+         */
+        quint32 mRevision;
+
+        /**
+         * @brief The value of #mRevision when the original file was saved the last time
+         */
+        quint32 mSavedRevision;
+
+        /**
+         * @brief The value of #mRevision when the backup file was saved the last time
+         */
+        quint32 mTmpSavedRevision;
+
 };
 
 /*****************************************************************************************
@@ -0,0 +1,72 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include "smartfilesnapshot.h"
+#include "fileutils.h"
+#include "xmldomdocument.h"
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+SmartFileSnapshot::SmartFileSnapshot(SmartFile& file, const FilePath& filepath,
+                                     quint32 revision,
+                                     const QSharedPointer<const XmlDomDocument>& document) noexcept :
+    mFile(&file), mFilePath(filepath), mRevision(revision), mDocument(document), mContent()
+{
+    Q_ASSERT(mDocument);
+}
+
+SmartFileSnapshot::SmartFileSnapshot(SmartFile& file, const FilePath& filepath,
+                                     quint32 revision, const QByteArray& content) noexcept :
+    mFile(&file), mFilePath(filepath), mRevision(revision), mDocument(), mContent(content)
+{
+}
+
+SmartFileSnapshot::~SmartFileSnapshot() noexcept
+{
+}
+
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+void SmartFileSnapshot::write() const throw (Exception)
+{
+    if (mDocument) {
+        FileUtils::writeFile(mFilePath, mDocument->toByteArray()); // can throw
+    } else {
+        FileUtils::writeFile(mFilePath, mContent); // can throw
+    }
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace librepcb
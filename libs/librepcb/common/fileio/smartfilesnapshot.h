@@ -0,0 +1,125 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_SMARTFILESNAPSHOT_H
+#define LIBREPCB_SMARTFILESNAPSHOT_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include "../exceptions.h"
+#include "filepath.h"
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+
+class SmartFile;
+class XmlDomDocument;
+
+/*****************************************************************************************
+ *  Class SmartFileSnapshot
+ ****************************************************************************************/
+
+/**
+ * @brief The SmartFileSnapshot class holds the content of a #SmartFile at a specific
+ *        revision to write it to the backup file later
+ *
+ * Snapshots are created on the thread which owns the #SmartFile (e.g. with
+ * SmartXmlFile#createBackupSnapshot()). They do not reference any other objects than
+ * the file itself, so #write() may be called from any thread, even while the owner of
+ * the file continues modifying its content. Afterwards, the owner of the file has to
+ * call SmartFile#backupSnapshotWritten() to update the modification state of the file.
+ *
+ * @warning The #SmartFile object must outlive all of its snapshots.
+ *
+ * @note See @ref doc_project_save for more details about the backup/restore feature.
+ */
+class SmartFileSnapshot final
+{
+    public:
+
+        // Constructors / Destructor
+        SmartFileSnapshot() = delete;
+        SmartFileSnapshot(const SmartFileSnapshot& other) = default;
+
+        /**
+         * @brief Constructor for snapshots of XML files
+         *
+         * @param file          The file which has created the snapshot
+         * @param filepath      The filepath to write the content to
+         * @param revision      The revision of the file content (see SmartFile#setModified())
+         * @param document      The DOM tree to write (will not be modified anymore)
+         */
+        SmartFileSnapshot(SmartFile& file, const FilePath& filepath, quint32 revision,
+                          const QSharedPointer<const XmlDomDocument>& document) noexcept;
+
+        /**
+         * @brief Constructor for snapshots of files with a raw content
+         *
+         * @param file          The file which has created the snapshot
+         * @param filepath      The filepath to write the content to
+         * @param revision      The revision of the file content (see SmartFile#setModified())
+         * @param content       The content to write
+         */
+        SmartFileSnapshot(SmartFile& file, const FilePath& filepath, quint32 revision,
+                          const QByteArray& content) noexcept;
+
+        ~SmartFileSnapshot() noexcept;
+
+
+        // Getters
+        SmartFile& getFile() const noexcept {return *mFile;}
+        const FilePath& getFilePath() const noexcept {return mFilePath;}
+        quint32 getRevision() const noexcept {return mRevision;}
+
+
+        // General Methods
+
+        /**
+         * @brief Generate the file content and write it to the file system
+         *
+         * @note This method is thread-safe, it only accesses the snapshot itself.
+         *
+         * @throw Exception If an error occurs
+         */
+        void write() const throw (Exception);
+
+
+        // Operator Overloadings
+        SmartFileSnapshot& operator=(const SmartFileSnapshot& rhs) = default;
+
+
+    private: // Data
+        SmartFile* mFile;
+        FilePath mFilePath;
+        quint32 mRevision;
+        QSharedPointer<const XmlDomDocument> mDocument; ///< nullptr for raw content
+        QByteArray mContent;
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace librepcb
+
+#endif // LIBREPCB_SMARTFILESNAPSHOT_H
@@ -71,6 +71,17 @@ void SmartVersionFile::save(bool toOriginal) throw (Exception)
     }
 }
 
+SmartFileSnapshot SmartVersionFile::createBackupSnapshot() throw (Exception)
+{
+    if (mVersion.isValid()) {
+        const FilePath& filepath = prepareSaveAndReturnFilePath(false); // can throw
+        return SmartFileSnapshot(*this, filepath, getRevision(),
+                                 QString("%1\n").arg(mVersion.toStr()).toUtf8());
+    } else {
+        throw LogicError(__FILE__, __LINE__, mVersion.toStr(), tr("Invalid version number"));
+    }
+}
+
 /*****************************************************************************************
  *  Static Methods
  ****************************************************************************************/
@@ -25,6 +25,7 @@
  ****************************************************************************************/
 #include <QtCore>
 #include "smartfile.h"
+#include "smartfilesnapshot.h"
 #include "../version.h"
 
 /*****************************************************************************************
@@ -109,6 +110,15 @@ class SmartVersionFile final : public SmartFile
          */
         void save(bool toOriginal) throw (Exception);
 
+        /**
+         * @brief Create a snapshot to write the version to the backup file later
+         *
+         * @return The snapshot to write (e.g. in a worker thread)
+         *
+         * @throw Exception If an error occurs
+         */
+        SmartFileSnapshot createBackupSnapshot() throw (Exception);
+
 
         // Operator Overloadings
         SmartVersionFile& operator=(const SmartVersionFile& rhs) = delete;
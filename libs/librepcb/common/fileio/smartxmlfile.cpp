@@ -61,6 +61,13 @@ void SmartXmlFile::save(const XmlDomDocument& domDocument, bool toOriginal) thro
     updateMembersAfterSaving(toOriginal);
 }
 
+SmartFileSnapshot SmartXmlFile::createBackupSnapshot(
+    const QSharedPointer<const XmlDomDocument>& domDocument) throw (Exception)
+{
+    const FilePath& filepath = prepareSaveAndReturnFilePath(false); // can throw
+    return SmartFileSnapshot(*this, filepath, getRevision(), domDocument);
+}
+
 /*****************************************************************************************
  *  Static Methods
  ****************************************************************************************/
@@ -25,6 +25,7 @@
  ****************************************************************************************/
 #include <QtCore>
 #include "smartfile.h"
+#include "smartfilesnapshot.h"
 
 /*****************************************************************************************
  *  Namespace / Forward Declarations
@@ -102,6 +103,18 @@ class SmartXmlFile final : public SmartFile
          */
         void save(const XmlDomDocument& domDocument, bool toOriginal) throw (Exception);
 
+        /**
+         * @brief Create a snapshot to write the XML DOM tree to the backup file later
+         *
+         * @param domDocument   The DOM document to save (must not be modified anymore)
+         *
+         * @return The snapshot to write (e.g. in a worker thread)
+         *
+         * @throw Exception If an error occurs
+         */
+        SmartFileSnapshot createBackupSnapshot(
+            const QSharedPointer<const XmlDomDocument>& domDocument) throw (Exception);
+
 
         // Operator Overloadings
         SmartXmlFile& operator=(const SmartXmlFile& rhs) = delete;
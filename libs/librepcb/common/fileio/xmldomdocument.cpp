@@ -42,14 +42,20 @@ XmlDomDocument::XmlDomDocument(XmlDomElement& root) noexcept :
 XmlDomDocument::XmlDomDocument(const QByteArray& xmlFileContent, const FilePath& filepath) throw (Exception) :
     mFilePath(filepath), mRootElement(nullptr)
 {
-    QDomDocument doc;
-    doc.implementation().setInvalidDataPolicy(QDomImplementation::ReturnNullNode);
+    QXmlStreamReader reader(xmlFileContent);
+    if (reader.readNextStartElement()) {
+        mRootElement.reset(XmlDomElement::fromXmlStreamReader(reader, this));
+        while (!reader.atEnd()) {
+            reader.readNext(); // check the rest of the file for errors
+        }
+    }
 
-    QString errMsg;
-    int errLine;
-    int errColumn;
-    if (!doc.setContent(xmlFileContent, &errMsg, &errLine, &errColumn)) {
-        QString line = xmlFileContent.split('\n').at(errLine-1);
+    if (reader.hasError()) {
+        mRootElement.reset();
+        QString errMsg = reader.errorString();
+        int errLine = reader.lineNumber();
+        int errColumn = reader.columnNumber();
+        QString line = xmlFileContent.split('\n').value(errLine-1);
         throw RuntimeError(__FILE__, __LINE__, QString("%1: %2 [%3:%4] LINE:%5")
             .arg(filepath.toStr(), errMsg).arg(errLine).arg(errColumn).arg(line),
             QString(tr("Error while parsing XML in file \"%1\": %2 [%3:%4]"))
@@ -57,13 +63,10 @@ XmlDomDocument::XmlDomDocument(const QByteArray& xmlFileContent, const FilePath&
     }
 
     // check if the root node exists
-    QDomElement root = doc.documentElement();
-    if (root.isNull()) {
+    if (!mRootElement) {
         throw RuntimeError(__FILE__, __LINE__, QString(),
             QString(tr("No XML root node found in \"%1\"!")).arg(mFilePath.toNative()));
     }
-
-    mRootElement.reset(XmlDomElement::fromQDomElement(root, this));
 }
 
 XmlDomDocument::~XmlDomDocument() noexcept
@@ -91,11 +94,14 @@ XmlDomElement& XmlDomDocument::getRoot(const QString& expectedName) const throw
 
 QByteArray XmlDomDocument::toByteArray() const noexcept
 {
-    QDomDocument doc;
-    doc.implementation().setInvalidDataPolicy(QDomImplementation::ReturnNullNode);
-    doc.setContent(QString("<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\"?>"));
-    doc.appendChild(mRootElement->toQDomElement(doc));
-    return doc.toByteArray(1); // indent only 1 space to save disk space
+    QByteArray data;
+    QXmlStreamWriter writer(&data);
+    writer.setAutoFormatting(true);
+    writer.setAutoFormattingIndent(1); // indent only 1 space to save disk space
+    writer.writeStartDocument("1.0", true);
+    mRootElement->writeToXmlStreamWriter(writer);
+    writer.writeEndDocument();
+    return data;
 }
 
 /*****************************************************************************************
@@ -24,7 +24,6 @@
  *  Includes
  ****************************************************************************************/
 #include <QtCore>
-#include <QDomDocument>
 #include "../exceptions.h"
 #include "filepath.h"
 
@@ -42,7 +41,9 @@ class XmlDomElement;
 /**
  * @brief The XmlDomDocument class represents a XML DOM document with the whole DOM tree
  *
- * @todo Use libxml2 instead of Qt's DOM classes
+ * The XML file is parsed with a QXmlStreamReader and written with a QXmlStreamWriter
+ * directly from/to the #XmlDomElement tree, so no intermediate QDomDocument is built.
+ *
  * @todo Use XSD schema files to validate the opened XML file (with libxml2)
  * @todo Save the DOM document as canonical XML to file (with libxml2 c14n)
  *
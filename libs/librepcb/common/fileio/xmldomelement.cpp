@@ -22,6 +22,7 @@
  ****************************************************************************************/
 #include <QtCore>
 #include <QtWidgets>
+#include <type_traits>
 #include "xmldomelement.h"
 #include "xmldomdocument.h"
 #include "../units/all_length_units.h"
@@ -34,6 +35,87 @@
  ****************************************************************************************/
 namespace librepcb {
 
+/*****************************************************************************************
+ *  Class XmlDomElement::NameTable
+ ****************************************************************************************/
+
+/**
+ * @brief Shares the tag and attribute names of a parsed document
+ *
+ * The same few names are repeated in every element of a file, so all elements store a
+ * (implicitly shared) copy of the same QString instead of allocating a new string each.
+ */
+class XmlDomElement::NameTable final
+{
+    public:
+        const QString& intern(const QStringRef& name) noexcept
+        {
+            uint hash = qHash(name);
+            QMultiHash<uint, QString>::const_iterator it = mNames.constFind(hash);
+            while ((it != mNames.constEnd()) && (it.key() == hash)) {
+                if (it.value() == name) return it.value();
+                ++it;
+            }
+            return mNames.insert(hash, name.toString()).value();
+        }
+
+    private:
+        QMultiHash<uint, QString> mNames;
+};
+
+/*****************************************************************************************
+ *  Element Memory Pool
+ ****************************************************************************************/
+
+namespace {
+
+class XmlDomElementPool final
+{
+    public:
+        void* allocate()
+        {
+            QMutexLocker locker(&mMutex);
+            if (!mFreeBlocks) {
+                Block* chunk = new Block[sChunkSize]; // can throw std::bad_alloc
+                for (int i = 0; i < sChunkSize; ++i) {
+                    chunk[i].next = mFreeBlocks;
+                    mFreeBlocks = &chunk[i];
+                }
+            }
+            Block* block = mFreeBlocks;
+            mFreeBlocks = block->next;
+            return block;
+        }
+
+        void free(void* ptr) noexcept
+        {
+            QMutexLocker locker(&mMutex);
+            Block* block = static_cast<Block*>(ptr);
+            block->next = mFreeBlocks;
+            mFreeBlocks = block;
+        }
+
+        static XmlDomElementPool& instance() noexcept
+        {
+            // intentionally never destroyed, elements may outlive static objects
+            static XmlDomElementPool* pool = new XmlDomElementPool();
+            return *pool;
+        }
+
+    private:
+        union Block {
+            Block* next;
+            std::aligned_storage<sizeof(XmlDomElement),
+                                 alignof(XmlDomElement)>::type storage;
+        };
+        static constexpr int sChunkSize = 512;
+
+        QMutex mMutex;
+        Block* mFreeBlocks = nullptr;
+};
+
+} // namespace
+
 /*****************************************************************************************
  *  Constructors / Destructor
  ****************************************************************************************/
@@ -44,34 +126,60 @@ XmlDomElement::XmlDomElement(const QString& name, const QString& text) noexcept
     Q_ASSERT(isValidXmlTagName(mName) == true);
 }
 
-XmlDomElement::XmlDomElement(QDomElement domElement, XmlDomElement* parent, XmlDomDocument* doc) noexcept :
-    mDocument(doc), mParent(parent), mName(domElement.tagName()), mText()
+XmlDomElement::XmlDomElement(QXmlStreamReader& reader, NameTable& names,
+                             XmlDomElement* parent, XmlDomDocument* doc) noexcept :
+    mDocument(doc), mParent(parent), mName(names.intern(reader.name())), mText()
 {
+    Q_ASSERT(reader.isStartElement());
     Q_ASSERT(isValidXmlTagName(mName) == true);
 
-    QDomNamedNodeMap map = domElement.attributes();
-    for (int i = 0; i < map.count(); i++)
-        mAttributes.insert(map.item(i).nodeName(), map.item(i).nodeValue());
+    QXmlStreamAttributes attributes = reader.attributes();
+    mAttributes.reserve(attributes.count());
+    foreach (const QXmlStreamAttribute& attribute, attributes)
+        mAttributes.append(Attribute(names.intern(attribute.name()), attribute.value().toString()));
 
-    QDomElement child = domElement.firstChildElement();
-    while (!child.isNull())
+    // text is only kept for leaf elements (including whitespace-only values), text
+    // between child elements is only indentation
+    QString text;
+    while (!reader.atEnd())
     {
-        mChilds.append(new XmlDomElement(child, this));
-        child = child.nextSiblingElement();
+        QXmlStreamReader::TokenType token = reader.readNext();
+        if (token == QXmlStreamReader::StartElement)
+            mChilds.append(new XmlDomElement(reader, names, this));
+        else if ((token == QXmlStreamReader::Characters) && (mChilds.isEmpty()))
+            text.append(reader.text());
+        else if ((token == QXmlStreamReader::EndElement) || (token == QXmlStreamReader::Invalid))
+            break;
     }
 
     if (mChilds.isEmpty())
-        mText = domElement.text();
+        mText = text;
 }
 
 XmlDomElement::~XmlDomElement() noexcept
 {
-    qDeleteAll(mChilds);        mChilds.clear();
+    foreach (XmlDomElement* child, mChilds) {
+        child->mParent = nullptr; // avoid removing each child from the list one by one
+        delete child;
+    }
+    mChilds.clear();
 
     if (mParent)
         mParent->removeChild(this, false);
 }
 
+void* XmlDomElement::operator new(std::size_t size)
+{
+    Q_ASSERT(size == sizeof(XmlDomElement)); // the class is final
+    Q_UNUSED(size);
+    return XmlDomElementPool::instance().allocate();
+}
+
+void XmlDomElement::operator delete(void* ptr) noexcept
+{
+    if (ptr) XmlDomElementPool::instance().free(ptr);
+}
+
 /*****************************************************************************************
  *  General Methods
  ****************************************************************************************/
@@ -314,7 +422,11 @@ LengthUnit XmlDomElement::getText<LengthUnit>(bool throwIfEmpty, const LengthUni
 template <>
 void XmlDomElement::setAttribute(const QString& name, const QString& value) noexcept
 {
-    mAttributes.insert(name, value);
+    int index = indexOfAttribute(name);
+    if (index >= 0)
+        mAttributes[index].second = value;
+    else
+        mAttributes.append(Attribute(name, value));
 }
 
 template <>
@@ -391,7 +503,7 @@ void XmlDomElement::setAttribute(const QString& name, const VAlign& value) noexc
 
 bool XmlDomElement::hasAttribute(const QString& name) const noexcept
 {
-    return mAttributes.contains(name);
+    return (indexOfAttribute(name) >= 0);
 }
 
 template <>
@@ -400,17 +512,19 @@ QString XmlDomElement::getAttribute<QString>(const QString& name, bool throwIfEm
     Q_UNUSED(defaultValue);
     Q_ASSERT(defaultValue == QString()); // defaultValue makes no sense in this method
 
-    if (!mAttributes.contains(name))
+    int index = indexOfAttribute(name);
+    if (index < 0)
     {
         throw FileParseError(__FILE__, __LINE__, getDocFilePath(), -1, -1, QString(),
             QString(tr("Attribute \"%1\" not found in node \"%2\".")).arg(name, mName));
     }
-    if (mAttributes.value(name).isEmpty() && throwIfEmpty)
+    const QString& value = mAttributes.at(index).second;
+    if (value.isEmpty() && throwIfEmpty)
     {
         throw FileParseError(__FILE__, __LINE__, getDocFilePath(), -1, -1, QString(),
             QString(tr("Attribute \"%1\" in node \"%2\" must not be empty.")).arg(name, mName));
     }
-    return mAttributes.value(name);
+    return value;
 }
 
 template <>
@@ -823,41 +937,49 @@ XmlDomElement* XmlDomElement::getNextSibling(const QString& name, bool throwIfNo
 }
 
 /*****************************************************************************************
- *  QDomElement Converter Methods
+ *  XML Stream Converter Methods
  ****************************************************************************************/
 
-QDomElement XmlDomElement::toQDomElement(QDomDocument& domDocument) const noexcept
+void XmlDomElement::writeToXmlStreamWriter(QXmlStreamWriter& writer) const noexcept
 {
-    QDomElement element = domDocument.createElement(mName);
+    writer.writeStartElement(mName);
+
+    foreach (const Attribute& attribute, mAttributes)
+        writer.writeAttribute(attribute.first, attribute.second);
 
     if (hasChilds())
     {
         foreach (XmlDomElement* child, mChilds)
-            element.appendChild(child->toQDomElement(domDocument));
+            child->writeToXmlStreamWriter(writer);
     }
     else if (!mText.isNull())
     {
-        QDomText textNode = domDocument.createTextNode(mText);
-        element.appendChild(textNode);
+        writer.writeCharacters(mText);
     }
 
-    foreach (const QString& key, mAttributes.keys())
-    {
-        element.setAttribute(key, mAttributes.value(key));
-    }
-
-    return element;
+    writer.writeEndElement();
 }
 
-XmlDomElement* XmlDomElement::fromQDomElement(QDomElement domElement, XmlDomDocument* doc) noexcept
+XmlDomElement* XmlDomElement::fromXmlStreamReader(QXmlStreamReader& reader,
+                                                  XmlDomDocument* doc) noexcept
 {
-    return new XmlDomElement(domElement, nullptr, doc);
+    NameTable names;
+    return new XmlDomElement(reader, names, nullptr, doc);
 }
 
 /*****************************************************************************************
  *  Private Methods
  ****************************************************************************************/
 
+int XmlDomElement::indexOfAttribute(const QString& name) const noexcept
+{
+    // elements have only a few attributes, a linear search is faster than hashing
+    for (int i = 0; i < mAttributes.count(); ++i) {
+        if (mAttributes.at(i).first == name) return i;
+    }
+    return -1;
+}
+
 bool XmlDomElement::isValidXmlTagName(const QString& name) noexcept
 {
     bool valid = !name.isEmpty();
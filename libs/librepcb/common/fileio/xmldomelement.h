@@ -24,7 +24,6 @@
  *  Includes
  ****************************************************************************************/
 #include <QtCore>
-#include <QDomElement>
 #include "../exceptions.h"
 #include "filepath.h"
 
@@ -84,6 +83,16 @@ class XmlDomElement final
          */
         ~XmlDomElement() noexcept;
 
+        /**
+         * @brief Allocate memory for an element from a shared memory pool
+         *
+         * Large documents consist of a huge number of elements, so they are allocated in
+         * chunks instead of one by one. Freed elements are reused by later allocations,
+         * the memory itself is never returned to the operating system.
+         */
+        static void* operator new(std::size_t size);
+        static void operator delete(void* ptr) noexcept;
+
 
         // General Methods
 
@@ -415,31 +424,40 @@ class XmlDomElement final
                                       bool throwIfNotFound = false) const throw (Exception);
 
 
-        // QDomElement Converter Methods
+        // XML Stream Converter Methods
 
         /**
-         * @brief Construct a QDomElement object from this XmlDomElement (recursively)
+         * @brief Write this XmlDomElement (recursively) to a QXmlStreamWriter
          *
-         * @param domDocument   The DOM Document of the newly created QDomElement
-         *
-         * @return The created QDomElement (which is added to the specified DOM document)
+         * @param writer    The XML stream writer to write the element to
          */
-        QDomElement toQDomElement(QDomDocument& domDocument) const noexcept;
+        void writeToXmlStreamWriter(QXmlStreamWriter& writer) const noexcept;
 
         /**
-         * @brief Construct a XmlDomElement object from a QDomElement object (recursively)
+         * @brief Construct a XmlDomElement object from a QXmlStreamReader (recursively)
+         *
+         * The reader must be positioned at the start element to read. After returning,
+         * it is positioned at the corresponding end element (or at the first error).
          *
-         * @param domElement    The QDomElement to copy
+         * @param reader        The XML stream reader to read from
          * @param doc           The DOM Document of the newly created XmlDomElement (only
          *                      needed for the root element)
          *
          * @return The created XmlDomElement (the caller takes the ownership!)
+         *
+         * @note Errors are not reported by this method, the caller has to check
+         *       QXmlStreamReader#hasError() afterwards.
          */
-        static XmlDomElement* fromQDomElement(QDomElement domElement, XmlDomDocument* doc = nullptr) noexcept;
+        static XmlDomElement* fromXmlStreamReader(QXmlStreamReader& reader,
+                                                  XmlDomDocument* doc = nullptr) noexcept;
 
 
     private:
 
+        // Types
+        class NameTable;
+        typedef QPair<QString, QString> Attribute; ///< name and value of an attribute
+
         // make some methods inaccessible...
         XmlDomElement() = delete;
         XmlDomElement(const XmlDomElement& other) = delete;
@@ -449,16 +467,27 @@ class XmlDomElement final
         // Private Methods
 
         /**
-         * @brief Private constructor to create a XmlDomElement from a QDomElement
+         * @brief Private constructor to create a XmlDomElement from a QXmlStreamReader
          *
-         * @param domElement    The QDomElement to copy
+         * @param reader        The XML stream reader, positioned at the start element
+         * @param names         The table used to share the tag and attribute names
          * @param parent        The parent of the newly created XmlDomElement
          * @param doc           The DOM Document of the newly created XmlDomElement (only
          *                      needed for the root element)
          */
-        explicit XmlDomElement(QDomElement domElement, XmlDomElement* parent = nullptr,
+        explicit XmlDomElement(QXmlStreamReader& reader, NameTable& names,
+                               XmlDomElement* parent = nullptr,
                                XmlDomDocument* doc = nullptr) noexcept;
 
+        /**
+         * @brief Get the index of an attribute in #mAttributes
+         *
+         * @param name  The attribute name
+         *
+         * @return The index of the attribute, or -1 if it does not exist
+         */
+        int indexOfAttribute(const QString& name) const noexcept;
+
         /**
          * @brief Check if a QString represents a valid XML tag name for elements and attributes
          *
@@ -481,7 +510,7 @@ class XmlDomElement final
         QString mName;              ///< the tag name of this element
         QString mText;              ///< the text of this element (only if there are no childs)
         QList<XmlDomElement*> mChilds;      ///< all child elements (only if there is no text)
-        QHash<QString, QString> mAttributes;///< all attributes of this element (key, value) in arbitrary order
+        QVector<Attribute> mAttributes;     ///< all attributes of this element in insertion order
 };
 
 /*****************************************************************************************
@@ -0,0 +1,247 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_SPATIALINDEX_H
+#define LIBREPCB_SPATIALINDEX_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <functional>
+#include <algorithm>
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+
+/*****************************************************************************************
+ *  Class SpatialIndex
+ ****************************************************************************************/
+
+/**
+ * @brief Uniform grid index to find items by a (scene) position
+ *
+ * Each item is stored in all grid cells touched by its bounding rectangle, so a position
+ * query only needs to look at the items of a single cell. Items which would cover too
+ * many cells (e.g. very long lines) are kept in a separate list which is always checked.
+ *
+ * Bounding rectangles are obtained from the function passed to the constructor, but only
+ * lazily: #insert() and #invalidate() just mark the item as dirty, the rectangle is
+ * (re)calculated by the next query. This keeps moving many items at once (e.g. dragging
+ * a footprint with all its pads and traces) cheap.
+ *
+ * @note The index only returns candidates whose bounding rectangle contains the queried
+ *       position, the caller has to do the exact hit test.
+ *
+ * @note Items with a null bounding rectangle (zero width and zero height) are never
+ *       returned by #getItemsAt(), just like QRectF::contains() never matches them. Items
+ *       which should be found at a single position need a bounding rectangle with a
+ *       non-zero size (e.g. their grab area).
+ */
+template <typename T>
+class SpatialIndex final
+{
+    public:
+
+        // Types
+        typedef std::function<QRectF(const T&)> BoundingRectFunction;
+
+        // Constructors / Destructor
+        SpatialIndex() = delete;
+        SpatialIndex(const SpatialIndex& other) = delete;
+        SpatialIndex(qreal cellSize, BoundingRectFunction boundingRect) noexcept :
+            mCellSize(cellSize), mBoundingRect(boundingRect), mNextOrder(0)
+        {
+            Q_ASSERT(mCellSize > 0);
+        }
+        ~SpatialIndex() noexcept = default;
+
+        // Getters
+        int count() const noexcept {return mEntries.count();}
+        bool contains(T* item) const noexcept {return mEntries.contains(item);}
+
+        // General Methods
+
+        /**
+         * @brief Add an item (does nothing if it is already contained)
+         */
+        void insert(T* item) noexcept
+        {
+            Q_ASSERT(item);
+            if (mEntries.contains(item)) return;
+            Entry entry;
+            entry.order = mNextOrder++;
+            entry.isLarge = false;
+            mEntries.insert(item, entry);
+            mDirtyItems.insert(item);
+        }
+
+        /**
+         * @brief Remove an item (does nothing if it is not contained)
+         */
+        void remove(T* item) noexcept
+        {
+            auto it = mEntries.find(item);
+            if (it == mEntries.end()) return;
+            if (!mDirtyItems.remove(item)) {
+                removeFromCells(item, *it);
+            }
+            mEntries.erase(it);
+        }
+
+        /**
+         * @brief Notify the index that the bounding rectangle of an item has changed
+         *
+         * Items which are not contained in the index are ignored, so it's safe to call
+         * this from setters of items which are not (yet) added.
+         */
+        void invalidate(T* item) noexcept
+        {
+            auto it = mEntries.find(item);
+            if ((it != mEntries.end()) && (!mDirtyItems.contains(item))) {
+                removeFromCells(item, *it);
+                mDirtyItems.insert(item);
+            }
+        }
+
+        void clear() noexcept
+        {
+            mEntries.clear();
+            mCells.clear();
+            mLargeItems.clear();
+            mDirtyItems.clear();
+        }
+
+        /**
+         * @brief Get all items whose bounding rectangle contains a position
+         *
+         * @param pos   The position (in the same coordinate system as the rectangles)
+         *
+         * @return The matching items in the order they were inserted
+         */
+        QList<T*> getItemsAt(const QPointF& pos) const noexcept
+        {
+            update();
+            QList<T*> candidates;
+            foreach (T* item, mCells.value(getCellKey(getCellX(pos.x()), getCellY(pos.y())))) {
+                if (mEntries.value(item).rect.contains(pos)) candidates.append(item);
+            }
+            foreach (T* item, mLargeItems) {
+                if (mEntries.value(item).rect.contains(pos)) candidates.append(item);
+            }
+            std::sort(candidates.begin(), candidates.end(), [this](T* a, T* b) {
+                return mEntries.value(a).order < mEntries.value(b).order;
+            });
+            return candidates;
+        }
+
+        // Operator Overloadings
+        SpatialIndex& operator=(const SpatialIndex& rhs) = delete;
+
+
+    private: // Types
+
+        struct Entry {
+            QRectF rect;    ///< bounding rectangle (valid if the item is not dirty)
+            QRect cells;    ///< covered cells (valid if the item is not dirty and not large)
+            quint64 order;  ///< insertion counter, used to return items in a stable order
+            bool isLarge;   ///< true if the item is stored in #mLargeItems
+        };
+
+
+    private: // Methods
+
+        void update() const noexcept
+        {
+            foreach (T* item, mDirtyItems) {
+                Entry& entry = mEntries[item];
+                entry.rect = mBoundingRect(*item);
+                entry.cells = QRect(QPoint(getCellX(entry.rect.left()), getCellY(entry.rect.top())),
+                                    QPoint(getCellX(entry.rect.right()), getCellY(entry.rect.bottom())));
+                entry.isLarge = (qint64(entry.cells.width()) * entry.cells.height() > sMaxCellsPerItem);
+                if (entry.rect.isNull()) {
+                    // never matches any position, no need to store it in any cell
+                } else if (entry.isLarge) {
+                    mLargeItems.append(item);
+                } else {
+                    for (int x = entry.cells.left(); x <= entry.cells.right(); ++x) {
+                        for (int y = entry.cells.top(); y <= entry.cells.bottom(); ++y) {
+                            mCells[getCellKey(x, y)].append(item);
+                        }
+                    }
+                }
+            }
+            mDirtyItems.clear();
+        }
+
+        void removeFromCells(T* item, const Entry& entry) const noexcept
+        {
+            if (entry.rect.isNull()) {
+                // item is not stored in any cell
+            } else if (entry.isLarge) {
+                mLargeItems.removeOne(item);
+            } else {
+                for (int x = entry.cells.left(); x <= entry.cells.right(); ++x) {
+                    for (int y = entry.cells.top(); y <= entry.cells.bottom(); ++y) {
+                        auto it = mCells.find(getCellKey(x, y));
+                        if (it == mCells.end()) continue;
+                        it->removeOne(item);
+                        if (it->isEmpty()) mCells.erase(it);
+                    }
+                }
+            }
+        }
+
+        int getCellX(qreal x) const noexcept {return qFloor(qBound(-sMaxCell, x / mCellSize, sMaxCell));}
+        int getCellY(qreal y) const noexcept {return qFloor(qBound(-sMaxCell, y / mCellSize, sMaxCell));}
+        static quint64 getCellKey(int x, int y) noexcept {
+            return (quint64(quint32(x)) << 32) | quint64(quint32(y));
+        }
+
+
+    private: // Data
+
+        static constexpr int sMaxCellsPerItem = 256; ///< larger items go to #mLargeItems
+        static constexpr qreal sMaxCell = 1e8; ///< avoids integer overflows (the grid is sparse)
+
+        qreal mCellSize;
+        BoundingRectFunction mBoundingRect;
+        quint64 mNextOrder;
+        mutable QHash<T*, Entry> mEntries;
+        mutable QHash<quint64, QVector<T*>> mCells;     ///< key: see #getCellKey()
+        mutable QList<T*> mLargeItems;
+        mutable QSet<T*> mDirtyItems;
+};
+
+// Out-of-class definitions of the static members, needed in C++11 because they are
+// ODR-used (e.g. passed by reference to qBound())
+template <typename T>
+constexpr int SpatialIndex<T>::sMaxCellsPerItem;
+template <typename T>
+constexpr qreal SpatialIndex<T>::sMaxCell;
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace librepcb
+
+#endif // LIBREPCB_SPATIALINDEX_H
@@ -56,6 +56,30 @@ SQLiteDatabase::TransactionScopeGuard::~TransactionScopeGuard() noexcept
     }
 }
 
+/*****************************************************************************************
+ *  Class FastRebuildScopeGuard
+ ****************************************************************************************/
+
+SQLiteDatabase::FastRebuildScopeGuard::FastRebuildScopeGuard(SQLiteDatabase& db) throw (Exception) :
+    mDb(db)
+{
+    mSynchronous = mDb.getPragma("synchronous"); // can throw
+    mTempStore = mDb.getPragma("temp_store"); // can throw
+    mDb.exec("PRAGMA journal_mode = WAL"); // can throw
+    mDb.exec("PRAGMA synchronous = OFF"); // can throw
+    mDb.exec("PRAGMA temp_store = MEMORY"); // can throw
+}
+
+SQLiteDatabase::FastRebuildScopeGuard::~FastRebuildScopeGuard() noexcept
+{
+    try {
+        mDb.exec(QString("PRAGMA synchronous = %1").arg(mSynchronous.toInt())); // can throw
+        mDb.exec(QString("PRAGMA temp_store = %1").arg(mTempStore.toInt())); // can throw
+    } catch (Exception& e) {
+        qCritical() << "Could not restore database settings:" << e.getUserMsg();
+    }
+}
+
 /*****************************************************************************************
  *  Constructors / Destructor
  ****************************************************************************************/
@@ -90,6 +114,7 @@ SQLiteDatabase::SQLiteDatabase(const FilePath& filepath) throw (Exception) :
 
 SQLiteDatabase::~SQLiteDatabase() noexcept
 {
+    mPreparedQueries.clear(); // all queries must be released before closing the database
     mDb.close();
 }
 
@@ -148,14 +173,25 @@ void SQLiteDatabase::clearTable(const QString& table) throw (Exception)
  *  General Methods
  ****************************************************************************************/
 
-QSqlQuery SQLiteDatabase::prepareQuery(const QString& query) const throw (Exception)
+QSqlQuery SQLiteDatabase::prepareQuery(const QString& query, bool cached) const throw (Exception)
 {
+    if (cached) {
+        auto it = mPreparedQueries.find(query);
+        if (it != mPreparedQueries.end()) {
+            it->finish(); // release the result of the last execution
+            return *it;
+        }
+    }
+
     QSqlQuery q(mDb);
     if (!q.prepare(query)) {
         throw RuntimeError(__FILE__, __LINE__, QString("%1: %2, %3").arg(query,
             q.lastError().databaseText(), q.lastError().driverText()),
             QString(tr("Error while preparing SQL query: %1")).arg(query));
     }
+    if (cached) {
+        mPreparedQueries.insert(query, q);
+    }
     return q;
 }
 
@@ -188,6 +224,26 @@ void SQLiteDatabase::exec(const QString& query) throw (Exception)
     exec(q);
 }
 
+void SQLiteDatabase::execBatch(QSqlQuery& query) throw (Exception)
+{
+    if (!query.execBatch()) {
+        throw RuntimeError(__FILE__, __LINE__, QString("%1: %2, %3").arg(query.lastQuery(),
+            query.lastError().databaseText(), query.lastError().driverText()),
+            QString(tr("Error while executing SQL query: %1")).arg(query.lastQuery()));
+    }
+}
+
+QVariant SQLiteDatabase::getPragma(const QString& name) throw (Exception)
+{
+    QSqlQuery q(mDb);
+    if ((!q.exec("PRAGMA " % name)) || (!q.next())) {
+        throw RuntimeError(__FILE__, __LINE__, QString("%1: %2, %3").arg(name,
+            q.lastError().databaseText(), q.lastError().driverText()),
+            QString(tr("Could not read database setting: %1")).arg(name));
+    }
+    return q.value(0);
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
@@ -64,6 +64,34 @@ class SQLiteDatabase final : public QObject
                 bool mIsCommited;
         };
 
+        /**
+         * @brief Speed up rebuilding large parts of the database
+         *
+         * While an object of this class exists, SQLite does not wait for data to be
+         * written to disk ("PRAGMA synchronous = OFF"), and temporary tables are kept in
+         * memory. The previous settings are restored in the destructor. In addition, the
+         * database is switched to write-ahead logging ("PRAGMA journal_mode = WAL"), which
+         * is not restored since it is persistent and allows other connections to read
+         * the database while it is being written.
+         *
+         * @warning A crash while this guard is active may corrupt the database, so use it
+         *          only for data which can be rebuilt at any time (e.g. caches). The
+         *          guard must be created outside of a transaction.
+         */
+        class FastRebuildScopeGuard final
+        {
+            public:
+                FastRebuildScopeGuard() = delete;
+                FastRebuildScopeGuard(const FastRebuildScopeGuard& other) = delete;
+                FastRebuildScopeGuard(SQLiteDatabase& db) throw (Exception);
+                ~FastRebuildScopeGuard() noexcept;
+                FastRebuildScopeGuard& operator=(const FastRebuildScopeGuard& rhs) = delete;
+            private:
+                SQLiteDatabase& mDb;
+                QVariant mSynchronous;
+                QVariant mTempStore;
+        };
+
 
         // Constructors / Destructor
         SQLiteDatabase() = delete;
@@ -80,11 +108,50 @@ class SQLiteDatabase final : public QObject
 
 
         // General Methods
-        QSqlQuery prepareQuery(const QString& query) const throw (Exception);
+
+        /**
+         * @brief Get a prepared query for the passed SQL string
+         *
+         * Prepared queries are cached per connection, so calling this method multiple
+         * times with the same SQL string does not prepare the statement again. All
+         * returned copies of a cached query share the same statement, thus its values
+         * must be bound again before executing it.
+         *
+         * @note A cached statement is only reset when it is requested again, so call
+         *       QSqlQuery::finish() as soon as the result is read. Otherwise the
+         *       statement stays active and keeps a read transaction open, which blocks
+         *       other connections from writing to the database.
+         *
+         * @warning Do not use two queries with the same SQL string at the same time
+         *          (e.g. iterating over the result of one while executing the other).
+         *          Pass "cached = false" in such cases.
+         *
+         * @param query     The SQL string
+         * @param cached    If false, a new (uncached) query is prepared
+         *
+         * @return The prepared query
+         *
+         * @throw Exception If the query could not be prepared
+         */
+        QSqlQuery prepareQuery(const QString& query, bool cached = true) const throw (Exception);
         int insert(QSqlQuery& query) throw (Exception);
         void exec(QSqlQuery& query) throw (Exception);
         void exec(const QString& query) throw (Exception);
 
+        /**
+         * @brief Execute a query once for each row of the bound value lists
+         *
+         * All placeholders of the query must be bound to a QVariantList of the same
+         * length (see QSqlQuery::execBatch()). Executing many rows with one prepared
+         * statement is much faster than executing the query for each row separately.
+         *
+         * @param query     The prepared query with QVariantList values bound
+         *
+         * @throw Exception If the query failed for any row
+         */
+        void execBatch(QSqlQuery& query) throw (Exception);
+        QVariant getPragma(const QString& name) throw (Exception);
+
 
         // Operator Overloadings
         SQLiteDatabase& operator=(const SQLiteDatabase& rhs) = delete;
@@ -93,6 +160,7 @@ class SQLiteDatabase final : public QObject
     private: // Data
 
         QSqlDatabase mDb;
+        mutable QHash<QString, QSqlQuery> mPreparedQueries; ///< key: SQL string
         //int mNestedTransactionCount;
 };
 
@@ -79,6 +79,18 @@ void UndoCommand::redo() throw (Exception)
     mRedoCount++;
 }
 
+qint64 UndoCommand::getApproxMemoryUsage() const noexcept
+{
+    // the derived class is unknown, so assume a few members in addition to the text
+    return sizeof(UndoCommand) + 64 + mText.capacity() * sizeof(QChar);
+}
+
+bool UndoCommand::mergeWith(const UndoCommand& other) noexcept
+{
+    Q_UNUSED(other);
+    return false;
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
@@ -81,6 +81,22 @@ class UndoCommand
          */
         bool isCurrentlyExecuted() const noexcept {return mRedoCount > mUndoCount;}
 
+        /**
+         * @brief Get the approximate amount of memory used by this command (in bytes)
+         *
+         * Used by the #UndoStack to limit its memory usage. The default implementation
+         * returns the size of a typical small command. Commands which hold a lot of
+         * memory (e.g. child commands) should override this method. Only count memory
+         * which is released when the command gets deleted, otherwise evicting the
+         * command from the stack would not reduce the memory usage at all.
+         *
+         * @note The #UndoStack keeps a running total of these values, so the returned
+         *       value must not change while the command is on the stack, except by
+         *       #mergeWith() or UndoCommandGroup#appendChild(). In particular, it must
+         *       not depend on whether the command is currently executed or not.
+         */
+        virtual qint64 getApproxMemoryUsage() const noexcept;
+
 
         // General Methods
 
@@ -102,6 +118,24 @@ class UndoCommand
          */
         virtual void redo() throw (Exception) final;
 
+        /**
+         * @brief Try to merge a newer command into this command
+         *
+         * This is called by UndoStack#execCmd() after @p other was executed on top of
+         * this command, to combine consecutive commands of the same kind (for example
+         * repeated edits of the same object) into a single undo step. If the merge is
+         * possible, this command must take over the new state of @p other, so that
+         * #undo() reverts both commands and #redo() re-applies both of them.
+         * Afterwards, @p other is deleted without being reverted.
+         *
+         * @param other     The newer command (currently executed, like this command)
+         *
+         * @retval true     If @p other was merged into this command
+         * @retval false    If the commands cannot be merged (this command must not have
+         *                  been modified then). This is the default implementation.
+         */
+        virtual bool mergeWith(const UndoCommand& other) noexcept;
+
         // Operator Overloadings
         UndoCommand& operator=(const UndoCommand& rhs) = delete;
 
@@ -46,6 +46,19 @@ UndoCommandGroup::~UndoCommandGroup() noexcept
     }
 }
 
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+qint64 UndoCommandGroup::getApproxMemoryUsage() const noexcept
+{
+    qint64 usage = UndoCommand::getApproxMemoryUsage() + mChilds.count() * sizeof(void*);
+    foreach (const UndoCommand* cmd, mChilds) {
+        usage += cmd->getApproxMemoryUsage();
+    }
+    return usage;
+}
+
 /*****************************************************************************************
  *  General Methods
  ****************************************************************************************/
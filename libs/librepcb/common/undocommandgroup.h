@@ -57,6 +57,9 @@ class UndoCommandGroup : public UndoCommand
         // Getters
         int getChildCount() const noexcept {return mChilds.count();}
 
+        /// @copydoc UndoCommand::getApproxMemoryUsage()
+        virtual qint64 getApproxMemoryUsage() const noexcept override;
+
         // General Methods
 
         /**
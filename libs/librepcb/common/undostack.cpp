@@ -36,7 +36,8 @@ namespace librepcb {
  ****************************************************************************************/
 
 UndoStack::UndoStack() noexcept :
-    QObject(nullptr), mCurrentIndex(0), mCleanIndex(0), mActiveCommandGroup(nullptr)
+    QObject(nullptr), mCurrentIndex(0), mCleanIndex(0), mActiveCommandGroup(nullptr),
+    mUndoLimit(0), mMemoryLimit(0), mMemoryUsage(0)
 {
 }
 
@@ -85,6 +86,11 @@ bool UndoStack::isCommandGroupActive() const noexcept
     return (mActiveCommandGroup != nullptr);
 }
 
+qint64 UndoStack::getApproxMemoryUsage() const noexcept
+{
+    return mMemoryUsage;
+}
+
 /*****************************************************************************************
  *  Setters
  ****************************************************************************************/
@@ -98,6 +104,18 @@ void UndoStack::setClean() noexcept
     emit cleanChanged(true);
 }
 
+void UndoStack::setUndoLimit(int limit) noexcept
+{
+    mUndoLimit = qMax(limit, 0);
+    enforceLimits();
+}
+
+void UndoStack::setMemoryLimit(qint64 bytes) noexcept
+{
+    mMemoryLimit = qMax(bytes, qint64(0));
+    enforceLimits();
+}
+
 /*****************************************************************************************
  *  General Methods
  ****************************************************************************************/
@@ -123,13 +141,30 @@ void UndoStack::execCmd(UndoCommand* cmd, bool forceKeepCmd) throw (Exception)
         // delete all commands above the current index (make redoing them impossible)
         // --> in reverse order (from top to bottom)!
         while (mCurrentIndex < mCommands.count()) {
-            delete mCommands.takeLast();
+            UndoCommand* redoCmd = mCommands.takeLast();
+            mMemoryUsage -= redoCmd->getApproxMemoryUsage();
+            delete redoCmd;
         }
         Q_ASSERT(mCurrentIndex == mCommands.count());
 
+        qint64 topUsage = (mCurrentIndex > 0) ? mCommands.last()->getApproxMemoryUsage() : 0;
+        if ((!forceKeepCmd) && (mCurrentIndex > 0) && (mCleanIndex != mCurrentIndex) &&
+            (mCommands.last()->mergeWith(*cmd)))
+        {
+            // the command was merged into the top command, so it's no longer needed
+            mMemoryUsage += mCommands.last()->getApproxMemoryUsage() - topUsage;
+            enforceLimits();
+            emit undoTextChanged(getUndoText());
+            emit redoTextChanged(tr("Redo"));
+            emit canRedoChanged(false);
+            return; // "cmd" gets deleted by the scope guard
+        }
+
         // add command to the command stack and emit signals
         mCommands.append(cmdScopeGuard.take()); // move ownership of "cmd" to "mCommands"
         mCurrentIndex++;
+        mMemoryUsage += cmd->getApproxMemoryUsage();
+        enforceLimits();
 
         // emit signals
         emit undoTextChanged(QString(tr("Undo: %1")).arg(cmd->getText()));
@@ -172,7 +207,9 @@ void UndoStack::appendToCmdGroup(UndoCommand* cmd) throw (Exception)
 
     // append new command as a child of active command group
     // note: this will also execute the new command!
+    qint64 groupUsage = mActiveCommandGroup->getApproxMemoryUsage();
     mActiveCommandGroup->appendChild(cmdScopeGuard.take()); // can throw
+    mMemoryUsage += mActiveCommandGroup->getApproxMemoryUsage() - groupUsage;
 }
 
 void UndoStack::commitCmdGroup() throw (Exception)
@@ -192,6 +229,7 @@ void UndoStack::commitCmdGroup() throw (Exception)
     // To finish the active command group, we only need to reset the pointer to the
     // currently active command group
     mActiveCommandGroup = nullptr;
+    enforceLimits(); // the group has probably grown since it was pushed
 
     // emit signals
     emit canUndoChanged(canUndo());
@@ -211,6 +249,7 @@ void UndoStack::abortCmdGroup() throw (Exception)
         mActiveCommandGroup->undo(); // can throw (but should usually not)
         mActiveCommandGroup = nullptr;
         mCurrentIndex--;
+        mMemoryUsage -= mCommands.last()->getApproxMemoryUsage();
         delete mCommands.takeLast(); // delete and remove the aborted command group from the stack
     } catch (Exception& e) {
         qCritical() << "UndoCommand::undo() has thrown an exception:" << e.getUserMsg();
@@ -292,6 +331,7 @@ void UndoStack::clear() noexcept
     mCurrentIndex = 0;
     mCleanIndex = 0;
     mActiveCommandGroup = nullptr;
+    mMemoryUsage = 0;
 
     // emit signals
     emit undoTextChanged(tr("Undo"));
@@ -301,6 +341,29 @@ void UndoStack::clear() noexcept
     emit cleanChanged(true);
 }
 
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+void UndoStack::enforceLimits() noexcept
+{
+    // the newest command is always kept (it may also be the active command group)
+    while ((mCommands.count() > 1) && (mCurrentIndex > 1) &&
+           (((mUndoLimit > 0) && (mCommands.count() > mUndoLimit)) ||
+            ((mMemoryLimit > 0) && (mMemoryUsage > mMemoryLimit))))
+    {
+        // delete the oldest command (it is currently executed, so it doesn't own any
+        // objects which are still used by newer commands)
+        UndoCommand* cmd = mCommands.takeFirst();
+        mMemoryUsage -= cmd->getApproxMemoryUsage();
+        delete cmd;
+        mCurrentIndex--;
+
+        // the clean state is no longer reachable if it was the state before that command
+        mCleanIndex = (mCleanIndex > 0) ? (mCleanIndex - 1) : -1;
+    }
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
@@ -132,6 +132,22 @@ class UndoStack final : public QObject
          */
         bool isCommandGroupActive() const noexcept;
 
+        /**
+         * @brief Get the count of commands in the stack (both undoable and redoable)
+         *
+         * @return Count of commands
+         */
+        int getCommandCount() const noexcept {return mCommands.count();}
+
+        /**
+         * @brief Get the approximate amount of memory used by all commands of the stack
+         *
+         * @return The sum of UndoCommand#getApproxMemoryUsage() of all commands in bytes
+         *
+         * @see #setMemoryLimit()
+         */
+        qint64 getApproxMemoryUsage() const noexcept;
+
 
         // Setters
 
@@ -140,6 +156,28 @@ class UndoStack final : public QObject
          */
         void setClean() noexcept;
 
+        /**
+         * @brief Set the maximum count of commands in the stack (similar to
+         *        QUndoStack#setUndoLimit())
+         *
+         * If a new command is pushed and the limit is exceeded, the oldest commands are
+         * deleted. Undoing them is no longer possible then. The newest command is always
+         * kept, independent of the limits.
+         *
+         * @param limit     The maximum count of commands (0 = unlimited, default)
+         */
+        void setUndoLimit(int limit) noexcept;
+
+        /**
+         * @brief Set the maximum approximate memory usage of all commands in the stack
+         *
+         * Works like #setUndoLimit(), but limits #getApproxMemoryUsage() instead of the
+         * count of commands.
+         *
+         * @param bytes     The maximum memory usage in bytes (0 = unlimited, default)
+         */
+        void setMemoryLimit(qint64 bytes) noexcept;
+
 
         // General Methods
 
@@ -160,6 +198,10 @@ class UndoStack final : public QObject
          *
          * @note If you try to execute a command with that method while another command is
          *       active (see #isCommandActive()), this method will throw an exception.
+         *
+         * @note If the command on top of the stack accepts to merge the executed command
+         *       (see UndoCommand#mergeWith()), no new command is pushed. This is never
+         *       done if the stack is clean, to keep the clean state reachable.
          */
         void execCmd(UndoCommand* cmd, bool forceKeepCmd = false) throw (Exception);
 
@@ -250,6 +292,11 @@ class UndoStack final : public QObject
 
     private:
 
+        /**
+         * @brief Delete the oldest commands until #mUndoLimit and #mMemoryLimit are met
+         */
+        void enforceLimits() noexcept;
+
         /**
          * @brief This list holds all commands of the undo stack
          *
@@ -279,6 +326,18 @@ class UndoStack final : public QObject
          * or #abortCmdGroup(). Otherwise, the variable contains the nullptr.
          */
         UndoCommandGroup* mActiveCommandGroup;
+
+        int mUndoLimit;         ///< see #setUndoLimit()
+        qint64 mMemoryLimit;    ///< see #setMemoryLimit()
+
+        /**
+         * @brief Running total of UndoCommand#getApproxMemoryUsage() of all commands
+         *
+         * Updated whenever a command is added, removed, merged or (for the active
+         * command group) extended, so #enforceLimits() doesn't need to iterate over the
+         * whole stack.
+         */
+        qint64 mMemoryUsage;
 };
 
 /*****************************************************************************************
@@ -29,6 +29,115 @@
  ****************************************************************************************/
 namespace librepcb {
 
+/*****************************************************************************************
+ *  Local Helpers
+ ****************************************************************************************/
+
+namespace {
+
+inline uint charCode(char c) noexcept {return static_cast<uchar>(c);}
+inline uint charCode(QChar c) noexcept {return c.unicode();}
+
+inline bool isDigit(uint c) noexcept {return (c >= '0') && (c <= '9');}
+inline bool isSpace(uint c) noexcept {return (c == ' ') || ((c >= '\t') && (c <= '\r'));}
+
+/**
+ * @brief Parse a decimal number in millimeters to nanometers, without using floats
+ *
+ * Accepts "[whitespace][+|-]digits[.digits][(e|E)[+|-]digits][whitespace]". The digits
+ * are never accumulated as a whole, only the ones which contribute to the integer value
+ * in nanometers (plus one digit for rounding), so there is no precision loss at all.
+ */
+template <typename T>
+bool parseMmToNm(const T* begin, const T* end, LengthBase_t& nanometers) noexcept
+{
+    while ((begin < end) && isSpace(charCode(*begin))) ++begin;
+    while ((end > begin) && isSpace(charCode(*(end - 1)))) --end;
+
+    bool negative = false;
+    if ((begin < end) && ((charCode(*begin) == '-') || (charCode(*begin) == '+'))) {
+        negative = (charCode(*begin) == '-');
+        ++begin;
+    }
+
+    const T* intBegin = begin;
+    while ((begin < end) && isDigit(charCode(*begin))) ++begin;
+    const T* intEnd = begin;
+    const T* fracBegin = begin;
+    const T* fracEnd = begin;
+    if ((begin < end) && (charCode(*begin) == '.')) {
+        fracBegin = ++begin;
+        while ((begin < end) && isDigit(charCode(*begin))) ++begin;
+        fracEnd = begin;
+    }
+    if ((intBegin == intEnd) && (fracBegin == fracEnd)) return false; // no digits
+
+    int exponent = 0;
+    if ((begin < end) && ((charCode(*begin) == 'e') || (charCode(*begin) == 'E'))) {
+        ++begin;
+        bool negativeExponent = false;
+        if ((begin < end) && ((charCode(*begin) == '-') || (charCode(*begin) == '+'))) {
+            negativeExponent = (charCode(*begin) == '-');
+            ++begin;
+        }
+        if ((begin == end) || (!isDigit(charCode(*begin)))) return false;
+        while ((begin < end) && isDigit(charCode(*begin))) {
+            // larger exponents are either zero or out of range anyway
+            exponent = qMin(exponent * 10 + int(charCode(*begin) - '0'), 1000);
+            ++begin;
+        }
+        if (negativeExponent) exponent = -exponent;
+    }
+    if (begin != end) return false; // trailing garbage
+
+    // the first "intDigits + exponent + 6" digits form the value in nanometers
+    const int intDigits = intEnd - intBegin;
+    const int totalDigits = intDigits + (fracEnd - fracBegin);
+    auto digitAt = [&](int index) -> uint {
+        if ((index < 0) || (index >= totalDigits)) return 0;
+        const T* c = (index < intDigits) ? (intBegin + index) : (fracBegin + index - intDigits);
+        return charCode(*c) - '0';
+    };
+    const quint64 limit = negative ? quint64(std::numeric_limits<LengthBase_t>::max()) + 1
+                                   : quint64(std::numeric_limits<LengthBase_t>::max());
+    const int valueDigits = intDigits + exponent + 6;
+    quint64 value = 0;
+    for (int i = 0; i < valueDigits; ++i) {
+        uint digit = digitAt(i);
+        if (value > (limit - digit) / 10) return false; // overflow
+        value = value * 10 + digit;
+    }
+    if (digitAt(valueDigits) >= 5) {
+        if (value >= limit) return false; // overflow
+        ++value;
+    }
+
+    if (negative && (value > 0)) {
+        nanometers = -LengthBase_t(value - 1) - 1; // avoid overflow for the minimum value
+    } else {
+        nanometers = LengthBase_t(value);
+    }
+    return true;
+}
+
+} // namespace
+
+/*****************************************************************************************
+ *  Conversions
+ ****************************************************************************************/
+
+QString Length::toNmString() const noexcept
+{
+    char buffer[sMaxCharCount];
+    return QString::fromLatin1(buffer, toNmChars(buffer));
+}
+
+QString Length::toMmString() const noexcept
+{
+    char buffer[sMaxCharCount];
+    return QString::fromLatin1(buffer, toMmChars(buffer));
+}
+
 /*****************************************************************************************
  *  General Methods
  ****************************************************************************************/
@@ -88,6 +197,12 @@ Length Length::fromMm(const QString& millimeters, const Length& gridInterval) th
     return l.mapToGrid(gridInterval);
 }
 
+Length Length::fromMm(const char* millimeters, int size, const Length& gridInterval) throw (Exception)
+{
+    Length l(mmStringToNm(millimeters, size));
+    return l.mapToGrid(gridInterval);
+}
+
 Length Length::fromInch(qreal inches, const Length& gridInterval) throw (RangeError)
 {
     Length l;
@@ -141,9 +256,9 @@ LengthBase_t Length::mapNmToGrid(LengthBase_t nanometers, const Length& gridInte
 
 LengthBase_t Length::mmStringToNm(const QString& millimeters) throw (Exception)
 {
-    bool ok;
-    qreal nm = qRound(QLocale::c().toDouble(millimeters, &ok) * 1e6);
-    if (!ok)
+    LengthBase_t nm;
+    const QChar* data = millimeters.constData();
+    if (!parseMmToNm(data, data + millimeters.length(), nm))
     {
         throw Exception(__FILE__, __LINE__, millimeters,
             QString(tr("Invalid length string: \"%1\"")).arg(millimeters));
@@ -151,6 +266,40 @@ LengthBase_t Length::mmStringToNm(const QString& millimeters) throw (Exception)
     return nm;
 }
 
+LengthBase_t Length::mmStringToNm(const char* millimeters, int size) throw (Exception)
+{
+    LengthBase_t nm;
+    if (!parseMmToNm(millimeters, millimeters + size, nm))
+    {
+        QString str = QString::fromUtf8(millimeters, size);
+        throw Exception(__FILE__, __LINE__, str,
+            QString(tr("Invalid length string: \"%1\"")).arg(str));
+    }
+    return nm;
+}
+
+int Length::nmToChars(LengthBase_t nanometers, int decimals, char* buffer) noexcept
+{
+    // use the unsigned magnitude to handle the minimum value correctly
+    quint64 magnitude = (nanometers < 0) ? (quint64(0) - quint64(nanometers))
+                                         : quint64(nanometers);
+    char digits[sMaxCharCount]; // in reverse order
+    int count = 0;
+    do {
+        digits[count++] = '0' + (magnitude % 10);
+        magnitude /= 10;
+    } while ((magnitude > 0) || (count <= decimals));
+
+    char* out = buffer;
+    if (nanometers < 0) *out++ = '-';
+    for (int i = count - 1; i >= decimals; --i) *out++ = digits[i];
+    if (decimals > 0) {
+        *out++ = '.';
+        for (int i = decimals - 1; i >= 0; --i) *out++ = digits[i];
+    }
+    return out - buffer;
+}
+
 /*****************************************************************************************
  *  Non-Member Functions
  ****************************************************************************************/
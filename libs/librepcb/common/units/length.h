@@ -80,6 +80,10 @@ class Length
 
     public:
 
+        // Constants
+        static constexpr int sMaxCharCount = 21; ///< max. length of #toNmChars(), #toMmChars()
+
+
         //  Constructors / Destructor
 
         /**
@@ -206,7 +210,19 @@ class Length
          *
          * @return The length in nanometers as a QString. The used locale is always "C".
          */
-        QString toNmString() const noexcept {return QString::number(toNm());}
+        QString toNmString() const noexcept;
+
+        /**
+         * @brief Write the length in nanometers into a character buffer
+         *
+         * @param buffer    A buffer with space for at least #sMaxCharCount characters. The
+         *                  string will not be null-terminated.
+         *
+         * @return The count of characters written to the buffer
+         *
+         * @see #toNmString()
+         */
+        int toNmChars(char* buffer) const noexcept {return nmToChars(mNanometers, 0, buffer);}
 
         /**
          * @brief Get the length in millimeters
@@ -225,11 +241,21 @@ class Length
          * @note This method is useful to store lengths in XML files. The problem with
          * decreased precision does NOT exist by using this method!
          *
-         * @todo don't use double for this purpose!
-         *
          * @see #setLengthMm(const QString&), #fromMm(const QString&, const Length&)
          */
-        QString toMmString() const noexcept {return QLocale::c().toString(toMm(), 'f', 6);}
+        QString toMmString() const noexcept;
+
+        /**
+         * @brief Write the length in millimeters into a character buffer
+         *
+         * Same format as #toMmString() (always six decimals), but without any allocation.
+         *
+         * @param buffer    A buffer with space for at least #sMaxCharCount characters. The
+         *                  string will not be null-terminated.
+         *
+         * @return The count of characters written to the buffer
+         */
+        int toMmChars(char* buffer) const noexcept {return nmToChars(mNanometers, 6, buffer);}
 
         /**
          * @brief Get the length in inches
@@ -378,6 +404,24 @@ class Length
          */
         static Length fromMm(const QString& millimeters, const Length& gridInterval = Length(0)) throw (Exception);
 
+        /**
+         * @brief Get a Length object from a Latin-1 (or UTF-8) encoded string in millimeters
+         *
+         * Same as #fromMm(const QString&, const Length&), but parses the characters
+         * directly from a byte buffer (e.g. from a file), without converting it to a QString.
+         *
+         * @param millimeters   Pointer to the first character (needs not to be null-terminated)
+         * @param size          The count of characters
+         * @param gridInterval  See mapToGrid()
+         *
+         * @return A new Length object with a length which is mapped to the specified grid
+         *
+         * @throw Exception     If the argument is invalid or out of range, an Exception
+         *                      will be thrown
+         */
+        static Length fromMm(const char* millimeters, int size,
+                             const Length& gridInterval = Length(0)) throw (Exception);
+
         /**
          * @brief Get a Length object with a specific length and map it to a specific grid
          *
@@ -503,17 +547,36 @@ class Length
          *
          * This is a helper function for Length(const QString&) and setLengthMm().
          *
+         * The conversion is done with integer arithmetic only, so it is exact for the whole
+         * range of #LengthBase_t. Decimals after the sixth one are rounded (half away from
+         * zero). Leading/trailing whitespace and an exponent (e.g. "1.5e-3") are accepted.
+         *
          * @param millimeters   A QString which contains a floating point number with maximum
          *                      six decimals after the decimal point. The locale of the string
          *                      have to be "C"! Example: QString("-1234.56") for -1234.56mm
          *
          * @return The length in nanometers
          *
-         * @todo    don't use double for this purpose!
-         *          and throw an exception if a range error occurs (under-/overflow)!
+         * @throw Exception     If the string is invalid or the value is out of range
          */
         static LengthBase_t mmStringToNm(const QString& millimeters) throw (Exception);
 
+        /// @copydoc mmStringToNm(const QString&)
+        static LengthBase_t mmStringToNm(const char* millimeters, int size) throw (Exception);
+
+        /**
+         * @brief Format a length in nanometers with a fixed count of decimals
+         *
+         * This is a helper function for #toNmChars() and #toMmChars().
+         *
+         * @param nanometers    The length to format
+         * @param decimals      0 for nanometers, 6 for millimeters
+         * @param buffer        Output buffer with space for at least #sMaxCharCount chars
+         *
+         * @return The count of characters written to the buffer
+         */
+        static int nmToChars(LengthBase_t nanometers, int decimals, char* buffer) noexcept;
+
 
         // Private Member Variables
         LengthBase_t mNanometers;  ///< the length in nanometers
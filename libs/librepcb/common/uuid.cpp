@@ -29,65 +29,56 @@
 namespace librepcb {
 
 /*****************************************************************************************
- *  Setters
+ *  Getters
  ****************************************************************************************/
 
-bool Uuid::setUuid(const QString& uuid) noexcept
+QString Uuid::toStr() const noexcept
 {
-    mUuid = QString(); // make UUID invalid
-    QString lowercaseUuid = uuid.toLower();
-    if (lowercaseUuid.length() != 36)       return false; // do NOT accept '{' and '}'
-    QUuid quuid(lowercaseUuid);
-    if (quuid.isNull())                     return false;
-    if (quuid.variant() != QUuid::DCE)      return false;
-    if (quuid.version() != QUuid::Random)   return false;
-    mUuid = lowercaseUuid;
-    return true;
+    if (isNull()) return QString();
+
+    static const char hexDigits[] = "0123456789abcdef";
+    QString str(36, Qt::Uninitialized);
+    QChar* out = str.data();
+    for (int i = 0; i < 16; ++i) {
+        if ((i == 4) || (i == 6) || (i == 8) || (i == 10)) {
+            *out++ = QLatin1Char('-');
+        }
+        quint64 part = (i < 8) ? mHigh : mLow;
+        uint byte = (part >> (56 - 8 * (i % 8))) & 0xFF;
+        *out++ = QLatin1Char(hexDigits[byte >> 4]);
+        *out++ = QLatin1Char(hexDigits[byte & 0x0F]);
+    }
+    return str;
 }
 
 /*****************************************************************************************
- *  Operators
+ *  Setters
  ****************************************************************************************/
 
-Uuid& Uuid::operator=(const Uuid& rhs) noexcept
-{
-    mUuid = rhs.mUuid;
-    return *this;
-}
-
-bool Uuid::operator==(const Uuid& rhs) const noexcept
-{
-    if (mUuid.isEmpty() || rhs.mUuid.isEmpty()) return false;
-    return (mUuid == rhs.mUuid);
-}
-
-bool Uuid::operator!=(const Uuid& rhs) const noexcept
-{
-    return !(*this == rhs);
-}
-
-bool Uuid::operator<(const Uuid& rhs) const noexcept
-{
-    if (mUuid.isEmpty() || rhs.mUuid.isEmpty()) return false;
-    return (mUuid < rhs.mUuid);
-}
-
-bool Uuid::operator>(const Uuid& rhs) const noexcept
-{
-    if (mUuid.isEmpty() || rhs.mUuid.isEmpty()) return false;
-    return (mUuid > rhs.mUuid);
-}
-
-bool Uuid::operator<=(const Uuid& rhs) const noexcept
-{
-    if (mUuid.isEmpty() || rhs.mUuid.isEmpty()) return false;
-    return (mUuid <= rhs.mUuid);
-}
-
-bool Uuid::operator>=(const Uuid& rhs) const noexcept
+bool Uuid::setUuid(const QString& uuid) noexcept
 {
-    if (mUuid.isEmpty() || rhs.mUuid.isEmpty()) return false;
-    return (mUuid >= rhs.mUuid);
+    mHigh = mLow = 0; // make UUID invalid
+    if (uuid.length() != 36) return false; // do NOT accept '{' and '}'
+
+    quint8 bytes[16];
+    const QChar* in = uuid.constData();
+    for (int i = 0, pos = 0; i < 16; ++i) {
+        if ((pos == 8) || (pos == 13) || (pos == 18) || (pos == 23)) {
+            if (in[pos++] != QLatin1Char('-')) return false;
+        }
+        uint value = 0;
+        for (int j = 0; j < 2; ++j, ++pos) {
+            ushort c = in[pos].unicode();
+            uint digit;
+            if      ((c >= '0') && (c <= '9')) digit = c - '0';
+            else if ((c >= 'a') && (c <= 'f')) digit = c - 'a' + 10;
+            else if ((c >= 'A') && (c <= 'F')) digit = c - 'A' + 10;
+            else return false;
+            value = (value << 4) | digit;
+        }
+        bytes[i] = quint8(value);
+    }
+    return setBytes(bytes);
 }
 
 /*****************************************************************************************
@@ -96,13 +87,31 @@ bool Uuid::operator>=(const Uuid& rhs) const noexcept
 
 Uuid Uuid::createRandom() noexcept
 {
-    Uuid uuid(QUuid::createUuid().toString().remove("{").remove("}"));
-    if (uuid.isNull()) {
+    Uuid uuid;
+    QByteArray bytes = QUuid::createUuid().toRfc4122();
+    const quint8* data = reinterpret_cast<const quint8*>(bytes.constData());
+    if ((bytes.size() != 16) || (!uuid.setBytes(data))) {
         qCritical() << "Could not generate a valid random UUID!";
     }
     return uuid;
 }
 
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+bool Uuid::setBytes(const quint8* bytes) noexcept
+{
+    mHigh = mLow = 0; // make UUID invalid
+    if ((bytes[6] >> 4) != 4)       return false; // version 4 (random)
+    if ((bytes[8] & 0xC0) != 0x80)  return false; // variant DCE (RFC 4122)
+    for (int i = 0; i < 8; ++i) {
+        mHigh = (mHigh << 8) | bytes[i];
+        mLow = (mLow << 8) | bytes[i + 8];
+    }
+    return true;
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
@@ -43,6 +43,10 @@ namespace librepcb {
  *
  * A valid UUID looks like this: "d79d354b-62bd-4866-996a-78941c575e78"
  *
+ * The UUID is stored as a 128-bit binary value, so copying, comparing and hashing is
+ * very cheap. The string representation is only created on demand by #toStr(). A NULL
+ * UUID is represented by all bits set to zero, which is never a valid version 4 UUID.
+ *
  * @see https://de.wikipedia.org/wiki/Universally_Unique_Identifier
  * @see https://tools.ietf.org/html/rfc4122
  *
@@ -58,21 +62,21 @@ class Uuid final
         /**
          * @brief Default constructor (creates a NULL #Uuid object)
          */
-        Uuid() noexcept : mUuid() {}
+        constexpr Uuid() noexcept : mHigh(0), mLow(0) {}
 
         /**
          * @brief Constructor which creates a #Uuid object from a string
          *
          * @param uuid      The uuid as a string (without braces)
          */
-        explicit Uuid(const QString& uuid) noexcept : mUuid() {setUuid(uuid);}
+        explicit Uuid(const QString& uuid) noexcept : mHigh(0), mLow(0) {setUuid(uuid);}
 
         /**
          * @brief Copy constructor
          *
          * @param other     Another #Uuid object
          */
-        Uuid(const Uuid& other) noexcept : mUuid(other.mUuid) {}
+        constexpr Uuid(const Uuid& other) noexcept = default;
 
         /**
          * @brief Destructor
@@ -87,14 +91,14 @@ class Uuid final
          *
          * @return true if NULL/invalid UUID, false if valid UUID
          */
-        bool isNull() const noexcept {return mUuid.isEmpty();}
+        constexpr bool isNull() const noexcept {return (mHigh == 0) && (mLow == 0);}
 
         /**
          * @brief Get the UUID as a string (without braces)
          *
-         * @return The UUID as a string
+         * @return The UUID as a string (a NULL QString if the UUID is NULL)
          */
-        QString toStr() const noexcept {return mUuid;}
+        QString toStr() const noexcept;
 
 
         // Setters
@@ -115,18 +119,33 @@ class Uuid final
         /**
          * @brief Operator overloadings
          *
+         * The ordering is the same as the ordering of the string representations.
+         *
          * @param rhs   The other object to compare
          *
          * @return  If at least one of both objects is invalid, false will be returned
          *          (except #operator!=() which would return true in this case)!
          */
-        Uuid& operator=(const Uuid& rhs) noexcept;
-        bool operator==(const Uuid& rhs) const noexcept;
-        bool operator!=(const Uuid& rhs) const noexcept;
-        bool operator<(const Uuid& rhs) const noexcept;
-        bool operator>(const Uuid& rhs) const noexcept;
-        bool operator<=(const Uuid& rhs) const noexcept;
-        bool operator>=(const Uuid& rhs) const noexcept;
+        Uuid& operator=(const Uuid& rhs) noexcept = default;
+        constexpr bool operator==(const Uuid& rhs) const noexcept {
+            return (!isNull()) && (!rhs.isNull()) && (mHigh == rhs.mHigh) && (mLow == rhs.mLow);
+        }
+        constexpr bool operator!=(const Uuid& rhs) const noexcept {
+            return !(*this == rhs);
+        }
+        constexpr bool operator<(const Uuid& rhs) const noexcept {
+            return (!isNull()) && (!rhs.isNull()) &&
+                   ((mHigh < rhs.mHigh) || ((mHigh == rhs.mHigh) && (mLow < rhs.mLow)));
+        }
+        constexpr bool operator>(const Uuid& rhs) const noexcept {
+            return rhs < *this;
+        }
+        constexpr bool operator<=(const Uuid& rhs) const noexcept {
+            return (!isNull()) && (!rhs.isNull()) && (!(rhs < *this));
+        }
+        constexpr bool operator>=(const Uuid& rhs) const noexcept {
+            return (!isNull()) && (!rhs.isNull()) && (!(*this < rhs));
+        }
         //@}
 
 
@@ -142,17 +161,34 @@ class Uuid final
 
     private:
 
+        // Private Methods
+
+        /**
+         * @brief Set the UUID from its 16 bytes in big-endian order (RFC 4122)
+         *
+         * @param bytes     The 16 bytes of the UUID
+         *
+         * @return true if the bytes represent a valid UUID, false if not (=> NULL UUID)
+         */
+        bool setBytes(const quint8* bytes) noexcept;
+
+        friend uint qHash(const Uuid& key, uint seed) noexcept;
+
+
         // Private Attributes
-        QString mUuid;
+        quint64 mHigh;  ///< the first 8 bytes of the UUID (big-endian)
+        quint64 mLow;   ///< the last 8 bytes of the UUID (big-endian)
 };
 
 /*****************************************************************************************
  *  Non-Member Functions
  ****************************************************************************************/
 
-inline uint qHash(const Uuid& key, uint seed)
+inline uint qHash(const Uuid& key, uint seed) noexcept
 {
-    return qHash(key.toStr(), seed);
+    // the bits of a random UUID are already uniformly distributed
+    quint64 value = key.mHigh ^ key.mLow;
+    return uint(value ^ (value >> 32)) ^ seed;
 }
 
 inline QDataStream& operator<<(QDataStream& stream, const Uuid& uuid)
@@ -35,6 +35,7 @@ HEADERS += \
     librarybaseelement.h \
     libraryelement.h \
     libraryelementattribute.h \
+    libraryelementmetadata.h \
     pkg/footprint.h \
     pkg/footprintpad.h \
     pkg/footprintpadpreviewgraphicsitem.h \
@@ -62,6 +63,7 @@ SOURCES += \
     librarybaseelement.cpp \
     libraryelement.cpp \
     libraryelementattribute.cpp \
+    libraryelementmetadata.cpp \
     pkg/footprint.cpp \
     pkg/footprintpad.cpp \
     pkg/footprintpadpreviewgraphicsitem.cpp \
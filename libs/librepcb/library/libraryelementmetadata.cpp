@@ -0,0 +1,233 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include "libraryelementmetadata.h"
+#include <librepcb/common/fileio/smartversionfile.h>
+#include <librepcb/common/application.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace library {
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+LibraryElementMetadata::LibraryElementMetadata() noexcept
+{
+}
+
+LibraryElementMetadata::LibraryElementMetadata(const FilePath& elementDirectory,
+                                               const QString& shortElementName,
+                                               const QString& longElementName) throw (Exception) :
+    mDirectory(elementDirectory)
+{
+    // check if the directory is a library element
+    FilePath versionFilePath = mDirectory.getPathTo(".librepcb-" % shortElementName);
+    if (!versionFilePath.isExistingFile()) {
+        throw RuntimeError(__FILE__, __LINE__, QString(),
+            QString(tr("Directory is not a library element of type %1: \"%2\""))
+            .arg(longElementName, mDirectory.toNative()));
+    }
+
+    // check directory name
+    Uuid dirUuid(mDirectory.getFilename());
+    if (dirUuid.isNull()) {
+        throw RuntimeError(__FILE__, __LINE__, QString(),
+            QString(tr("Directory name is not a valid UUID: \"%1\""))
+            .arg(mDirectory.toNative()));
+    }
+
+    // read version number from version file
+    SmartVersionFile versionFile(versionFilePath, false, true);
+    Version fileVersion = versionFile.getVersion();
+    if (fileVersion != qApp->getAppVersion()) {
+        throw RuntimeError(__FILE__, __LINE__, QString(),
+            QString(tr("The library element %1 was created with a newer application "
+                       "version. You need at least LibrePCB version %2 to open it."))
+            .arg(mDirectory.toNative()).arg(fileVersion.toPrettyStr(3)));
+    }
+
+    // open main XML file
+    FilePath xmlFilePath = mDirectory.getPathTo(longElementName % ".xml");
+    QFile file(xmlFilePath.toStr());
+    if (!file.open(QIODevice::ReadOnly)) {
+        throw RuntimeError(__FILE__, __LINE__, file.errorString(),
+            QString(tr("Could not open file \"%1\": %2"))
+            .arg(xmlFilePath.toNative(), file.errorString()));
+    }
+
+    // stream the XML file until the end of the "meta" element
+    QXmlStreamReader reader(&file);
+    if ((!reader.readNextStartElement()) || (reader.name() != longElementName)) {
+        throw RuntimeError(__FILE__, __LINE__, reader.name().toString(),
+            QString(tr("Root node \"%1\" not found in \"%2\"."))
+            .arg(longElementName, xmlFilePath.toNative()));
+    }
+    bool metaFound = false;
+    while ((!metaFound) && reader.readNextStartElement()) {
+        if (reader.name() == QLatin1String("meta")) {
+            readMetaElement(reader, xmlFilePath); // can throw
+            metaFound = true;
+        } else {
+            reader.skipCurrentElement();
+        }
+    }
+    if (reader.hasError()) {
+        throw RuntimeError(__FILE__, __LINE__, reader.errorString(),
+            QString(tr("Error while parsing XML in file \"%1\": %2 [%3:%4]"))
+            .arg(xmlFilePath.toNative(), reader.errorString())
+            .arg(reader.lineNumber()).arg(reader.columnNumber()));
+    }
+    if (!metaFound) {
+        throw RuntimeError(__FILE__, __LINE__, QString(),
+            QString(tr("Child \"meta\" not found in \"%1\".")).arg(xmlFilePath.toNative()));
+    }
+
+    // check the read attributes
+    if (mUuid.isNull() || (!mVersion.isValid())) {
+        throw RuntimeError(__FILE__, __LINE__, QString(),
+            QString(tr("Invalid UUID or version in \"%1\".")).arg(xmlFilePath.toNative()));
+    }
+    if ((!mNames.contains("en_US")) || (!mDescriptions.contains("en_US"))
+        || (!mKeywords.contains("en_US")))
+    {
+        throw RuntimeError(__FILE__, __LINE__, xmlFilePath.toStr(), QString(
+            tr("At least one entry in \"%1\" has no translation for locale \"en_US\"."))
+            .arg(xmlFilePath.toNative()));
+    }
+    if (mUuid != dirUuid) {
+        throw RuntimeError(__FILE__, __LINE__,
+            QString("%1/%2").arg(mUuid.toStr(), dirUuid.toStr()),
+            QString(tr("UUID mismatch between element directory and XML file: \"%1\""))
+            .arg(xmlFilePath.toNative()));
+    }
+    if ((longElementName == QLatin1String("device"))
+        && (mComponentUuid.isNull() || mPackageUuid.isNull()))
+    {
+        throw RuntimeError(__FILE__, __LINE__, QString(),
+            QString(tr("Invalid component or package UUID in \"%1\"."))
+            .arg(xmlFilePath.toNative()));
+    }
+}
+
+LibraryElementMetadata::~LibraryElementMetadata() noexcept
+{
+}
+
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+QStringList LibraryElementMetadata::getAllAvailableLocales() const noexcept
+{
+    QStringList list;
+    list.append(mNames.keys());
+    list.append(mDescriptions.keys());
+    list.append(mKeywords.keys());
+    list.removeDuplicates();
+    list.sort(Qt::CaseSensitive);
+    return list;
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+void LibraryElementMetadata::readMetaElement(QXmlStreamReader& reader,
+                                             const FilePath& xmlFilePath) throw (Exception)
+{
+    while (reader.readNextStartElement()) {
+        QStringRef name = reader.name();
+        if (name == QLatin1String("uuid")) {
+            mUuid = readUuidElement(reader, xmlFilePath, true); // can throw
+        } else if (name == QLatin1String("version")) {
+            mVersion.setVersion(reader.readElementText().trimmed());
+        } else if (name == QLatin1String("name")) {
+            readLocaleElement(reader, xmlFilePath, mNames, true); // can throw
+        } else if (name == QLatin1String("description")) {
+            readLocaleElement(reader, xmlFilePath, mDescriptions, false); // can throw
+        } else if (name == QLatin1String("keywords")) {
+            readLocaleElement(reader, xmlFilePath, mKeywords, false); // can throw
+        } else if (name == QLatin1String("category")) {
+            mCategories.append(readUuidElement(reader, xmlFilePath, true)); // can throw
+        } else if (name == QLatin1String("parent")) {
+            mParentUuid = readUuidElement(reader, xmlFilePath, false); // can throw
+        } else if (name == QLatin1String("component")) {
+            mComponentUuid = readUuidElement(reader, xmlFilePath, true); // can throw
+        } else if (name == QLatin1String("package")) {
+            mPackageUuid = readUuidElement(reader, xmlFilePath, true); // can throw
+        } else {
+            reader.skipCurrentElement(); // not needed (author, created, ...)
+        }
+    }
+}
+
+void LibraryElementMetadata::readLocaleElement(QXmlStreamReader& reader,
+                                               const FilePath& xmlFilePath,
+                                               QMap<QString, QString>& list,
+                                               bool throwIfValueEmpty) throw (Exception)
+{
+    QString locale = reader.attributes().value("locale").toString();
+    if (locale.isEmpty()) {
+        throw RuntimeError(__FILE__, __LINE__, xmlFilePath.toStr(),
+            QString(tr("Attribute \"locale\" not found in \"%1\"."))
+            .arg(xmlFilePath.toNative()));
+    }
+    if (list.contains(locale)) {
+        throw RuntimeError(__FILE__, __LINE__, xmlFilePath.toStr(),
+            QString(tr("Locale \"%1\" defined multiple times in \"%2\"."))
+            .arg(locale, xmlFilePath.toNative()));
+    }
+    QString elementName = reader.name().toString();
+    QString value = reader.readElementText();
+    if (value.isEmpty() && throwIfValueEmpty) {
+        throw RuntimeError(__FILE__, __LINE__, xmlFilePath.toStr(),
+            QString(tr("Empty \"%1\" for locale \"%2\" in \"%3\"."))
+            .arg(elementName, locale, xmlFilePath.toNative()));
+    }
+    list.insert(locale, value);
+}
+
+Uuid LibraryElementMetadata::readUuidElement(QXmlStreamReader& reader,
+                                             const FilePath& xmlFilePath,
+                                             bool throwIfEmpty) throw (Exception)
+{
+    QString text = reader.readElementText().trimmed();
+    Uuid uuid(text);
+    if ((uuid.isNull()) && (throwIfEmpty || (!text.isEmpty()))) {
+        throw RuntimeError(__FILE__, __LINE__, text,
+            QString(tr("Invalid UUID \"%1\" in \"%2\"."))
+            .arg(text, xmlFilePath.toNative()));
+    }
+    return uuid;
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace library
+} // namespace librepcb
@@ -0,0 +1,137 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_LIBRARY_LIBRARYELEMENTMETADATA_H
+#define LIBREPCB_LIBRARY_LIBRARYELEMENTMETADATA_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <librepcb/common/exceptions.h>
+#include <librepcb/common/fileio/filepath.h>
+#include <librepcb/common/version.h>
+#include <librepcb/common/uuid.h>
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+class QXmlStreamReader;
+
+namespace librepcb {
+namespace library {
+
+/*****************************************************************************************
+ *  Class LibraryElementMetadata
+ ****************************************************************************************/
+
+/**
+ * @brief The LibraryElementMetadata class reads only the "meta" section of a library
+ *        element's XML file
+ *
+ * In contrast to the constructors of #LibraryBaseElement and its subclasses, this class
+ * does not build a DOM tree of the whole file. The file is streamed with a
+ * QXmlStreamReader and parsing stops right after the "meta" element, so the cost of
+ * reading the metadata does not depend on the size of the element's content (e.g. the
+ * footprints of a package). This is mainly used to index the workspace libraries.
+ *
+ * @note This class is reentrant, so it can be used from multiple threads concurrently.
+ */
+class LibraryElementMetadata final
+{
+        Q_DECLARE_TR_FUNCTIONS(LibraryElementMetadata)
+
+    public:
+
+        // Constructors / Destructor
+        LibraryElementMetadata() noexcept;
+        LibraryElementMetadata(const LibraryElementMetadata& other) = default;
+
+        /**
+         * @brief Read the metadata of a library element from its directory
+         *
+         * @param elementDirectory  The directory of the library element
+         * @param shortElementName  e.g. "sym" (see #LibraryBaseElement)
+         * @param longElementName   e.g. "symbol" (see #LibraryBaseElement)
+         *
+         * @throw Exception If the directory is not a valid library element of the
+         *                  specified type or if the metadata could not be read.
+         */
+        LibraryElementMetadata(const FilePath& elementDirectory,
+                               const QString& shortElementName,
+                               const QString& longElementName) throw (Exception);
+        ~LibraryElementMetadata() noexcept;
+
+        // Getters
+        const FilePath& getFilePath() const noexcept {return mDirectory;}
+        const Uuid& getUuid() const noexcept {return mUuid;}
+        const Version& getVersion() const noexcept {return mVersion;}
+        const QMap<QString, QString>& getNames() const noexcept {return mNames;}
+        const QMap<QString, QString>& getDescriptions() const noexcept {return mDescriptions;}
+        const QMap<QString, QString>& getKeywords() const noexcept {return mKeywords;}
+        QStringList getAllAvailableLocales() const noexcept;
+        const QList<Uuid>& getCategories() const noexcept {return mCategories;}
+        const Uuid& getParentUuid() const noexcept {return mParentUuid;}
+        const Uuid& getComponentUuid() const noexcept {return mComponentUuid;}
+        const Uuid& getPackageUuid() const noexcept {return mPackageUuid;}
+
+        // Operator Overloadings
+        LibraryElementMetadata& operator=(const LibraryElementMetadata& rhs) = default;
+
+        // Static Methods
+        template <typename ElementType>
+        static LibraryElementMetadata read(const FilePath& elementDirectory) throw (Exception)
+        {
+            return LibraryElementMetadata(elementDirectory,
+                ElementType::getShortElementName(), ElementType::getLongElementName());
+        }
+
+
+    private: // Methods
+
+        void readMetaElement(QXmlStreamReader& reader, const FilePath& xmlFilePath) throw (Exception);
+        static void readLocaleElement(QXmlStreamReader& reader, const FilePath& xmlFilePath,
+                                      QMap<QString, QString>& list,
+                                      bool throwIfValueEmpty) throw (Exception);
+        static Uuid readUuidElement(QXmlStreamReader& reader, const FilePath& xmlFilePath,
+                                    bool throwIfEmpty) throw (Exception);
+
+
+    private: // Data
+
+        FilePath mDirectory;
+        Uuid mUuid;
+        Version mVersion;
+        QMap<QString, QString> mNames;        ///< key: locale (like "en_US"), value: name
+        QMap<QString, QString> mDescriptions; ///< key: locale (like "en_US"), value: description
+        QMap<QString, QString> mKeywords;     ///< key: locale (like "en_US"), value: keywords
+        QList<Uuid> mCategories;    ///< only available for non-category elements
+        Uuid mParentUuid;           ///< only available for categories
+        Uuid mComponentUuid;        ///< only available for devices
+        Uuid mPackageUuid;          ///< only available for devices
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace library
+} // namespace librepcb
+
+#endif // LIBREPCB_LIBRARY_LIBRARYELEMENTMETADATA_H
@@ -33,9 +33,12 @@
 #include <librepcb/common/graphics/graphicsview.h>
 #include <librepcb/common/graphics/graphicsscene.h>
 #include <librepcb/common/gridproperties.h>
+#include <librepcb/common/algorithm/airwiresbuilder.h>
 #include "../circuit/circuit.h"
 #include "../erc/ercmsg.h"
 #include "../circuit/componentinstance.h"
+#include "../circuit/componentsignalinstance.h"
+#include "../circuit/netsignal.h"
 #include "items/bi_device.h"
 #include "items/bi_footprint.h"
 #include "items/bi_footprintpad.h"
@@ -44,6 +47,7 @@
 #include "items/bi_netline.h"
 #include <librepcb/library/cmp/component.h>
 #include "items/bi_polygon.h"
+#include "items/bi_airwire.h"
 #include "boardlayerstack.h"
 
 /*****************************************************************************************
@@ -52,14 +56,34 @@
 namespace librepcb {
 namespace project {
 
+// cell size of the spatial indexes (100mil, in pixels)
+static const qreal sSpatialIndexCellSize = Length(2540000).toPx();
+
+// interval of deferred graphics item updates during interactive moves (~60 frames/s)
+static const int sDeferredGraphicsItemUpdateInterval = 16;
+
 /*****************************************************************************************
  *  Constructors / Destructor
  ****************************************************************************************/
 
 Board::Board(const Board& other, const FilePath& filepath, const QString& name) throw (Exception) :
     QObject(&other.getProject()), mProject(other.getProject()), mFilePath(filepath),
-    mIsAddedToProject(false)
+    mIsAddedToProject(false), mHasGraphicsItems(!mProject.isModelOnly()),
+    mViasIndex(sSpatialIndexCellSize, &getGrabAreaBoundingRect),
+    mNetPointsIndex(sSpatialIndexCellSize, &getGrabAreaBoundingRect),
+    mNetLinesIndex(sSpatialIndexCellSize, &getGrabAreaBoundingRect),
+    mFootprintsIndex(sSpatialIndexCellSize, &getGrabAreaBoundingRect),
+    mFootprintPadsIndex(sSpatialIndexCellSize, &getGrabAreaBoundingRect),
+    mInteractiveMoveCounter(0)
 {
+    mDeferredGraphicsItemUpdateTimer.setSingleShot(true);
+    mDeferredGraphicsItemUpdateTimer.setInterval(sDeferredGraphicsItemUpdateInterval);
+    connect(&mDeferredGraphicsItemUpdateTimer, &QTimer::timeout,
+            this, &Board::processDeferredGraphicsItemUpdates);
+    mAirWiresRebuildTimer.setSingleShot(true);
+    connect(&mAirWiresRebuildTimer, &QTimer::timeout,
+            this, &Board::triggerAirWiresRebuild);
+
     try
     {
         mGraphicsScene.reset(new GraphicsScene());
@@ -86,6 +110,7 @@ Board::Board(const Board& other, const FilePath& filepath, const QString& name)
             BI_Device* copy = new BI_Device(*this, *device);
             Q_ASSERT(!getDeviceInstanceByComponentUuid(copy->getComponentInstanceUuid()));
             mDeviceInstances.insert(copy->getComponentInstanceUuid(), copy);
+            addToSpatialIndex(*copy);
             copiedDeviceInstances.insert(device, copy);
         }
 
@@ -95,6 +120,8 @@ Board::Board(const Board& other, const FilePath& filepath, const QString& name)
             BI_Via* copy = new BI_Via(*this, *via);
             Q_ASSERT(!getViaByUuid(copy->getUuid()));
             mVias.append(copy);
+            mViasByUuid.insert(copy->getUuid(), copy);
+            mViasIndex.insert(copy);
             copiedVias.insert(via, copy);
         }
 
@@ -113,6 +140,8 @@ Board::Board(const Board& other, const FilePath& filepath, const QString& name)
             BI_NetPoint* copy = new BI_NetPoint(*this, *netpoint, pad, via);
             Q_ASSERT(!getNetPointByUuid(copy->getUuid()));
             mNetPoints.append(copy);
+            mNetPointsByUuid.insert(copy->getUuid(), copy);
+            mNetPointsIndex.insert(copy);
             copiedNetPoints.insert(netpoint, copy);
         }
 
@@ -124,6 +153,8 @@ Board::Board(const Board& other, const FilePath& filepath, const QString& name)
             BI_NetLine* copy = new BI_NetLine(*this, *netline, *start, *end);
             Q_ASSERT(!getNetLineByUuid(copy->getUuid()));
             mNetLines.append(copy);
+            mNetLinesByUuid.insert(copy->getUuid(), copy);
+            mNetLinesIndex.insert(copy);
         }
 
         // copy polygons
@@ -163,8 +194,23 @@ Board::Board(const Board& other, const FilePath& filepath, const QString& name)
 
 Board::Board(Project& project, const FilePath& filepath, bool restore,
              bool readOnly, bool create, const QString& newName) throw (Exception) :
-    QObject(&project), mProject(project), mFilePath(filepath), mIsAddedToProject(false)
+    QObject(&project), mProject(project), mFilePath(filepath),
+    mIsAddedToProject(false), mHasGraphicsItems(!project.isModelOnly()),
+    mViasIndex(sSpatialIndexCellSize, &getGrabAreaBoundingRect),
+    mNetPointsIndex(sSpatialIndexCellSize, &getGrabAreaBoundingRect),
+    mNetLinesIndex(sSpatialIndexCellSize, &getGrabAreaBoundingRect),
+    mFootprintsIndex(sSpatialIndexCellSize, &getGrabAreaBoundingRect),
+    mFootprintPadsIndex(sSpatialIndexCellSize, &getGrabAreaBoundingRect),
+    mInteractiveMoveCounter(0)
 {
+    mDeferredGraphicsItemUpdateTimer.setSingleShot(true);
+    mDeferredGraphicsItemUpdateTimer.setInterval(sDeferredGraphicsItemUpdateInterval);
+    connect(&mDeferredGraphicsItemUpdateTimer, &QTimer::timeout,
+            this, &Board::processDeferredGraphicsItemUpdates);
+    mAirWiresRebuildTimer.setSingleShot(true);
+    connect(&mAirWiresRebuildTimer, &QTimer::timeout,
+            this, &Board::triggerAirWiresRebuild);
+
     try
     {
         mGraphicsScene.reset(new GraphicsScene());
@@ -218,6 +264,7 @@ Board::Board(Project& project, const FilePath& filepath, bool restore,
                         .arg(device->getComponentInstanceUuid().toStr()));
                 }
                 mDeviceInstances.insert(device->getComponentInstanceUuid(), device);
+                addToSpatialIndex(*device);
             }
 
             // Load all vias
@@ -231,6 +278,8 @@ Board::Board(Project& project, const FilePath& filepath, bool restore,
                         .arg(via->getUuid().toStr()));
                 }
                 mVias.append(via);
+                mViasByUuid.insert(via->getUuid(), via);
+                mViasIndex.insert(via);
             }
 
             // Load all netpoints
@@ -244,6 +293,8 @@ Board::Board(Project& project, const FilePath& filepath, bool restore,
                         .arg(netpoint->getUuid().toStr()));
                 }
                 mNetPoints.append(netpoint);
+                mNetPointsByUuid.insert(netpoint->getUuid(), netpoint);
+                mNetPointsIndex.insert(netpoint);
             }
 
             // Load all netlines
@@ -257,6 +308,8 @@ Board::Board(Project& project, const FilePath& filepath, bool restore,
                         .arg(netline->getUuid().toStr()));
                 }
                 mNetLines.append(netline);
+                mNetLinesByUuid.insert(netline->getUuid(), netline);
+                mNetLinesIndex.insert(netline);
             }
 
             // Load all polygons
@@ -301,6 +354,9 @@ Board::~Board() noexcept
 {
     Q_ASSERT(!mIsAddedToProject);
 
+    mDeferredGraphicsItemUpdates.clear(); // nothing to update, all items get deleted
+    mScheduledNetSignalsForAirWireRebuild.clear();
+    qDeleteAll(mAirWires);          mAirWires.clear();
     qDeleteAll(mErcMsgListUnplacedComponentInstances);    mErcMsgListUnplacedComponentInstances.clear();
 
     // delete all items
@@ -438,28 +494,38 @@ QList<BI_Base*> Board::getItemsAtScenePos(const Point& pos) const noexcept
     QList<BI_Base*> list;   // Note: The order of adding the items is very important (the
                             // top most item must appear as the first item in the list)!
     // vias
-    foreach (BI_Via* via, mVias)
+    foreach (BI_Via* via, mViasIndex.getItemsAt(scenePosPx))
     {
         if (via->isSelectable() && via->getGrabAreaScenePx().contains(scenePosPx)) {
             list.append(via);
         }
     }
     // netpoints
-    foreach (BI_NetPoint* netpoint, mNetPoints)
+    foreach (BI_NetPoint* netpoint, mNetPointsIndex.getItemsAt(scenePosPx))
     {
         if (netpoint->isSelectable() && netpoint->getGrabAreaScenePx().contains(scenePosPx)) {
             list.append(netpoint);
         }
     }
     // netlines
-    foreach (BI_NetLine* netline, mNetLines)
+    foreach (BI_NetLine* netline, mNetLinesIndex.getItemsAt(scenePosPx))
     {
         if (netline->isSelectable() && netline->getGrabAreaScenePx().contains(scenePosPx)) {
             list.append(netline);
         }
     }
-    // footprints & pads
-    foreach (BI_Device* device, mDeviceInstances)
+    // footprints & pads (the devices are processed in the same order as in
+    // #mDeviceInstances to get the same stacking order as without the index)
+    QMap<Uuid, BI_Device*> devices;
+    foreach (BI_Footprint* footprint, mFootprintsIndex.getItemsAt(scenePosPx)) {
+        BI_Device& device = footprint->getDeviceInstance();
+        devices.insert(device.getComponentInstanceUuid(), &device);
+    }
+    foreach (BI_FootprintPad* pad, mFootprintPadsIndex.getItemsAt(scenePosPx)) {
+        BI_Device& device = pad->getFootprint().getDeviceInstance();
+        devices.insert(device.getComponentInstanceUuid(), &device);
+    }
+    foreach (BI_Device* device, devices)
     {
         BI_Footprint& footprint = device->getFootprint();
         if (footprint.isSelectable() && footprint.getGrabAreaScenePx().contains(scenePosPx)) {
@@ -486,7 +552,7 @@ QList<BI_Base*> Board::getItemsAtScenePos(const Point& pos) const noexcept
 QList<BI_Via*> Board::getViasAtScenePos(const Point& pos, const NetSignal* netsignal) const noexcept
 {
     QList<BI_Via*> list;
-    foreach (BI_Via* via, mVias)
+    foreach (BI_Via* via, mViasIndex.getItemsAt(pos.toPxQPointF()))
     {
         if (via->isSelectable() && via->getGrabAreaScenePx().contains(pos.toPxQPointF())
             && ((!netsignal) || (via->getNetSignal() == netsignal)))
@@ -501,7 +567,7 @@ QList<BI_NetPoint*> Board::getNetPointsAtScenePos(const Point& pos, const BoardL
                                                   const NetSignal* netsignal) const noexcept
 {
     QList<BI_NetPoint*> list;
-    foreach (BI_NetPoint* netpoint, mNetPoints)
+    foreach (BI_NetPoint* netpoint, mNetPointsIndex.getItemsAt(pos.toPxQPointF()))
     {
         if (netpoint->isSelectable() && netpoint->getGrabAreaScenePx().contains(pos.toPxQPointF())
             && ((!layer) || (&netpoint->getLayer() == layer))
@@ -517,7 +583,7 @@ QList<BI_NetLine*> Board::getNetLinesAtScenePos(const Point& pos, const BoardLay
                                                 const NetSignal* netsignal) const noexcept
 {
     QList<BI_NetLine*> list;
-    foreach (BI_NetLine* netline, mNetLines)
+    foreach (BI_NetLine* netline, mNetLinesIndex.getItemsAt(pos.toPxQPointF()))
     {
         if (netline->isSelectable() && netline->getGrabAreaScenePx().contains(pos.toPxQPointF())
             && ((!layer) || (&netline->getLayer() == layer))
@@ -533,16 +599,13 @@ QList<BI_FootprintPad*> Board::getPadsAtScenePos(const Point& pos, const BoardLa
                                                  const NetSignal* netsignal) const noexcept
 {
     QList<BI_FootprintPad*> list;
-    foreach (BI_Device* device, mDeviceInstances)
+    foreach (BI_FootprintPad* pad, mFootprintPadsIndex.getItemsAt(pos.toPxQPointF()))
     {
-        foreach (BI_FootprintPad* pad, device->getFootprint().getPads())
+        if (pad->isSelectable() && pad->getGrabAreaScenePx().contains(pos.toPxQPointF())
+            && ((!layer) || (pad->isOnLayer(layer->getId())))
+            && ((!netsignal) || (pad->getCompSigInstNetSignal() == netsignal)))
         {
-            if (pad->isSelectable() && pad->getGrabAreaScenePx().contains(pos.toPxQPointF())
-                && ((!layer) || (pad->isOnLayer(layer->getId())))
-                && ((!netsignal) || (pad->getCompSigInstNetSignal() == netsignal)))
-            {
-                list.append(pad);
-            }
+            list.append(pad);
         }
     }
     return list;
@@ -571,6 +634,7 @@ QList<BI_Base*> Board::getAllItems() const noexcept
 void Board::setGridProperties(const GridProperties& grid) noexcept
 {
     *mGridProperties = grid;
+    setModified();
 }
 
 /*****************************************************************************************
@@ -596,6 +660,7 @@ void Board::addDeviceInstance(BI_Device& instance) throw (Exception)
     // add to board
     instance.addToBoard(*mGraphicsScene); // can throw
     mDeviceInstances.insert(instance.getComponentInstanceUuid(), &instance);
+    addToSpatialIndex(instance);
     updateErcMessages();
     emit deviceAdded(instance);
 }
@@ -608,6 +673,7 @@ void Board::removeDeviceInstance(BI_Device& instance) throw (Exception)
     // remove from board
     instance.removeFromBoard(*mGraphicsScene); // can throw
     mDeviceInstances.remove(instance.getComponentInstanceUuid());
+    removeFromSpatialIndex(instance);
     updateErcMessages();
     emit deviceRemoved(instance);
 }
@@ -618,16 +684,12 @@ void Board::removeDeviceInstance(BI_Device& instance) throw (Exception)
 
 BI_Via* Board::getViaByUuid(const Uuid& uuid) const noexcept
 {
-    foreach (BI_Via* via, mVias) {
-        if (via->getUuid() == uuid)
-            return via;
-    }
-    return nullptr;
+    return mViasByUuid.value(uuid, nullptr);
 }
 
 void Board::addVia(BI_Via& via) throw (Exception)
 {
-    if ((!mIsAddedToProject) || (mVias.contains(&via)) || (&via.getBoard() != this)) {
+    if ((!mIsAddedToProject) || (getViaByUuid(via.getUuid()) == &via) || (&via.getBoard() != this)) {
         throw LogicError(__FILE__, __LINE__);
     }
     // check if there is no via with the same uuid in the list
@@ -639,16 +701,20 @@ void Board::addVia(BI_Via& via) throw (Exception)
     // add to board
     via.addToBoard(*mGraphicsScene); // can throw
     mVias.append(&via);
+    mViasByUuid.insert(via.getUuid(), &via);
+    mViasIndex.insert(&via);
 }
 
 void Board::removeVia(BI_Via& via) throw (Exception)
 {
-    if ((!mIsAddedToProject) || (!mVias.contains(&via))) {
+    if ((!mIsAddedToProject) || (getViaByUuid(via.getUuid()) != &via)) {
         throw LogicError(__FILE__, __LINE__);
     }
     // remove from board
     via.removeFromBoard(*mGraphicsScene); // can throw
     mVias.removeOne(&via);
+    mViasByUuid.remove(via.getUuid());
+    mViasIndex.remove(&via);
 }
 
 /*****************************************************************************************
@@ -657,16 +723,12 @@ void Board::removeVia(BI_Via& via) throw (Exception)
 
 BI_NetPoint* Board::getNetPointByUuid(const Uuid& uuid) const noexcept
 {
-    foreach (BI_NetPoint* netpoint, mNetPoints) {
-        if (netpoint->getUuid() == uuid)
-            return netpoint;
-    }
-    return nullptr;
+    return mNetPointsByUuid.value(uuid, nullptr);
 }
 
 void Board::addNetPoint(BI_NetPoint& netpoint) throw (Exception)
 {
-    if ((!mIsAddedToProject) || (mNetPoints.contains(&netpoint))
+    if ((!mIsAddedToProject) || (getNetPointByUuid(netpoint.getUuid()) == &netpoint)
         || (&netpoint.getBoard() != this))
     {
         throw LogicError(__FILE__, __LINE__);
@@ -680,16 +742,20 @@ void Board::addNetPoint(BI_NetPoint& netpoint) throw (Exception)
     // add to board
     netpoint.addToBoard(*mGraphicsScene); // can throw
     mNetPoints.append(&netpoint);
+    mNetPointsByUuid.insert(netpoint.getUuid(), &netpoint);
+    mNetPointsIndex.insert(&netpoint);
 }
 
 void Board::removeNetPoint(BI_NetPoint& netpoint) throw (Exception)
 {
-    if ((!mIsAddedToProject) || (!mNetPoints.contains(&netpoint))) {
+    if ((!mIsAddedToProject) || (getNetPointByUuid(netpoint.getUuid()) != &netpoint)) {
         throw LogicError(__FILE__, __LINE__);
     }
     // remove from board
     netpoint.removeFromBoard(*mGraphicsScene); // can throw
     mNetPoints.removeOne(&netpoint);
+    mNetPointsByUuid.remove(netpoint.getUuid());
+    mNetPointsIndex.remove(&netpoint);
 }
 
 /*****************************************************************************************
@@ -698,16 +764,12 @@ void Board::removeNetPoint(BI_NetPoint& netpoint) throw (Exception)
 
 BI_NetLine* Board::getNetLineByUuid(const Uuid& uuid) const noexcept
 {
-    foreach (BI_NetLine* netline, mNetLines) {
-        if (netline->getUuid() == uuid)
-            return netline;
-    }
-    return nullptr;
+    return mNetLinesByUuid.value(uuid, nullptr);
 }
 
 void Board::addNetLine(BI_NetLine& netline) throw (Exception)
 {
-    if ((!mIsAddedToProject) || (mNetLines.contains(&netline))
+    if ((!mIsAddedToProject) || (getNetLineByUuid(netline.getUuid()) == &netline)
         || (&netline.getBoard() != this))
     {
         throw LogicError(__FILE__, __LINE__);
@@ -721,16 +783,20 @@ void Board::addNetLine(BI_NetLine& netline) throw (Exception)
     // add to board
     netline.addToBoard(*mGraphicsScene); // can throw
     mNetLines.append(&netline);
+    mNetLinesByUuid.insert(netline.getUuid(), &netline);
+    mNetLinesIndex.insert(&netline);
 }
 
 void Board::removeNetLine(BI_NetLine& netline) throw (Exception)
 {
-    if ((!mIsAddedToProject) || (!mNetLines.contains(&netline))) {
+    if ((!mIsAddedToProject) || (getNetLineByUuid(netline.getUuid()) != &netline)) {
         throw LogicError(__FILE__, __LINE__);
     }
     // remove from board
     netline.removeFromBoard(*mGraphicsScene); // can throw
     mNetLines.removeOne(&netline);
+    mNetLinesByUuid.remove(netline.getUuid());
+    mNetLinesIndex.remove(&netline);
 }
 
 /*****************************************************************************************
@@ -761,6 +827,93 @@ void Board::removePolygon(BI_Polygon& polygon) throw (Exception)
  *  General Methods
  ****************************************************************************************/
 
+void Board::itemGeometryChanged(BI_Base& item) noexcept
+{
+    switch (item.getType()) {
+        case BI_Base::Type_t::Via:
+            mViasIndex.invalidate(static_cast<BI_Via*>(&item));
+            break;
+        case BI_Base::Type_t::NetPoint:
+            mNetPointsIndex.invalidate(static_cast<BI_NetPoint*>(&item));
+            break;
+        case BI_Base::Type_t::NetLine:
+            mNetLinesIndex.invalidate(static_cast<BI_NetLine*>(&item));
+            break;
+        case BI_Base::Type_t::Footprint:
+            mFootprintsIndex.invalidate(static_cast<BI_Footprint*>(&item));
+            break;
+        case BI_Base::Type_t::FootprintPad:
+            mFootprintPadsIndex.invalidate(static_cast<BI_FootprintPad*>(&item));
+            break;
+        default:
+            break; // item is not indexed
+    }
+}
+
+void Board::beginInteractiveMove() noexcept
+{
+    ++mInteractiveMoveCounter;
+}
+
+void Board::endInteractiveMove() noexcept
+{
+    Q_ASSERT(mInteractiveMoveCounter > 0);
+    if (--mInteractiveMoveCounter == 0) {
+        processDeferredGraphicsItemUpdates();
+    }
+}
+
+void Board::deferGraphicsItemUpdate(BI_Base& item) noexcept
+{
+    Q_ASSERT(isInteractiveMoveActive());
+    mDeferredGraphicsItemUpdates.insert(&item, QPointer<BI_Base>(&item));
+    if (!mDeferredGraphicsItemUpdateTimer.isActive()) {
+        mDeferredGraphicsItemUpdateTimer.start(); // process them with the next frame
+    }
+}
+
+void Board::scheduleAirWiresRebuild(NetSignal* netsignal) noexcept
+{
+    if ((!netsignal) || (!mHasGraphicsItems)) return; // nobody would see them
+    mScheduledNetSignalsForAirWireRebuild.insert(netsignal, QPointer<NetSignal>(netsignal));
+    if (isInteractiveMoveActive()) {
+        if (!mDeferredGraphicsItemUpdateTimer.isActive()) {
+            mDeferredGraphicsItemUpdateTimer.start(); // rebuild them with the next frame
+        }
+    } else if (!mAirWiresRebuildTimer.isActive()) {
+        mAirWiresRebuildTimer.start(); // rebuild them as soon as the event loop is idle
+    }
+}
+
+void Board::triggerAirWiresRebuild() noexcept
+{
+    mAirWiresRebuildTimer.stop();
+    QHash<const NetSignal*, QPointer<NetSignal>> netsignals;
+    netsignals.swap(mScheduledNetSignalsForAirWireRebuild);
+    for (auto it = netsignals.constBegin(); it != netsignals.constEnd(); ++it) {
+        removeAirWires(it.key());
+        if (it.value() && mIsAddedToProject) {
+            rebuildAirWires(*it.value());
+        }
+    }
+}
+
+void Board::createGraphicsItems() noexcept
+{
+    if (!mHasGraphicsItems) {
+        mHasGraphicsItems = true;
+        foreach (BI_Base* item, getAllItems()) {
+            item->createGraphicsItems();
+        }
+        // air wires are not built without graphics items, so build all of them now
+        Q_ASSERT(mAirWires.isEmpty());
+        foreach (NetSignal* netsignal, mProject.getCircuit().getNetSignals()) {
+            scheduleAirWiresRebuild(netsignal);
+        }
+        triggerAirWiresRebuild();
+    }
+}
+
 void Board::addToProject() throw (Exception)
 {
     if (mIsAddedToProject) {
@@ -776,6 +929,7 @@ void Board::addToProject() throw (Exception)
     mIsAddedToProject = true;
     updateErcMessages();
     sgl.dismiss();
+    triggerAirWiresRebuild(); // all items have scheduled their net signals
 }
 
 void Board::removeFromProject() throw (Exception)
@@ -793,13 +947,23 @@ void Board::removeFromProject() throw (Exception)
     mIsAddedToProject = false;
     updateErcMessages();
     sgl.dismiss();
+    mScheduledNetSignalsForAirWireRebuild.clear();
+    foreach (const NetSignal* netsignal, mAirWires.uniqueKeys()) {
+        removeAirWires(netsignal);
+    }
+}
+
+void Board::setModified() noexcept
+{
+    mXmlFile->setModified();
 }
 
 bool Board::save(bool toOriginal, QStringList& errors) noexcept
 {
     bool success = true;
 
-    // save board XML file
+    // save board XML file (only if modified since the last save)
+    if (!mXmlFile->isModified(toOriginal)) return true;
     try
     {
         if (mIsAddedToProject)
@@ -821,8 +985,38 @@ bool Board::save(bool toOriginal, QStringList& errors) noexcept
     return success;
 }
 
+bool Board::createBackupSnapshots(QList<SmartFileSnapshot>& snapshots,
+                                  QStringList& errors) noexcept
+{
+    bool success = true;
+
+    // Snapshot board XML file (only if modified since the last backup)
+    if (!mXmlFile->isModified(false)) return true;
+    try
+    {
+        if (mIsAddedToProject)
+        {
+            QSharedPointer<const XmlDomDocument> doc(
+                new XmlDomDocument(*serializeToXmlDomElement()));
+            snapshots.append(mXmlFile->createBackupSnapshot(doc));
+        }
+        else
+        {
+            mXmlFile->removeFile(false); // cheap, no need to defer it
+        }
+    }
+    catch (Exception& e)
+    {
+        success = false;
+        errors.append(e.getUserMsg());
+    }
+
+    return success;
+}
+
 void Board::showInView(GraphicsView& view) noexcept
 {
+    createGraphicsItems();
     view.setScene(mGraphicsScene.data());
 }
 
@@ -978,6 +1172,105 @@ void Board::updateErcMessages() noexcept
     }
 }
 
+void Board::addToSpatialIndex(BI_Device& device) noexcept
+{
+    BI_Footprint& footprint = device.getFootprint();
+    mFootprintsIndex.insert(&footprint);
+    foreach (BI_FootprintPad* pad, footprint.getPads()) {
+        mFootprintPadsIndex.insert(pad);
+    }
+}
+
+void Board::removeFromSpatialIndex(BI_Device& device) noexcept
+{
+    BI_Footprint& footprint = device.getFootprint();
+    mFootprintsIndex.remove(&footprint);
+    foreach (BI_FootprintPad* pad, footprint.getPads()) {
+        mFootprintPadsIndex.remove(pad);
+    }
+}
+
+void Board::processDeferredGraphicsItemUpdates() noexcept
+{
+    mDeferredGraphicsItemUpdateTimer.stop();
+    QHash<BI_Base*, QPointer<BI_Base>> items;
+    items.swap(mDeferredGraphicsItemUpdates);
+    foreach (const QPointer<BI_Base>& item, items) {
+        if (item) item->updateGraphicsItems();
+    }
+    triggerAirWiresRebuild();
+}
+
+void Board::rebuildAirWires(NetSignal& netsignal) noexcept
+{
+    // collect all pads, vias and netpoints of the net signal on this board
+    AirWiresBuilder builder;
+    QHash<const BI_Base*, int> pointIds;
+    foreach (const ComponentSignalInstance* cmpSig, netsignal.getComponentSignals()) {
+        foreach (const BI_FootprintPad* pad, cmpSig->getRegisteredFootprintPads()) {
+            if (&pad->getBoard() == this) {
+                pointIds.insert(pad, builder.addPoint(pad->getPosition()));
+            }
+        }
+    }
+    foreach (const BI_Via* via, netsignal.getBoardVias()) {
+        if (&via->getBoard() == this) {
+            pointIds.insert(via, builder.addPoint(via->getPosition()));
+        }
+    }
+    foreach (const BI_NetPoint* netpoint, netsignal.getBoardNetPoints()) {
+        if (&netpoint->getBoard() == this) {
+            pointIds.insert(netpoint, builder.addPoint(netpoint->getPosition()));
+        }
+    }
+
+    // netlines and attached netpoints connect them to islands
+    foreach (const BI_NetPoint* netpoint, netsignal.getBoardNetPoints()) {
+        int id = pointIds.value(netpoint, -1);
+        if (id < 0) continue;
+        const BI_Base* attachedTo = netpoint->getFootprintPad();
+        if (!attachedTo) attachedTo = netpoint->getVia();
+        int attachedId = pointIds.value(attachedTo, -1);
+        if (attachedId >= 0) builder.addEdge(id, attachedId);
+        foreach (const BI_NetLine* netline, netpoint->getLines()) {
+            int endId = pointIds.value(&netline->getEndPoint(), -1);
+            if ((&netline->getStartPoint() == netpoint) && (endId >= 0)) {
+                builder.addEdge(id, endId);
+            }
+        }
+    }
+
+    foreach (const AirWiresBuilder::AirWire& wire, builder.buildAirWires()) {
+        BI_AirWire* airwire = new BI_AirWire(*this, netsignal, builder.getPoint(wire.first),
+                                             builder.getPoint(wire.second));
+        try {
+            airwire->addToBoard(*mGraphicsScene); // can throw
+            mAirWires.insert(&netsignal, airwire);
+        } catch (Exception& e) {
+            qCritical() << "Could not add air wire:" << e.getUserMsg();
+            delete airwire;
+        }
+    }
+}
+
+void Board::removeAirWires(const NetSignal* netsignal) noexcept
+{
+    foreach (BI_AirWire* airwire, mAirWires.values(netsignal)) {
+        try {
+            airwire->removeFromBoard(*mGraphicsScene); // can throw
+        } catch (Exception& e) {
+            qCritical() << "Could not remove air wire:" << e.getUserMsg();
+        }
+        delete airwire;
+    }
+    mAirWires.remove(netsignal);
+}
+
+QRectF Board::getGrabAreaBoundingRect(const BI_Base& item) noexcept
+{
+    return item.getGrabAreaScenePx().boundingRect();
+}
+
 /*****************************************************************************************
  *  Static Methods
  ****************************************************************************************/
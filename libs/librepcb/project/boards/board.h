@@ -31,6 +31,7 @@
 #include <librepcb/common/fileio/filepath.h>
 #include <librepcb/common/exceptions.h>
 #include <librepcb/common/uuid.h>
+#include <librepcb/common/spatialindex.h>
 #include "../erc/if_ercmsgprovider.h"
 
 /*****************************************************************************************
@@ -42,6 +43,7 @@ class GridProperties;
 class GraphicsView;
 class GraphicsScene;
 class SmartXmlFile;
+class SmartFileSnapshot;
 class BoardLayer;
 class BoardDesignRules;
 
@@ -51,11 +53,13 @@ class NetSignal;
 class Project;
 class BI_Device;
 class BI_Base;
+class BI_Footprint;
 class BI_FootprintPad;
 class BI_Via;
 class BI_NetPoint;
 class BI_NetLine;
 class BI_Polygon;
+class BI_AirWire;
 class BoardLayerStack;
 
 /*****************************************************************************************
@@ -93,6 +97,7 @@ class Board final : public QObject, public IF_AttributeProvider,
             ZValue_FootprintPadsTop,    ///< Z value for #project#BI_FootprintPad items
             ZValue_FootprintsTop,       ///< Z value for #project#BI_Footprint items
             ZValue_Vias,                ///< Z value for #project#BI_Via items
+            ZValue_AirWires,            ///< Z value for #project#BI_AirWire items
         };
 
         // Constructors / Destructor
@@ -111,6 +116,8 @@ class Board final : public QObject, public IF_AttributeProvider,
         BoardDesignRules& getDesignRules() noexcept {return *mDesignRules;}
         const BoardDesignRules& getDesignRules() const noexcept {return *mDesignRules;}
         bool isEmpty() const noexcept;
+        bool hasGraphicsItems() const noexcept {return mHasGraphicsItems;}
+        GraphicsScene& getGraphicsScene() const noexcept {return *mGraphicsScene;}
         QList<BI_Base*> getSelectedItems(bool vias,
                                          bool footprintPads,
                                          bool floatingPoints,
@@ -169,10 +176,72 @@ class Board final : public QObject, public IF_AttributeProvider,
         void addPolygon(BI_Polygon& polygon) throw (Exception);
         void removePolygon(BI_Polygon& polygon) throw (Exception);
 
+        // Air Wire Methods
+        QList<BI_AirWire*> getAirWires() const noexcept {return mAirWires.values();}
+
+        /**
+         * @brief Mark the air wires of a net signal as outdated
+         *
+         * Must be called by the board items whenever they change something which affects
+         * the air wires of a net signal (position, connections or net signal). The air
+         * wires of all scheduled net signals are rebuilt together by
+         * #triggerAirWiresRebuild(), which is called automatically as soon as the event
+         * loop gets idle (or once per frame during an interactive move). All other net
+         * signals keep their air wires.
+         *
+         * Boards without graphics items (see Project#isModelOnly()) don't have air wires
+         * at all, they are built by #createGraphicsItems().
+         *
+         * @param netsignal     The net signal to rebuild (nullptr is ignored)
+         */
+        void scheduleAirWiresRebuild(NetSignal* netsignal) noexcept;
+        void triggerAirWiresRebuild() noexcept;
+
         // General Methods
+
+        /**
+         * @brief Notify the board that the grab area of an item has changed
+         *
+         * Must be called by the board items whenever their position or shape changes
+         * to keep the spatial index used by #getItemsAtScenePos() and friends up to date.
+         */
+        void itemGeometryChanged(BI_Base& item) noexcept;
+
+        /**
+         * @brief Start an interactive move of items (e.g. dragging with the mouse)
+         *
+         * While an interactive move is active, moved items only change the position of
+         * their graphics items (which is cheap) and postpone expensive recalculations
+         * of graphics items with #deferGraphicsItemUpdate(). The postponed updates (and
+         * scheduled air wire rebuilds) are processed once per frame and when the
+         * (outermost) interactive move ends.
+         */
+        void beginInteractiveMove() noexcept;
+        void endInteractiveMove() noexcept;
+        bool isInteractiveMoveActive() const noexcept {return mInteractiveMoveCounter > 0;}
+
+        /**
+         * @brief Postpone the update of the graphics items of an item
+         *
+         * Must only be called while an interactive move is active. Calls
+         * BI_Base#updateGraphicsItems() once for the item, no matter how often this
+         * method was called, at the latest when the interactive move ends.
+         */
+        void deferGraphicsItemUpdate(BI_Base& item) noexcept;
+
+        /**
+         * @brief Create the graphics items of all items of this board if not done yet
+         *
+         * Only needed if the project was opened in model-only mode (see
+         * Project#isModelOnly()), otherwise all graphics items already exist. Called
+         * automatically by #showInView().
+         */
+        void createGraphicsItems() noexcept;
         void addToProject() throw (Exception);
         void removeFromProject() throw (Exception);
+        void setModified() noexcept;
         bool save(bool toOriginal, QStringList& errors) noexcept;
+        bool createBackupSnapshots(QList<SmartFileSnapshot>& snapshots, QStringList& errors) noexcept;
         void showInView(GraphicsView& view) noexcept;
         void saveViewSceneRect(const QRectF& rect) noexcept {mViewRect = rect;}
         const QRectF& restoreViewSceneRect() const noexcept {return mViewRect;}
@@ -212,6 +281,12 @@ class Board final : public QObject, public IF_AttributeProvider,
         bool checkAttributesValidity() const noexcept override;
 
         void updateErcMessages() noexcept;
+        void addToSpatialIndex(BI_Device& device) noexcept;
+        void removeFromSpatialIndex(BI_Device& device) noexcept;
+        void processDeferredGraphicsItemUpdates() noexcept;
+        void rebuildAirWires(NetSignal& netsignal) noexcept;
+        void removeAirWires(const NetSignal* netsignal) noexcept;
+        static QRectF getGrabAreaBoundingRect(const BI_Base& item) noexcept;
 
         /// @copydoc IF_XmlSerializableObject#serializeToXmlDomElement()
         XmlDomElement* serializeToXmlDomElement() const throw (Exception) override;
@@ -222,6 +297,7 @@ class Board final : public QObject, public IF_AttributeProvider,
         FilePath mFilePath; ///< the filepath of the schematic *.xml file (from the ctor)
         QScopedPointer<SmartXmlFile> mXmlFile;
         bool mIsAddedToProject;
+        bool mHasGraphicsItems; ///< false until the graphics items are created
 
         QScopedPointer<GraphicsScene> mGraphicsScene;
         QScopedPointer<BoardLayerStack> mLayerStack;
@@ -241,6 +317,30 @@ class Board final : public QObject, public IF_AttributeProvider,
         QList<BI_NetLine*> mNetLines;
         QList<BI_Polygon*> mPolygons;
 
+        // UUID lookup tables of the items above (same content as the lists)
+        QHash<Uuid, BI_Via*> mViasByUuid;
+        QHash<Uuid, BI_NetPoint*> mNetPointsByUuid;
+        QHash<Uuid, BI_NetLine*> mNetLinesByUuid;
+
+        // spatial indexes of the items above (see #getItemsAtScenePos())
+        SpatialIndex<BI_Via> mViasIndex;
+        SpatialIndex<BI_NetPoint> mNetPointsIndex;
+        SpatialIndex<BI_NetLine> mNetLinesIndex;
+        SpatialIndex<BI_Footprint> mFootprintsIndex;
+        SpatialIndex<BI_FootprintPad> mFootprintPadsIndex;
+
+        // interactive move (see #beginInteractiveMove()), the QPointer values become
+        // null if an item gets deleted before its deferred update was processed
+        int mInteractiveMoveCounter;
+        QHash<BI_Base*, QPointer<BI_Base>> mDeferredGraphicsItemUpdates;
+        QTimer mDeferredGraphicsItemUpdateTimer;
+
+        // air wires (see #scheduleAirWiresRebuild()), the QPointer values become null if
+        // a net signal gets deleted before its air wires were rebuilt
+        QMultiHash<const NetSignal*, BI_AirWire*> mAirWires;
+        QHash<const NetSignal*, QPointer<NetSignal>> mScheduledNetSignalsForAirWireRebuild;
+        QTimer mAirWiresRebuildTimer;
+
         // ERC messages
         QHash<Uuid, ErcMsg*> mErcMsgListUnplacedComponentInstances;
 };
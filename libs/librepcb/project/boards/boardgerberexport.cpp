@@ -39,6 +39,7 @@
 #include "items/bi_netpoint.h"
 #include "items/bi_netline.h"
 #include "items/bi_polygon.h"
+#include <librepcb/common/fileio/fileutils.h>
 
 /*****************************************************************************************
  *  Namespace
@@ -46,12 +47,58 @@
 namespace librepcb {
 namespace project {
 
+/*****************************************************************************************
+ *  Class ExportTask
+ ****************************************************************************************/
+
+/**
+ * @brief Exports a single file in a thread of the QThreadPool
+ */
+class BoardGerberExport::ExportTask final : public QRunnable
+{
+    public:
+        ExportTask(const BoardGerberExport& exp, ExportFunction function,
+                   QMutex& errorMutex, QScopedPointer<Exception>& error) noexcept :
+            QRunnable(), mExport(exp), mFunction(function), mErrorMutex(errorMutex),
+            mError(error) {}
+
+        void run() noexcept override
+        {
+            try {
+                (mExport.*mFunction)(); // can throw
+            } catch (const Exception& e) {
+                setError(e.clone());
+            } catch (const std::exception& e) {
+                // exceptions must not leave the thread, so convert them to a RuntimeError
+                setError(new RuntimeError(__FILE__, __LINE__, QString(e.what()),
+                    QString(BoardGerberExport::tr("Failed to export file: %1")).arg(e.what())));
+            } catch (...) {
+                setError(new RuntimeError(__FILE__, __LINE__, QString(),
+                    BoardGerberExport::tr("Failed to export file: Unknown error.")));
+            }
+        }
+
+    private:
+        void setError(Exception* error) noexcept
+        {
+            QScopedPointer<Exception> errorScopeGuard(error);
+            QMutexLocker locker(&mErrorMutex);
+            if (!mError) mError.reset(errorScopeGuard.take()); // keep only the first error
+        }
+
+        const BoardGerberExport& mExport;
+        ExportFunction mFunction;
+        QMutex& mErrorMutex;
+        QScopedPointer<Exception>& mError;
+};
+
 /*****************************************************************************************
  *  Constructors / Destructor
  ****************************************************************************************/
 
 BoardGerberExport::BoardGerberExport(const Board& board, const FilePath& outputDir) noexcept :
-    mProject(board.getProject()), mBoard(board), mOutputDirectory(outputDir)
+    mProject(board.getProject()), mBoard(board), mOutputDirectory(outputDir),
+    mDrillPathOptimizationEnabled(false), mItems()
 {
 }
 
@@ -63,34 +110,81 @@ BoardGerberExport::~BoardGerberExport() noexcept
  *  General Methods
  ****************************************************************************************/
 
-void BoardGerberExport::exportAllLayers() const throw (Exception)
+void BoardGerberExport::exportAllLayers(int maxThreadCount) const throw (Exception)
 {
-    exportDrillsPTH();
-    exportLayerBoardOutlines();
-    exportLayerTopCopper();
-    exportLayerTopSolderMask();
-    exportLayerTopOverlay();
-    exportLayerBottomCopper();
-    exportLayerBottomSolderMask();
-    exportLayerBottomOverlay();
+    QList<ExportFunction> functions;
+    functions << &BoardGerberExport::exportDrillsPTH
+              << &BoardGerberExport::exportLayerBoardOutlines
+              << &BoardGerberExport::exportLayerTopCopper
+              << &BoardGerberExport::exportLayerTopSolderMask
+              << &BoardGerberExport::exportLayerTopOverlay
+              << &BoardGerberExport::exportLayerBottomCopper
+              << &BoardGerberExport::exportLayerBottomSolderMask
+              << &BoardGerberExport::exportLayerBottomOverlay;
+
+    // create the output directory once, not concurrently by all jobs
+    FileUtils::makePath(mOutputDirectory); // can throw
+    prepareItemBuckets();
+
+    QMutex errorMutex;
+    QScopedPointer<Exception> error;
+    if (maxThreadCount == 1) {
+        foreach (ExportFunction function, functions) {
+            ExportTask(*this, function, errorMutex, error).run();
+        }
+    } else {
+        QThreadPool pool;
+        pool.setMaxThreadCount((maxThreadCount > 0) ? maxThreadCount
+                                                    : qMax(QThread::idealThreadCount(), 1));
+        foreach (ExportFunction function, functions) {
+            pool.start(new ExportTask(*this, function, errorMutex, error)); // takes ownership
+        }
+        pool.waitForDone();
+    }
+    mItems = ItemBuckets(); // don't keep pointers to board items
+
+    if (error) {
+        error->raise();
+    }
 }
 
 /*****************************************************************************************
  *  Private Methods
  ****************************************************************************************/
 
+void BoardGerberExport::prepareItemBuckets() const noexcept
+{
+    mItems = ItemBuckets();
+    foreach (const BI_Device* device, mBoard.getDeviceInstances()) {
+        Q_ASSERT(device);
+        mItems.footprints.append(&device->getFootprint());
+    }
+    foreach (const BI_Via* via, mBoard.getVias()) {
+        Q_ASSERT(via);
+        mItems.vias.append(via);
+    }
+    foreach (const BI_NetLine* netline, mBoard.getNetLines()) {
+        Q_ASSERT(netline);
+        mItems.netLinesByLayer[netline->getLayer().getId()].append(netline);
+    }
+    foreach (const BI_Polygon* polygon, mBoard.getPolygons()) {
+        Q_ASSERT(polygon);
+        mItems.polygonsByLayer[polygon->getPolygon().getLayerId()].append(polygon);
+    }
+}
+
 void BoardGerberExport::exportDrillsPTH() const throw (Exception)
 {
     ExcellonGenerator gen;
+    gen.setDrillPathOptimizationEnabled(mDrillPathOptimizationEnabled);
 
     // footprint holes and pads
-    foreach (const BI_Device* device, mBoard.getDeviceInstances()) {
-        const BI_Footprint& footprint = device->getFootprint();
-        for (int i = 0; i < footprint.getLibFootprint().getHoleCount(); ++i) {
-            const Hole* hole = footprint.getLibFootprint().getHole(i); Q_ASSERT(hole);
-            gen.drill(footprint.mapToScene(hole->getPosition()), hole->getDiameter());
+    foreach (const BI_Footprint* footprint, mItems.footprints) {
+        for (int i = 0; i < footprint->getLibFootprint().getHoleCount(); ++i) {
+            const Hole* hole = footprint->getLibFootprint().getHole(i); Q_ASSERT(hole);
+            gen.drill(footprint->mapToScene(hole->getPosition()), hole->getDiameter());
         }
-        foreach (const BI_FootprintPad* pad, footprint.getPads()) {
+        foreach (const BI_FootprintPad* pad, footprint->getPads()) {
             const library::FootprintPad& libPad = pad->getLibPad();
             if (libPad.getTechnology() == library::FootprintPad::Technology_t::THT) {
                 const library::FootprintPadTht* tht = dynamic_cast<const library::FootprintPadTht*>(&libPad); Q_ASSERT(tht);
@@ -100,7 +194,7 @@ void BoardGerberExport::exportDrillsPTH() const throw (Exception)
     }
 
     // vias
-    foreach (const BI_Via* via, mBoard.getVias()) {
+    foreach (const BI_Via* via, mItems.vias) {
         gen.drill(via->getPosition(), via->getDrillDiameter());
     }
 
@@ -113,8 +207,7 @@ void BoardGerberExport::exportLayerBoardOutlines() const throw (Exception)
     GerberGenerator gen(mProject.getName() % " - " % mBoard.getName(),
                         mBoard.getUuid(), mProject.getVersion());
     drawLayer(gen, BoardLayer::BoardOutlines);
-    gen.generate();
-    gen.saveToFile(getOutputFilePath("OUTLINES.gbr"));
+    gen.generateToFile(getOutputFilePath("OUTLINES.gbr"));
 }
 
 void BoardGerberExport::exportLayerTopCopper() const throw (Exception)
@@ -122,8 +215,7 @@ void BoardGerberExport::exportLayerTopCopper() const throw (Exception)
     GerberGenerator gen(mProject.getName() % " - " % mBoard.getName(),
                         mBoard.getUuid(), mProject.getVersion());
     drawLayer(gen, BoardLayer::TopCopper);
-    gen.generate();
-    gen.saveToFile(getOutputFilePath("COPPER-TOP.gbr"));
+    gen.generateToFile(getOutputFilePath("COPPER-TOP.gbr"));
 }
 
 void BoardGerberExport::exportLayerTopSolderMask() const throw (Exception)
@@ -131,8 +223,7 @@ void BoardGerberExport::exportLayerTopSolderMask() const throw (Exception)
     GerberGenerator gen(mProject.getName() % " - " % mBoard.getName(),
                         mBoard.getUuid(), mProject.getVersion());
     drawLayer(gen, BoardLayer::TopStopMask);
-    gen.generate();
-    gen.saveToFile(getOutputFilePath("SOLDERMASK-TOP.gbr"));
+    gen.generateToFile(getOutputFilePath("SOLDERMASK-TOP.gbr"));
 }
 
 void BoardGerberExport::exportLayerTopOverlay() const throw (Exception)
@@ -142,8 +233,7 @@ void BoardGerberExport::exportLayerTopOverlay() const throw (Exception)
     drawLayer(gen, BoardLayer::TopOverlay);
     gen.setLayerPolarity(GerberGenerator::LayerPolarity::Negative);
     drawLayer(gen, BoardLayer::TopStopMask);
-    gen.generate();
-    gen.saveToFile(getOutputFilePath("SILKSCREEN-TOP.gbr"));
+    gen.generateToFile(getOutputFilePath("SILKSCREEN-TOP.gbr"));
 }
 
 void BoardGerberExport::exportLayerBottomCopper() const throw (Exception)
@@ -151,8 +241,7 @@ void BoardGerberExport::exportLayerBottomCopper() const throw (Exception)
     GerberGenerator gen(mProject.getName() % " - " % mBoard.getName(),
                         mBoard.getUuid(), mProject.getVersion());
     drawLayer(gen, BoardLayer::BottomCopper);
-    gen.generate();
-    gen.saveToFile(getOutputFilePath("COPPER-BOTTOM.gbr"));
+    gen.generateToFile(getOutputFilePath("COPPER-BOTTOM.gbr"));
 }
 
 void BoardGerberExport::exportLayerBottomSolderMask() const throw (Exception)
@@ -160,8 +249,7 @@ void BoardGerberExport::exportLayerBottomSolderMask() const throw (Exception)
     GerberGenerator gen(mProject.getName() % " - " % mBoard.getName(),
                         mBoard.getUuid(), mProject.getVersion());
     drawLayer(gen, BoardLayer::BottomStopMask);
-    gen.generate();
-    gen.saveToFile(getOutputFilePath("SOLDERMASK-BOTTOM.gbr"));
+    gen.generateToFile(getOutputFilePath("SOLDERMASK-BOTTOM.gbr"));
 }
 
 void BoardGerberExport::exportLayerBottomOverlay() const throw (Exception)
@@ -171,42 +259,33 @@ void BoardGerberExport::exportLayerBottomOverlay() const throw (Exception)
     drawLayer(gen, BoardLayer::BottomOverlay);
     gen.setLayerPolarity(GerberGenerator::LayerPolarity::Negative);
     drawLayer(gen, BoardLayer::BottomStopMask);
-    gen.generate();
-    gen.saveToFile(getOutputFilePath("SILKSCREEN-BOTTOM.gbr"));
+    gen.generateToFile(getOutputFilePath("SILKSCREEN-BOTTOM.gbr"));
 }
 
 void BoardGerberExport::drawLayer(GerberGenerator& gen, int layerId) const throw (Exception)
 {
     // draw footprints incl. pads
-    foreach (const BI_Device* device, mBoard.getDeviceInstances()) {
-        Q_ASSERT(device);
-        drawFootprint(gen, device->getFootprint(), layerId);
+    foreach (const BI_Footprint* footprint, mItems.footprints) {
+        drawFootprint(gen, *footprint, layerId);
     }
 
     // draw vias
-    foreach (const BI_Via* via, mBoard.getVias()) {
-        Q_ASSERT(via);
+    foreach (const BI_Via* via, mItems.vias) {
         drawVia(gen, *via, layerId);
     }
 
     // draw traces
-    foreach (const BI_NetLine* netline, mBoard.getNetLines()) {
-        Q_ASSERT(netline);
-        if (netline->getLayer().getId() == layerId) {
-            gen.drawLine(netline->getStartPoint().getPosition(),
-                         netline->getEndPoint().getPosition(),
-                         netline->getWidth());
-        }
+    foreach (const BI_NetLine* netline, mItems.netLinesByLayer.value(layerId)) {
+        gen.drawLine(netline->getStartPoint().getPosition(),
+                     netline->getEndPoint().getPosition(),
+                     netline->getWidth());
     }
 
     // draw polygons
-    foreach (const BI_Polygon* polygon, mBoard.getPolygons()) {
-        Q_ASSERT(polygon);
-        if (layerId == polygon->getPolygon().getLayerId()) {
-            Polygon p(polygon->getPolygon());
-            p.setLineWidth(calcWidthOfLayer(polygon->getPolygon().getLineWidth(), layerId));
-            gen.drawPolygonOutline(p);
-        }
+    foreach (const BI_Polygon* polygon, mItems.polygonsByLayer.value(layerId)) {
+        Polygon p(polygon->getPolygon());
+        p.setLineWidth(calcWidthOfLayer(polygon->getPolygon().getLineWidth(), layerId));
+        gen.drawPolygonOutline(p);
     }
 }
 
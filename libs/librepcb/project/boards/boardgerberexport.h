@@ -42,6 +42,8 @@ namespace project {
 class Project;
 class Board;
 class BI_Via;
+class BI_NetLine;
+class BI_Polygon;
 class BI_Footprint;
 class BI_FootprintPad;
 
@@ -67,8 +69,30 @@ class BoardGerberExport final : public QObject
         BoardGerberExport(const Board& board, const FilePath& outputDir) noexcept;
         ~BoardGerberExport() noexcept;
 
+        // Setters
+
+        /**
+         * @brief Enable or disable the optimization of the drill order in the Excellon file
+         *
+         * Disabled by default. See ExcellonGenerator::setDrillPathOptimizationEnabled().
+         */
+        void setDrillPathOptimizationEnabled(bool enabled) noexcept {mDrillPathOptimizationEnabled = enabled;}
+
         // General Methods
-        void exportAllLayers() const throw (Exception);
+
+        /**
+         * @brief Export the drill file and all Gerber layers
+         *
+         * The files are independent of each other, so they are generated concurrently
+         * on a thread pool. The board must not be modified until this method returns.
+         *
+         * @param maxThreadCount    Maximum count of worker threads (-1 means one thread
+         *                          per CPU core, 1 exports all files in the caller thread)
+         *
+         * @throw Exception If a file could not be exported (if several files failed, the
+         *                  first error is thrown after all files were processed)
+         */
+        void exportAllLayers(int maxThreadCount = -1) const throw (Exception);
 
         // Operator Overloadings
         BoardGerberExport& operator=(const BoardGerberExport& rhs) = delete;
@@ -76,7 +100,20 @@ class BoardGerberExport final : public QObject
 
     private:
 
+        // Private Types
+        class ExportTask;
+        typedef void (BoardGerberExport::*ExportFunction)() const;
+
+        /// Board items sorted by layer, shared (read-only) by all export jobs
+        struct ItemBuckets {
+            QList<const BI_Footprint*> footprints;
+            QList<const BI_Via*> vias;
+            QHash<int, QList<const BI_NetLine*>> netLinesByLayer;
+            QHash<int, QList<const BI_Polygon*>> polygonsByLayer;
+        };
+
         // Private Methods
+        void prepareItemBuckets() const noexcept;
         void exportDrillsPTH() const throw (Exception);
         void exportLayerBoardOutlines() const throw (Exception);
         void exportLayerTopCopper() const throw (Exception);
@@ -101,6 +138,8 @@ class BoardGerberExport final : public QObject
         const Project& mProject;
         const Board& mBoard;
         FilePath mOutputDirectory;
+        bool mDrillPathOptimizationEnabled;
+        mutable ItemBuckets mItems; ///< filled by #prepareItemBuckets()
 };
 
 /*****************************************************************************************
@@ -71,11 +71,15 @@ bool CmdBoardAdd::performExecute() throw (Exception)
 
 void CmdBoardAdd::performUndo() throw (Exception)
 {
+    mProject.setModified();
+    mBoard->setModified();
     mProject.removeBoard(*mBoard); // can throw
 }
 
 void CmdBoardAdd::performRedo() throw (Exception)
 {
+    mProject.setModified();
+    mBoard->setModified();
     mProject.addBoard(*mBoard, mPageIndex); // can throw
 }
 
@@ -48,6 +48,14 @@ CmdBoardDesignRulesModify::~CmdBoardDesignRulesModify() noexcept
  *  Inherited from UndoCommand
  ****************************************************************************************/
 
+qint64 CmdBoardDesignRulesModify::getApproxMemoryUsage() const noexcept
+{
+    return UndoCommand::getApproxMemoryUsage() + 2 * sizeof(BoardDesignRules) +
+           (mOldRules.getName().capacity() + mNewRules.getName().capacity() +
+            mOldRules.getDescription().capacity() + mNewRules.getDescription().capacity()) *
+           sizeof(QChar);
+}
+
 bool CmdBoardDesignRulesModify::performExecute() throw (Exception)
 {
     mOldRules = mBoard.getDesignRules(); // memorize current design rules
@@ -59,12 +67,14 @@ bool CmdBoardDesignRulesModify::performExecute() throw (Exception)
 
 void CmdBoardDesignRulesModify::performUndo() throw (Exception)
 {
+    mBoard.setModified();
     mBoard.getDesignRules() = mOldRules;
     emit mBoard.attributesChanged();
 }
 
 void CmdBoardDesignRulesModify::performRedo() throw (Exception)
 {
+    mBoard.setModified();
     mBoard.getDesignRules() = mNewRules;
     emit mBoard.attributesChanged();
 }
@@ -52,6 +52,11 @@ class CmdBoardDesignRulesModify final : public UndoCommand
         CmdBoardDesignRulesModify(Board& board, const BoardDesignRules& newRules) noexcept;
         ~CmdBoardDesignRulesModify() noexcept;
 
+        // Inherited from UndoCommand
+
+        /// @copydoc UndoCommand::getApproxMemoryUsage()
+        qint64 getApproxMemoryUsage() const noexcept override;
+
 
     private:
 
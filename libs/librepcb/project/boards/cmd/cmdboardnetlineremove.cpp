@@ -58,11 +58,13 @@ bool CmdBoardNetLineRemove::performExecute() throw (Exception)
 
 void CmdBoardNetLineRemove::performUndo() throw (Exception)
 {
+    mBoard.setModified();
     mBoard.addNetLine(mNetLine); // can throw
 }
 
 void CmdBoardNetLineRemove::performRedo() throw (Exception)
 {
+    mBoard.setModified();
     mBoard.removeNetLine(mNetLine); // can throw
 }
 
@@ -22,6 +22,7 @@
  ****************************************************************************************/
 #include <QtCore>
 #include "cmdboardnetpointedit.h"
+#include "../board.h"
 #include <librepcb/common/scopeguardlist.h>
 #include "../items/bi_netpoint.h"
 #include "../items/bi_footprintpad.h"
@@ -102,6 +103,20 @@ void CmdBoardNetPointEdit::setDeltaToStartPos(const Point& deltaPos, bool immedi
  *  Inherited from UndoCommand
  ****************************************************************************************/
 
+bool CmdBoardNetPointEdit::mergeWith(const UndoCommand& other) noexcept
+{
+    // merge only consecutive edits of the same netpoint
+    const CmdBoardNetPointEdit* cmd = dynamic_cast<const CmdBoardNetPointEdit*>(&other);
+    if ((!cmd) || (&cmd->mNetPoint != &mNetPoint)) return false;
+    Q_ASSERT(wasEverExecuted() && cmd->wasEverExecuted());
+    mNewLayer = cmd->mNewLayer;
+    mNewNetSignal = cmd->mNewNetSignal;
+    mNewFootprintPad = cmd->mNewFootprintPad;
+    mNewVia = cmd->mNewVia;
+    mNewPos = cmd->mNewPos;
+    return true;
+}
+
 bool CmdBoardNetPointEdit::performExecute() throw (Exception)
 {
     performRedo(); // can throw
@@ -111,6 +126,7 @@ bool CmdBoardNetPointEdit::performExecute() throw (Exception)
 
 void CmdBoardNetPointEdit::performUndo() throw (Exception)
 {
+    mNetPoint.getBoard().setModified();
     ScopeGuardList sgl;
     mNetPoint.setLayer(*mOldLayer); // can throw
     sgl.add([&](){mNetPoint.setLayer(*mNewLayer);});
@@ -126,6 +142,7 @@ void CmdBoardNetPointEdit::performUndo() throw (Exception)
 
 void CmdBoardNetPointEdit::performRedo() throw (Exception)
 {
+    mNetPoint.getBoard().setModified();
     ScopeGuardList sgl;
     mNetPoint.setLayer(*mNewLayer); // can throw
     sgl.add([&](){mNetPoint.setLayer(*mOldLayer);});
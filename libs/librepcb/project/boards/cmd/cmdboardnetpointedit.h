@@ -56,6 +56,9 @@ class CmdBoardNetPointEdit final : public UndoCommand
         explicit CmdBoardNetPointEdit(BI_NetPoint& point) noexcept;
         ~CmdBoardNetPointEdit() noexcept;
 
+        // Getters
+        BI_NetPoint& getNetPoint() const noexcept {return mNetPoint;}
+
         // Setters
         void setLayer(BoardLayer& layer) noexcept;
         void setNetSignal(NetSignal& netsignal) noexcept;
@@ -65,6 +68,12 @@ class CmdBoardNetPointEdit final : public UndoCommand
         void setDeltaToStartPos(const Point& deltaPos, bool immediate) noexcept;
 
 
+        // Inherited from UndoCommand
+
+        /// @copydoc UndoCommand::mergeWith()
+        bool mergeWith(const UndoCommand& other) noexcept override;
+
+
     private:
 
         // Private Methods
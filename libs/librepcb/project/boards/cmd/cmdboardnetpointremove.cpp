@@ -58,11 +58,13 @@ bool CmdBoardNetPointRemove::performExecute() throw (Exception)
 
 void CmdBoardNetPointRemove::performUndo() throw (Exception)
 {
+    mBoard.setModified();
     mBoard.addNetPoint(mNetPoint); // can throw
 }
 
 void CmdBoardNetPointRemove::performRedo() throw (Exception)
 {
+    mBoard.setModified();
     mBoard.removeNetPoint(mNetPoint); // can throw
 }
 
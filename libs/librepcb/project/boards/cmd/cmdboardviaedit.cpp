@@ -22,6 +22,7 @@
  ****************************************************************************************/
 #include <QtCore>
 #include "cmdboardviaedit.h"
+#include "../board.h"
 #include "../items/bi_via.h"
 
 /*****************************************************************************************
@@ -109,6 +110,20 @@ void CmdBoardViaEdit::setDrillDiameter(const Length& diameter, bool immediate) n
  *  Inherited from UndoCommand
  ****************************************************************************************/
 
+bool CmdBoardViaEdit::mergeWith(const UndoCommand& other) noexcept
+{
+    // merge only consecutive edits of the same via
+    const CmdBoardViaEdit* cmd = dynamic_cast<const CmdBoardViaEdit*>(&other);
+    if ((!cmd) || (&cmd->mVia != &mVia)) return false;
+    Q_ASSERT(wasEverExecuted() && cmd->wasEverExecuted());
+    mNewNetSignal = cmd->mNewNetSignal;
+    mNewPos = cmd->mNewPos;
+    mNewShape = cmd->mNewShape;
+    mNewSize = cmd->mNewSize;
+    mNewDrillDiameter = cmd->mNewDrillDiameter;
+    return true;
+}
+
 bool CmdBoardViaEdit::performExecute() throw (Exception)
 {
     performRedo(); // can throw
@@ -118,6 +133,7 @@ bool CmdBoardViaEdit::performExecute() throw (Exception)
 
 void CmdBoardViaEdit::performUndo() throw (Exception)
 {
+    mVia.getBoard().setModified();
     mVia.setNetSignal(mOldNetSignal); // can throw
     mVia.setPosition(mOldPos);
     mVia.setShape(mOldShape);
@@ -127,6 +143,7 @@ void CmdBoardViaEdit::performUndo() throw (Exception)
 
 void CmdBoardViaEdit::performRedo() throw (Exception)
 {
+    mVia.getBoard().setModified();
     mVia.setNetSignal(mNewNetSignal); // can throw
     mVia.setPosition(mNewPos);
     mVia.setShape(mNewShape);
@@ -51,6 +51,9 @@ class CmdBoardViaEdit final : public UndoCommand
         explicit CmdBoardViaEdit(BI_Via& via) noexcept;
         ~CmdBoardViaEdit() noexcept;
 
+        // Getters
+        BI_Via& getVia() const noexcept {return mVia;}
+
         // Setters
         void setNetSignal(NetSignal* netsignal, bool immediate) throw (Exception);
         void setPosition(const Point& pos, bool immediate) noexcept;
@@ -60,6 +63,12 @@ class CmdBoardViaEdit final : public UndoCommand
         void setDrillDiameter(const Length& diameter, bool immediate) noexcept;
 
 
+        // Inherited from UndoCommand
+
+        /// @copydoc UndoCommand::mergeWith()
+        bool mergeWith(const UndoCommand& other) noexcept override;
+
+
     private:
 
         // Private Methods
@@ -58,11 +58,13 @@ bool CmdBoardViaRemove::performExecute() throw (Exception)
 
 void CmdBoardViaRemove::performUndo() throw (Exception)
 {
+    mBoard.setModified();
     mBoard.addVia(mVia); // can throw
 }
 
 void CmdBoardViaRemove::performRedo() throw (Exception)
 {
+    mBoard.setModified();
     mBoard.removeVia(mVia); // can throw
 }
 
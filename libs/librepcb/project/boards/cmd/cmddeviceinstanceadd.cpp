@@ -73,11 +73,13 @@ bool CmdDeviceInstanceAdd::performExecute() throw (Exception)
 
 void CmdDeviceInstanceAdd::performUndo() throw (Exception)
 {
+    mBoard.setModified();
     mBoard.removeDeviceInstance(*mDeviceInstance);
 }
 
 void CmdDeviceInstanceAdd::performRedo() throw (Exception)
 {
+    mBoard.setModified();
     mBoard.addDeviceInstance(*mDeviceInstance);
 }
 
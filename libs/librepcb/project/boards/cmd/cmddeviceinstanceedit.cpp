@@ -22,6 +22,7 @@
  ****************************************************************************************/
 #include <QtCore>
 #include "cmddeviceinstanceedit.h"
+#include "../board.h"
 #include "../items/bi_device.h"
 
 /*****************************************************************************************
@@ -137,6 +138,18 @@ void CmdDeviceInstanceEdit::mirror(const Point& center, Qt::Orientation orientat
  *  Inherited from UndoCommand
  ****************************************************************************************/
 
+bool CmdDeviceInstanceEdit::mergeWith(const UndoCommand& other) noexcept
+{
+    // merge only consecutive edits of the same device
+    const CmdDeviceInstanceEdit* cmd = dynamic_cast<const CmdDeviceInstanceEdit*>(&other);
+    if ((!cmd) || (&cmd->mDevice != &mDevice)) return false;
+    Q_ASSERT(wasEverExecuted() && cmd->wasEverExecuted());
+    mNewPos = cmd->mNewPos;
+    mNewRotation = cmd->mNewRotation;
+    mNewMirrored = cmd->mNewMirrored;
+    return true;
+}
+
 bool CmdDeviceInstanceEdit::performExecute() throw (Exception)
 {
     performRedo(); // can throw
@@ -146,6 +159,7 @@ bool CmdDeviceInstanceEdit::performExecute() throw (Exception)
 
 void CmdDeviceInstanceEdit::performUndo() throw (Exception)
 {
+    mDevice.getBoard().setModified();
     mDevice.setIsMirrored(mOldMirrored); // can throw
     mDevice.setPosition(mOldPos);
     mDevice.setRotation(mOldRotation);
@@ -153,6 +167,7 @@ void CmdDeviceInstanceEdit::performUndo() throw (Exception)
 
 void CmdDeviceInstanceEdit::performRedo() throw (Exception)
 {
+    mDevice.getBoard().setModified();
     mDevice.setIsMirrored(mNewMirrored); // can throw
     mDevice.setPosition(mNewPos);
     mDevice.setRotation(mNewRotation);
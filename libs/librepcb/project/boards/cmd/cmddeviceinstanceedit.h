@@ -50,6 +50,9 @@ class CmdDeviceInstanceEdit final : public UndoCommand
         explicit CmdDeviceInstanceEdit(BI_Device& dev) noexcept;
         ~CmdDeviceInstanceEdit() noexcept;
 
+        // Getters
+        BI_Device& getDevice() const noexcept {return mDevice;}
+
         // General Methods
         void setPosition(Point& pos, bool immediate) noexcept;
         void setDeltaToStartPos(Point& deltaPos, bool immediate) noexcept;
@@ -59,6 +62,12 @@ class CmdDeviceInstanceEdit final : public UndoCommand
         void mirror(const Point& center, Qt::Orientation orientation, bool immediate) throw (Exception);
 
 
+        // Inherited from UndoCommand
+
+        /// @copydoc UndoCommand::mergeWith()
+        bool mergeWith(const UndoCommand& other) noexcept override;
+
+
     private:
 
         // Private Methods
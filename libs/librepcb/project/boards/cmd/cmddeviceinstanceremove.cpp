@@ -58,11 +58,13 @@ bool CmdDeviceInstanceRemove::performExecute() throw (Exception)
 
 void CmdDeviceInstanceRemove::performUndo() throw (Exception)
 {
+    mBoard.setModified();
     mBoard.addDeviceInstance(mDevice); // can throw
 }
 
 void CmdDeviceInstanceRemove::performRedo() throw (Exception)
 {
+    mBoard.setModified();
     mBoard.removeDeviceInstance(mDevice); // can throw
 }
 
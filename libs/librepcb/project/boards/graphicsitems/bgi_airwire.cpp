@@ -0,0 +1,89 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <QtWidgets>
+#include "bgi_airwire.h"
+#include "../items/bi_airwire.h"
+#include "../board.h"
+#include "../boardlayerstack.h"
+#include <librepcb/common/boardlayer.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace project {
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+BGI_AirWire::BGI_AirWire(BI_AirWire& airwire) noexcept :
+    BGI_Base(), mAirWire(airwire), mLayer(nullptr)
+{
+    setZValue(Board::ZValue_AirWires);
+    mLayer = mAirWire.getBoard().getLayerStack().getBoardLayer(BoardLayer::Unrouted);
+    Q_ASSERT(mLayer);
+    updateCacheAndRepaint();
+}
+
+BGI_AirWire::~BGI_AirWire() noexcept
+{
+}
+
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+void BGI_AirWire::updateCacheAndRepaint() noexcept
+{
+    prepareGeometryChange();
+    mLineF.setP1(mAirWire.getP1().toPxQPointF());
+    mLineF.setP2(mAirWire.getP2().toPxQPointF());
+    mBoundingRect = QRectF(mLineF.p1(), mLineF.p2()).normalized();
+    mBoundingRect.adjust(-1, -1, 1, 1); // the cosmetic pen is one pixel wide
+    update();
+}
+
+/*****************************************************************************************
+ *  Inherited from QGraphicsItem
+ ****************************************************************************************/
+
+void BGI_AirWire::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget)
+{
+    Q_UNUSED(option);
+    Q_UNUSED(widget);
+
+    if (mLayer && mLayer->isVisible()) {
+        painter->setPen(QPen(mLayer->getColor(false), 0)); // cosmetic pen
+        painter->drawLine(mLineF);
+    }
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace project
+} // namespace librepcb
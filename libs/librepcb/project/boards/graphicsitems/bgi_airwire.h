@@ -0,0 +1,92 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef LIBREPCB_PROJECT_BGI_AIRWIRE_H
+#define LIBREPCB_PROJECT_BGI_AIRWIRE_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <QtWidgets>
+#include "bgi_base.h"
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+
+class BoardLayer;
+
+namespace project {
+
+class BI_AirWire;
+
+/*****************************************************************************************
+ *  Class BGI_AirWire
+ ****************************************************************************************/
+
+/**
+ * @brief The BGI_AirWire class
+ *
+ * Air wires are drawn as thin lines on the "unrouted" layer. They have an empty shape,
+ * so they can't be grabbed with the mouse.
+ */
+class BGI_AirWire final : public BGI_Base
+{
+    public:
+
+        // Constructors / Destructor
+        explicit BGI_AirWire(BI_AirWire& airwire) noexcept;
+        ~BGI_AirWire() noexcept;
+
+        // General Methods
+        void updateCacheAndRepaint() noexcept;
+
+        // Inherited from QGraphicsItem
+        QRectF boundingRect() const {return mBoundingRect;}
+        QPainterPath shape() const {return QPainterPath();}
+        void paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget);
+
+
+    private:
+
+        // make some methods inaccessible...
+        BGI_AirWire() = delete;
+        BGI_AirWire(const BGI_AirWire& other) = delete;
+        BGI_AirWire& operator=(const BGI_AirWire& rhs) = delete;
+
+        // Attributes
+        BI_AirWire& mAirWire;
+        BoardLayer* mLayer;
+
+        // Cached Attributes
+        QLineF mLineF;
+        QRectF mBoundingRect;
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace project
+} // namespace librepcb
+
+#endif // LIBREPCB_PROJECT_BGI_AIRWIRE_H
@@ -38,6 +38,13 @@
 namespace librepcb {
 namespace project {
 
+/*****************************************************************************************
+ *  Static Variables
+ ****************************************************************************************/
+
+QHash<BGI_Footprint::SharedGeometryKey_t, QWeakPointer<const BGI_Footprint::SharedGeometry_t>>
+    BGI_Footprint::sSharedGeometries;
+
 /*****************************************************************************************
  *  Constructors / Destructor
  ****************************************************************************************/
@@ -75,45 +82,17 @@ void BGI_Footprint::updateCacheAndRepaint() noexcept
     BoardLayer* layer = nullptr;
     prepareGeometryChange();
 
-    mBoundingRect = QRectF();
-    mShape = QPainterPath();
-
     // set Z value
     if (mFootprint.getIsMirrored())
         setZValue(Board::ZValue_FootprintsBottom);
     else
         setZValue(Board::ZValue_FootprintsTop);
 
-    // cross rect
-    layer = getBoardLayer(BoardLayer::LayerID::TopDeviceOriginCrosses);
-    if (layer) {
-        if (layer->isVisible()) {
-            qreal width = Length(700000).toPx();
-            QRectF crossRect(-width, -width, 2*width, 2*width);
-            mBoundingRect = mBoundingRect.united(crossRect);
-            mShape.addRect(crossRect);
-        }
-    }
-
-    // polygons
-    for (int i = 0; i < mLibFootprint.getPolygonCount(); i++) {
-        const Polygon* polygon = mLibFootprint.getPolygon(i);
-        Q_ASSERT(polygon); if (!polygon) continue;
-        layer = getBoardLayer(polygon->getLayerId());
-        if (!layer) continue;
-        if (!layer->isVisible()) continue;
-
-        QPainterPath polygonPath = polygon->toQPainterPathPx();
-        qreal w = polygon->getLineWidth().toPx() / 2;
-        mBoundingRect = mBoundingRect.united(polygonPath.boundingRect().adjusted(-w, -w, w, w));
-        if (!polygon->isGrabArea()) continue;
-        layer = getBoardLayer(BoardLayer::LayerID::TopDeviceGrabAreas);
-        if (!layer) continue;
-        if (!layer->isVisible()) continue;
-        mShape = mShape.united(polygonPath);
-    }
+    // origin cross and polygons
+    mSharedGeometry = getSharedGeometry();
+    mBoundingRect = mSharedGeometry->boundingRect;
 
-    // texts
+    // texts (depend on the attributes and the rotation of this instance)
     mCachedTextProperties.clear();
     for (int i = 0; i < mLibFootprint.getTextCount(); i++) {
         const Text* text = mLibFootprint.getText(i);
@@ -167,9 +146,6 @@ void BGI_Footprint::updateCacheAndRepaint() noexcept
         mCachedTextProperties.insert(text, props);
     }
 
-    if (!mShape.isEmpty())
-        mShape.setFillRule(Qt::WindingFill);
-
     setVisible(!mBoundingRect.isEmpty());
 
     update();
@@ -362,6 +338,63 @@ BoardLayer* BGI_Footprint::getBoardLayer(int id) const noexcept
     return mFootprint.getDeviceInstance().getBoard().getLayerStack().getBoardLayer(id);
 }
 
+QSharedPointer<const BGI_Footprint::SharedGeometry_t> BGI_Footprint::getSharedGeometry() const noexcept
+{
+    // the geometry depends only on the library footprint and the visibility of the layers
+    const int firstPolygonBit = 2;
+    BoardLayer* crossLayer = getBoardLayer(BoardLayer::LayerID::TopDeviceOriginCrosses);
+    BoardLayer* grabAreaLayer = getBoardLayer(BoardLayer::LayerID::TopDeviceGrabAreas);
+    QBitArray visibleLayers(firstPolygonBit + mLibFootprint.getPolygonCount());
+    visibleLayers.setBit(0, crossLayer && crossLayer->isVisible());
+    visibleLayers.setBit(1, grabAreaLayer && grabAreaLayer->isVisible());
+    for (int i = 0; i < mLibFootprint.getPolygonCount(); i++) {
+        const Polygon* polygon = mLibFootprint.getPolygon(i);
+        BoardLayer* layer = polygon ? getBoardLayer(polygon->getLayerId()) : nullptr;
+        visibleLayers.setBit(firstPolygonBit + i, layer && layer->isVisible());
+    }
+
+    // reuse the geometry of another instance, if available
+    SharedGeometryKey_t key(&mLibFootprint, visibleLayers);
+    QSharedPointer<const SharedGeometry_t> cached = sSharedGeometries.value(key).toStrongRef();
+    if (cached) return cached;
+
+    SharedGeometry_t* geometry = new SharedGeometry_t();
+
+    // cross rect
+    if (visibleLayers.testBit(0)) {
+        qreal width = Length(700000).toPx();
+        QRectF crossRect(-width, -width, 2*width, 2*width);
+        geometry->boundingRect = geometry->boundingRect.united(crossRect);
+        geometry->shape.addRect(crossRect);
+    }
+
+    // polygons
+    for (int i = 0; i < mLibFootprint.getPolygonCount(); i++) {
+        const Polygon* polygon = mLibFootprint.getPolygon(i);
+        Q_ASSERT(polygon); if (!polygon) continue;
+        if (!visibleLayers.testBit(firstPolygonBit + i)) continue;
+
+        const QPainterPath& polygonPath = polygon->toQPainterPathPx();
+        qreal w = polygon->getLineWidth().toPx() / 2;
+        geometry->boundingRect = geometry->boundingRect.united(
+            polygonPath.boundingRect().adjusted(-w, -w, w, w));
+        if (!polygon->isGrabArea()) continue;
+        if (!visibleLayers.testBit(1)) continue;
+        geometry->shape = geometry->shape.united(polygonPath);
+    }
+
+    if (!geometry->shape.isEmpty())
+        geometry->shape.setFillRule(Qt::WindingFill);
+
+    // the entry is removed from the cache as soon as the last instance releases it
+    cached = QSharedPointer<const SharedGeometry_t>(geometry, [key](SharedGeometry_t* obj){
+        if (sSharedGeometries.value(key).isNull()) sSharedGeometries.remove(key);
+        delete obj;
+    });
+    sSharedGeometries.insert(key, cached);
+    return cached;
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
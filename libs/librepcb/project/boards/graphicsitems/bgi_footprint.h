@@ -69,7 +69,7 @@ class BGI_Footprint final : public BGI_Base
 
         // Inherited from QGraphicsItem
         QRectF boundingRect() const noexcept {return mBoundingRect;}
-        QPainterPath shape() const noexcept {return mShape;}
+        QPainterPath shape() const noexcept {return mSharedGeometry->shape;}
         void paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget = 0);
 
 
@@ -80,12 +80,27 @@ class BGI_Footprint final : public BGI_Base
         BGI_Footprint(const BGI_Footprint& other) = delete;
         BGI_Footprint& operator=(const BGI_Footprint& rhs) = delete;
 
+        // Types
+
+        /**
+         * @brief Geometry which depends only on the library footprint and layer visibility
+         *
+         * All instances of the same library footprint share this geometry (the position,
+         * rotation and mirroring is applied by the transformation of the graphics item),
+         * so the (expensive) union of the grab areas is calculated only once.
+         */
+        struct SharedGeometry_t {
+            QRectF boundingRect;    // without texts
+            QPainterPath shape;
+        };
+        typedef QPair<const library::Footprint*, QBitArray> SharedGeometryKey_t;
+
+
         // Private Methods
         BoardLayer* getBoardLayer(int id) const noexcept;
+        QSharedPointer<const SharedGeometry_t> getSharedGeometry() const noexcept;
 
 
-        // Types
-
         struct CachedTextProperties_t {
             QString text;
             int fontPixelSize;
@@ -103,8 +118,11 @@ class BGI_Footprint final : public BGI_Base
 
         // Cached Attributes
         QRectF mBoundingRect;
-        QPainterPath mShape;
+        QSharedPointer<const SharedGeometry_t> mSharedGeometry;
         QHash<const Text*, CachedTextProperties_t> mCachedTextProperties;
+
+        // Static Variables
+        static QHash<SharedGeometryKey_t, QWeakPointer<const SharedGeometry_t>> sSharedGeometries;
 };
 
 /*****************************************************************************************
@@ -86,20 +86,28 @@ void BI_Base::removeFromBoard() noexcept
     mIsAddedToBoard = false;
 }
 
-void BI_Base::addToBoard(GraphicsScene& scene, BGI_Base& item) noexcept
+void BI_Base::addToBoard(GraphicsScene& scene, BGI_Base* item) noexcept
 {
     Q_ASSERT(!mIsAddedToBoard);
-    scene.addItem(item);
+    if (item) scene.addItem(*item);
     mIsAddedToBoard = true;
 }
 
-void BI_Base::removeFromBoard(GraphicsScene& scene, BGI_Base& item) noexcept
+void BI_Base::removeFromBoard(GraphicsScene& scene, BGI_Base* item) noexcept
 {
     Q_ASSERT(mIsAddedToBoard);
-    scene.removeItem(item);
+    if (item) scene.removeItem(*item);
     mIsAddedToBoard = false;
 }
 
+void BI_Base::graphicsItemCreated(BGI_Base& item) noexcept
+{
+    if (mIsAddedToBoard) {
+        mBoard.getGraphicsScene().addItem(item);
+    }
+    mBoard.itemGeometryChanged(*this); // the grab area depends on the graphics item
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
@@ -63,6 +63,7 @@ class BI_Base : public QObject
             Footprint,      ///< librepcb#project#BI_Footprint
             FootprintPad,   ///< librepcb#project#BI_FootprintPad
             Polygon,        ///< librepcb#project#BI_Polygon
+            AirWire,        ///< librepcb#project#BI_AirWire
         };
 
         // Constructors / Destructor
@@ -87,6 +88,22 @@ class BI_Base : public QObject
         virtual void setSelected(bool selected) noexcept;
 
         // General Methods
+        /**
+         * @brief Create the graphics item(s) of this item if not done yet
+         *
+         * Projects opened in model-only mode do not create any graphics items while
+         * loading. They are created on demand by this method, which also adds them to
+         * the graphics scene of the board if the item is already added to it.
+         */
+        virtual void createGraphicsItems() noexcept = 0;
+
+        /**
+         * @brief Update the graphics item(s) of this item after a deferred change
+         *
+         * Called by the board for items passed to Board#deferGraphicsItemUpdate()
+         * during an interactive move. The default implementation does nothing.
+         */
+        virtual void updateGraphicsItems() noexcept {}
         virtual void addToBoard(GraphicsScene& scene) throw (Exception) = 0;
         virtual void removeFromBoard(GraphicsScene& scene) throw (Exception) = 0;
 
@@ -99,8 +116,9 @@ class BI_Base : public QObject
         // General Methods
         void addToBoard() noexcept;
         void removeFromBoard() noexcept;
-        void addToBoard(GraphicsScene& scene, BGI_Base& item) noexcept;
-        void removeFromBoard(GraphicsScene& scene, BGI_Base& item) noexcept;
+        void addToBoard(GraphicsScene& scene, BGI_Base* item) noexcept;
+        void removeFromBoard(GraphicsScene& scene, BGI_Base* item) noexcept;
+        void graphicsItemCreated(BGI_Base& item) noexcept;
 
 
     protected:
@@ -196,6 +196,11 @@ void BI_Device::setIsMirrored(bool mirror) throw (Exception)
     }
 }
 
+void BI_Device::createGraphicsItems() noexcept
+{
+    mFootprint->createGraphicsItems();
+}
+
 void BI_Device::addToBoard(GraphicsScene& scene) throw (Exception)
 {
     if (isAddedToBoard()) {
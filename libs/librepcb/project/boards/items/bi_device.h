@@ -91,6 +91,7 @@ class BI_Device final : public BI_Base, public IF_AttributeProvider,
         void setIsMirrored(bool mirror) throw (Exception);
 
         // General Methods
+        void createGraphicsItems() noexcept override;
         void addToBoard(GraphicsScene& scene) throw (Exception) override;
         void removeFromBoard(GraphicsScene& scene) throw (Exception) override;
 
@@ -67,9 +67,7 @@ BI_Footprint::BI_Footprint(BI_Device& device) throw (Exception) :
 
 void BI_Footprint::init() throw (Exception)
 {
-    mGraphicsItem.reset(new BGI_Footprint(*this));
-    mGraphicsItem->setPos(mDevice.getPosition().toPxQPointF());
-    updateGraphicsItemTransform();
+    if (mBoard.hasGraphicsItems()) createGraphicsItems();
 
     const library::Device& libDev = mDevice.getLibDevice();
     foreach (const Uuid& padUuid, getLibFootprint().getPadUuids()) {
@@ -140,6 +138,19 @@ bool BI_Footprint::isUsed() const noexcept
  *  General Methods
  ****************************************************************************************/
 
+void BI_Footprint::createGraphicsItems() noexcept
+{
+    if (!mGraphicsItem) {
+        mGraphicsItem.reset(new BGI_Footprint(*this));
+        mGraphicsItem->setPos(mDevice.getPosition().toPxQPointF());
+        updateGraphicsItemTransform();
+        BI_Base::graphicsItemCreated(*mGraphicsItem);
+    }
+    foreach (BI_FootprintPad* pad, mPads) {
+        pad->createGraphicsItems();
+    }
+}
+
 void BI_Footprint::addToBoard(GraphicsScene& scene) throw (Exception)
 {
     if (isAddedToBoard()) {
@@ -150,7 +161,8 @@ void BI_Footprint::addToBoard(GraphicsScene& scene) throw (Exception)
         pad->addToBoard(scene); // can throw
         sgl.add([pad, &scene](){pad->removeFromBoard(scene);});
     }
-    BI_Base::addToBoard(scene, *mGraphicsItem);
+    if (mBoard.hasGraphicsItems()) createGraphicsItems();
+    BI_Base::addToBoard(scene, mGraphicsItem.data());
     sgl.dismiss();
 }
 
@@ -164,7 +176,7 @@ void BI_Footprint::removeFromBoard(GraphicsScene& scene) throw (Exception)
         pad->removeFromBoard(scene); // can throw
         sgl.add([pad, &scene](){pad->addToBoard(scene);});
     }
-    BI_Base::removeFromBoard(scene, *mGraphicsItem);
+    BI_Base::removeFromBoard(scene, mGraphicsItem.data());
     sgl.dismiss();
 }
 
@@ -221,18 +233,19 @@ bool BI_Footprint::getIsMirrored() const noexcept
 
 QPainterPath BI_Footprint::getGrabAreaScenePx() const noexcept
 {
+    if (!mGraphicsItem) return QPainterPath();
     return mGraphicsItem->sceneTransform().map(mGraphicsItem->shape());
 }
 
 bool BI_Footprint::isSelectable() const noexcept
 {
-    return mGraphicsItem->isSelectable();
+    return mGraphicsItem && mGraphicsItem->isSelectable();
 }
 
 void BI_Footprint::setSelected(bool selected) noexcept
 {
     BI_Base::setSelected(selected);
-    mGraphicsItem->update();
+    if (mGraphicsItem) mGraphicsItem->update();
     foreach (BI_FootprintPad* pad, mPads)
         pad->setSelected(selected);
 }
@@ -243,14 +256,16 @@ void BI_Footprint::setSelected(bool selected) noexcept
 
 void BI_Footprint::deviceInstanceAttributesChanged()
 {
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
+    mBoard.itemGeometryChanged(*this);
     emit attributesChanged();
 }
 
 void BI_Footprint::deviceInstanceMoved(const Point& pos)
 {
-    mGraphicsItem->setPos(pos.toPxQPointF());
-    mGraphicsItem->updateCacheAndRepaint();
+    // the geometry of the graphics item does not depend on the position
+    if (mGraphicsItem) mGraphicsItem->setPos(pos.toPxQPointF());
+    mBoard.itemGeometryChanged(*this);
     foreach (BI_FootprintPad* pad, mPads) {
         pad->updatePosition();
     }
@@ -260,7 +275,8 @@ void BI_Footprint::deviceInstanceRotated(const Angle& rot)
 {
     Q_UNUSED(rot);
     updateGraphicsItemTransform();
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
+    mBoard.itemGeometryChanged(*this);
     foreach (BI_FootprintPad* pad, mPads) {
         pad->updatePosition();
     }
@@ -270,7 +286,8 @@ void BI_Footprint::deviceInstanceMirrored(bool mirrored)
 {
     Q_UNUSED(mirrored);
     updateGraphicsItemTransform();
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
+    mBoard.itemGeometryChanged(*this);
     foreach (BI_FootprintPad* pad, mPads) {
         pad->updatePosition();
     }
@@ -285,7 +302,7 @@ void BI_Footprint::updateGraphicsItemTransform() noexcept
     QTransform t;
     if (mDevice.getIsMirrored()) t.scale(qreal(-1), qreal(1));
     t.rotate(-mDevice.getRotation().toDeg());
-    mGraphicsItem->setTransform(t);
+    if (mGraphicsItem) mGraphicsItem->setTransform(t);
 }
 
 bool BI_Footprint::checkAttributesValidity() const noexcept
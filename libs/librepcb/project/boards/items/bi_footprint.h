@@ -80,6 +80,7 @@ class BI_Footprint final : public BI_Base, public IF_XmlSerializableObject,
         bool isUsed() const noexcept;
 
         // General Methods
+        void createGraphicsItems() noexcept override;
         void addToBoard(GraphicsScene& scene) throw (Exception) override;
         void removeFromBoard(GraphicsScene& scene) throw (Exception) override;
 
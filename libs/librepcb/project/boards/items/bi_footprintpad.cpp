@@ -68,7 +68,7 @@ BI_FootprintPad::BI_FootprintPad(BI_Footprint& footprint, const Uuid& padUuid) :
     Uuid cmpSignalUuid = mFootprint.getDeviceInstance().getLibDevice().getSignalOfPad(padUuid);
     mComponentSignalInstance = mFootprint.getDeviceInstance().getComponentInstance().getSignalInstance(cmpSignalUuid);
 
-    mGraphicsItem.reset(new BGI_FootprintPad(*this));
+    if (mBoard.hasGraphicsItems()) createGraphicsItems();
     updatePosition();
 
     // connect to the "attributes changed" signal of the footprint
@@ -131,6 +131,16 @@ NetSignal* BI_FootprintPad::getCompSigInstNetSignal() const noexcept
  *  General Methods
  ****************************************************************************************/
 
+void BI_FootprintPad::createGraphicsItems() noexcept
+{
+    if (!mGraphicsItem) {
+        mGraphicsItem.reset(new BGI_FootprintPad(*this));
+        mGraphicsItem->setPos(mPosition.toPxQPointF());
+        updateGraphicsItemTransform();
+        BI_Base::graphicsItemCreated(*mGraphicsItem);
+    }
+}
+
 void BI_FootprintPad::addToBoard(GraphicsScene& scene) throw (Exception)
 {
     if (isAddedToBoard() || isUsed()) {
@@ -141,9 +151,11 @@ void BI_FootprintPad::addToBoard(GraphicsScene& scene) throw (Exception)
     }
     if (getCompSigInstNetSignal()) {
         mHighlightChangedConnection = connect(getCompSigInstNetSignal(), &NetSignal::highlightedChanged,
-                                              [this](){mGraphicsItem->update();});
+                                              [this](){if (mGraphicsItem) mGraphicsItem->update();});
     }
-    BI_Base::addToBoard(scene, *mGraphicsItem);
+    if (mBoard.hasGraphicsItems()) createGraphicsItems();
+    BI_Base::addToBoard(scene, mGraphicsItem.data());
+    mBoard.scheduleAirWiresRebuild(getCompSigInstNetSignal());
 }
 
 void BI_FootprintPad::removeFromBoard(GraphicsScene& scene) throw (Exception)
@@ -157,7 +169,8 @@ void BI_FootprintPad::removeFromBoard(GraphicsScene& scene) throw (Exception)
     if (getCompSigInstNetSignal()) {
         disconnect(mHighlightChangedConnection);
     }
-    BI_Base::removeFromBoard(scene, *mGraphicsItem);
+    BI_Base::removeFromBoard(scene, mGraphicsItem.data());
+    mBoard.scheduleAirWiresRebuild(getCompSigInstNetSignal());
 }
 
 void BI_FootprintPad::registerNetPoint(BI_NetPoint& netpoint) throw (Exception)
@@ -188,13 +201,25 @@ void BI_FootprintPad::unregisterNetPoint(BI_NetPoint& netpoint) throw (Exception
     netpoint.updateLines();
 }
 
+void BI_FootprintPad::updateGraphicsItems() noexcept
+{
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
+    mBoard.itemGeometryChanged(*this);
+}
+
 void BI_FootprintPad::updatePosition() noexcept
 {
     mPosition = mFootprint.mapToScene(mFootprintPad->getPosition());
     mRotation = mFootprint.getRotation() + mFootprintPad->getRotation();
-    mGraphicsItem->setPos(mPosition.toPxQPointF());
+    if (mGraphicsItem) mGraphicsItem->setPos(mPosition.toPxQPointF());
     updateGraphicsItemTransform();
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem && mBoard.isInteractiveMoveActive()) {
+        mBoard.deferGraphicsItemUpdate(*this); // the transform is already up to date
+    } else if (mGraphicsItem) {
+        mGraphicsItem->updateCacheAndRepaint();
+    }
+    mBoard.itemGeometryChanged(*this);
+    mBoard.scheduleAirWiresRebuild(getCompSigInstNetSignal());
     foreach (BI_NetPoint* netpoint, mRegisteredNetPoints) {
         netpoint->setPosition(mPosition);
     }
@@ -211,18 +236,19 @@ bool BI_FootprintPad::getIsMirrored() const noexcept
 
 QPainterPath BI_FootprintPad::getGrabAreaScenePx() const noexcept
 {
+    if (!mGraphicsItem) return QPainterPath();
     return mGraphicsItem->sceneTransform().map(mGraphicsItem->shape());
 }
 
 bool BI_FootprintPad::isSelectable() const noexcept
 {
-    return mFootprint.isSelectable() && mGraphicsItem->isSelectable();
+    return mFootprint.isSelectable() && mGraphicsItem && mGraphicsItem->isSelectable();
 }
 
 void BI_FootprintPad::setSelected(bool selected) noexcept
 {
     BI_Base::setSelected(selected);
-    mGraphicsItem->update();
+    if (mGraphicsItem) mGraphicsItem->update();
 }
 
 /*****************************************************************************************
@@ -231,7 +257,7 @@ void BI_FootprintPad::setSelected(bool selected) noexcept
 
 void BI_FootprintPad::footprintAttributesChanged()
 {
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
 }
 
 /*****************************************************************************************
@@ -243,7 +269,7 @@ void BI_FootprintPad::updateGraphicsItemTransform() noexcept
     QTransform t;
     if (mFootprint.getIsMirrored()) t.scale(qreal(-1), qreal(1));
     t.rotate(-mRotation.toDeg());
-    mGraphicsItem->setTransform(t);
+    if (mGraphicsItem) mGraphicsItem->setTransform(t);
 }
 
 /*****************************************************************************************
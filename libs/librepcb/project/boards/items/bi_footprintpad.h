@@ -79,8 +79,10 @@ class BI_FootprintPad final : public BI_Base
         bool isSelectable() const noexcept override;
 
         // General Methods
+        void createGraphicsItems() noexcept override;
         void addToBoard(GraphicsScene& scene) throw (Exception) override;
         void removeFromBoard(GraphicsScene& scene) throw (Exception) override;
+        void updateGraphicsItems() noexcept override;
         void registerNetPoint(BI_NetPoint& netpoint) throw (Exception);
         void unregisterNetPoint(BI_NetPoint& netpoint) throw (Exception);
         void updatePosition() noexcept;
@@ -109,7 +109,7 @@ void BI_NetLine::init() throw (Exception)
             tr("BI_NetLine: both endpoints are the same."));
     }
 
-    mGraphicsItem.reset(new BGI_NetLine(*this));
+    if (mBoard.hasGraphicsItems()) createGraphicsItems();
     updateLine();
 
     if (!checkAttributesValidity()) throw LogicError(__FILE__, __LINE__);
@@ -160,7 +160,8 @@ void BI_NetLine::setWidth(const Length& width) noexcept
     Q_ASSERT(width >= 0);
     if ((width != mWidth) && (width >= 0)) {
         mWidth = width;
-        mGraphicsItem->updateCacheAndRepaint();
+        if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
+        mBoard.itemGeometryChanged(*this);
     }
 }
 
@@ -168,6 +169,14 @@ void BI_NetLine::setWidth(const Length& width) noexcept
  *  General Methods
  ****************************************************************************************/
 
+void BI_NetLine::createGraphicsItems() noexcept
+{
+    if (!mGraphicsItem) {
+        mGraphicsItem.reset(new BGI_NetLine(*this));
+        BI_Base::graphicsItemCreated(*mGraphicsItem);
+    }
+}
+
 void BI_NetLine::addToBoard(GraphicsScene& scene) throw (Exception)
 {
     if (isAddedToBoard()
@@ -180,8 +189,9 @@ void BI_NetLine::addToBoard(GraphicsScene& scene) throw (Exception)
     auto sg = scopeGuard([&](){mStartPoint->unregisterNetLine(*this);});
     mEndPoint->registerNetLine(*this); // can throw
     mHighlightChangedConnection = connect(&getNetSignal(), &NetSignal::highlightedChanged,
-                                          [this](){mGraphicsItem->update();});
-    BI_Base::addToBoard(scene, *mGraphicsItem);
+                                          [this](){if (mGraphicsItem) mGraphicsItem->update();});
+    if (mBoard.hasGraphicsItems()) createGraphicsItems();
+    BI_Base::addToBoard(scene, mGraphicsItem.data());
     sg.dismiss();
 }
 
@@ -197,14 +207,24 @@ void BI_NetLine::removeFromBoard(GraphicsScene& scene) throw (Exception)
     auto sg = scopeGuard([&](){mEndPoint->registerNetLine(*this);});
     mEndPoint->unregisterNetLine(*this); // can throw
     disconnect(mHighlightChangedConnection);
-    BI_Base::removeFromBoard(scene, *mGraphicsItem);
+    BI_Base::removeFromBoard(scene, mGraphicsItem.data());
     sg.dismiss();
 }
 
+void BI_NetLine::updateGraphicsItems() noexcept
+{
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
+    mBoard.itemGeometryChanged(*this);
+}
+
 void BI_NetLine::updateLine() noexcept
 {
     mPosition = (mStartPoint->getPosition() + mEndPoint->getPosition()) / 2;
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem && mBoard.isInteractiveMoveActive()) {
+        mBoard.deferGraphicsItemUpdate(*this); // stroking the shape is expensive
+    } else {
+        updateGraphicsItems();
+    }
 }
 
 XmlDomElement* BI_NetLine::serializeToXmlDomElement() const throw (Exception)
@@ -225,18 +245,18 @@ XmlDomElement* BI_NetLine::serializeToXmlDomElement() const throw (Exception)
 
 QPainterPath BI_NetLine::getGrabAreaScenePx() const noexcept
 {
-    return mGraphicsItem->shape();
+    return mGraphicsItem ? mGraphicsItem->shape() : QPainterPath();
 }
 
 bool BI_NetLine::isSelectable() const noexcept
 {
-    return mGraphicsItem->isSelectable();
+    return mGraphicsItem && mGraphicsItem->isSelectable();
 }
 
 void BI_NetLine::setSelected(bool selected) noexcept
 {
     BI_Base::setSelected(selected);
-    mGraphicsItem->update();
+    if (mGraphicsItem) mGraphicsItem->update();
 }
 
 /*****************************************************************************************
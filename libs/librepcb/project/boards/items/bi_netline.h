@@ -80,8 +80,10 @@ class BI_NetLine final : public BI_Base, public IF_XmlSerializableObject
         void setWidth(const Length& width) noexcept;
 
         // General Methods
+        void createGraphicsItems() noexcept override;
         void addToBoard(GraphicsScene& scene) throw (Exception) override;
         void removeFromBoard(GraphicsScene& scene) throw (Exception) override;
+        void updateGraphicsItems() noexcept override;
         void updateLine() noexcept;
 
         /// @copydoc IF_XmlSerializableObject#serializeToXmlDomElement()
@@ -164,9 +164,7 @@ void BI_NetPoint::init() throw (Exception)
         }
     }
 
-    // create the graphics item
-    mGraphicsItem.reset(new BGI_NetPoint(*this));
-    mGraphicsItem->setPos(mPosition.toPxQPointF());
+    if (mBoard.hasGraphicsItems()) createGraphicsItems();
 
     // create ERC messages
     mErcMsgDeadNetPoint.reset(new ErcMsg(mBoard.getProject(), *this,
@@ -227,6 +225,8 @@ void BI_NetPoint::setNetSignal(NetSignal& netsignal) throw (Exception)
         auto sg = scopeGuard([&](){mNetSignal->registerBoardNetPoint(*this);});
         netsignal.registerBoardNetPoint(*this); // can throw
         sg.dismiss();
+        mBoard.scheduleAirWiresRebuild(mNetSignal);
+        mBoard.scheduleAirWiresRebuild(&netsignal);
     }
     mNetSignal = &netsignal;
 }
@@ -256,9 +256,10 @@ void BI_NetPoint::setPadToAttach(BI_FootprintPad* pad) throw (Exception)
             setPosition(pad->getPosition());
         }
         sgl.dismiss();
+        mBoard.scheduleAirWiresRebuild(mNetSignal);
     }
     mFootprintPad = pad;
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
 }
 
 void BI_NetPoint::setViaToAttach(BI_Via* via) throw (Exception)
@@ -284,16 +285,19 @@ void BI_NetPoint::setViaToAttach(BI_Via* via) throw (Exception)
             setPosition(via->getPosition());
         }
         sgl.dismiss();
+        mBoard.scheduleAirWiresRebuild(mNetSignal);
     }
     mVia = via;
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
 }
 
 void BI_NetPoint::setPosition(const Point& position) noexcept
 {
     if (position != mPosition) {
         mPosition = position;
-        mGraphicsItem->setPos(mPosition.toPxQPointF());
+        if (mGraphicsItem) mGraphicsItem->setPos(mPosition.toPxQPointF());
+        mBoard.itemGeometryChanged(*this);
+        mBoard.scheduleAirWiresRebuild(mNetSignal);
         updateLines();
     }
 }
@@ -302,6 +306,15 @@ void BI_NetPoint::setPosition(const Point& position) noexcept
  *  General Methods
  ****************************************************************************************/
 
+void BI_NetPoint::createGraphicsItems() noexcept
+{
+    if (!mGraphicsItem) {
+        mGraphicsItem.reset(new BGI_NetPoint(*this));
+        mGraphicsItem->setPos(mPosition.toPxQPointF());
+        BI_Base::graphicsItemCreated(*mGraphicsItem);
+    }
+}
+
 void BI_NetPoint::addToBoard(GraphicsScene& scene) throw (Exception)
 {
     if (isAddedToBoard() || isUsed()) {
@@ -326,9 +339,11 @@ void BI_NetPoint::addToBoard(GraphicsScene& scene) throw (Exception)
         sgl.add([&](){mVia->unregisterNetPoint(*this);});
     }
     mHighlightChangedConnection = connect(mNetSignal, &NetSignal::highlightedChanged,
-                                          [this](){mGraphicsItem->update();});
+                                          [this](){if (mGraphicsItem) mGraphicsItem->update();});
     mErcMsgDeadNetPoint->setVisible(true);
-    BI_Base::addToBoard(scene, *mGraphicsItem);
+    if (mBoard.hasGraphicsItems()) createGraphicsItems();
+    BI_Base::addToBoard(scene, mGraphicsItem.data());
+    mBoard.scheduleAirWiresRebuild(mNetSignal);
     sgl.dismiss();
 }
 
@@ -357,7 +372,8 @@ void BI_NetPoint::removeFromBoard(GraphicsScene& scene) throw (Exception)
     sgl.add([&](){mNetSignal->registerBoardNetPoint(*this);});
     disconnect(mHighlightChangedConnection);
     mErcMsgDeadNetPoint->setVisible(false);
-    BI_Base::removeFromBoard(scene, *mGraphicsItem);
+    BI_Base::removeFromBoard(scene, mGraphicsItem.data());
+    mBoard.scheduleAirWiresRebuild(mNetSignal);
     sgl.dismiss();
 }
 
@@ -370,8 +386,10 @@ void BI_NetPoint::registerNetLine(BI_NetLine& netline) throw (Exception)
     }
     mRegisteredLines.append(&netline);
     netline.updateLine();
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
+    mBoard.itemGeometryChanged(*this); // size depends on the line widths
     mErcMsgDeadNetPoint->setVisible(mRegisteredLines.isEmpty());
+    mBoard.scheduleAirWiresRebuild(mNetSignal);
 }
 
 void BI_NetPoint::unregisterNetLine(BI_NetLine& netline) throw (Exception)
@@ -381,8 +399,10 @@ void BI_NetPoint::unregisterNetLine(BI_NetLine& netline) throw (Exception)
     }
     mRegisteredLines.removeOne(&netline);
     netline.updateLine();
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
+    mBoard.itemGeometryChanged(*this); // size depends on the line widths
     mErcMsgDeadNetPoint->setVisible(mRegisteredLines.isEmpty());
+    mBoard.scheduleAirWiresRebuild(mNetSignal);
 }
 
 void BI_NetPoint::updateLines() const noexcept
@@ -421,18 +441,19 @@ XmlDomElement* BI_NetPoint::serializeToXmlDomElement() const throw (Exception)
 
 QPainterPath BI_NetPoint::getGrabAreaScenePx() const noexcept
 {
+    if (!mGraphicsItem) return QPainterPath();
     return mGraphicsItem->shape().translated(mPosition.toPxQPointF());
 }
 
 bool BI_NetPoint::isSelectable() const noexcept
 {
-    return mGraphicsItem->isSelectable();
+    return mGraphicsItem && mGraphicsItem->isSelectable();
 }
 
 void BI_NetPoint::setSelected(bool selected) noexcept
 {
     BI_Base::setSelected(selected);
-    mGraphicsItem->update();
+    if (mGraphicsItem) mGraphicsItem->update();
 }
 
 /*****************************************************************************************
@@ -100,6 +100,7 @@ class BI_NetPoint final : public BI_Base, public IF_XmlSerializableObject,
         void setPosition(const Point& position) noexcept;
 
         // General Methods
+        void createGraphicsItems() noexcept override;
         void addToBoard(GraphicsScene& scene) throw (Exception) override;
         void removeFromBoard(GraphicsScene& scene) throw (Exception) override;
         void registerNetLine(BI_NetLine& netline) throw (Exception);
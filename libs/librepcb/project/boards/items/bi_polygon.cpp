@@ -63,9 +63,7 @@ BI_Polygon::BI_Polygon(Board& board, int layerId, const Length& lineWidth, bool
 
 void BI_Polygon::init() throw (Exception)
 {
-    mGraphicsItem.reset(new BGI_Polygon(*this));
-    mGraphicsItem->setPos(getPosition().toPxQPointF());
-    mGraphicsItem->setRotation(Angle::deg0().toDeg());
+    if (mBoard.hasGraphicsItems()) createGraphicsItems();
 
     // connect to the "attributes changed" signal of the board
     connect(&mBoard, &Board::attributesChanged, this, &BI_Polygon::boardAttributesChanged);
@@ -83,12 +81,23 @@ BI_Polygon::~BI_Polygon() noexcept
  *  General Methods
  ****************************************************************************************/
 
+void BI_Polygon::createGraphicsItems() noexcept
+{
+    if (!mGraphicsItem) {
+        mGraphicsItem.reset(new BGI_Polygon(*this));
+        mGraphicsItem->setPos(getPosition().toPxQPointF());
+        mGraphicsItem->setRotation(Angle::deg0().toDeg());
+        BI_Base::graphicsItemCreated(*mGraphicsItem);
+    }
+}
+
 void BI_Polygon::addToBoard(GraphicsScene& scene) throw (Exception)
 {
     if (isAddedToBoard()) {
         throw LogicError(__FILE__, __LINE__);
     }
-    BI_Base::addToBoard(scene, *mGraphicsItem);
+    if (mBoard.hasGraphicsItems()) createGraphicsItems();
+    BI_Base::addToBoard(scene, mGraphicsItem.data());
 }
 
 void BI_Polygon::removeFromBoard(GraphicsScene& scene) throw (Exception)
@@ -96,7 +105,7 @@ void BI_Polygon::removeFromBoard(GraphicsScene& scene) throw (Exception)
     if (!isAddedToBoard()) {
         throw LogicError(__FILE__, __LINE__);
     }
-    BI_Base::removeFromBoard(scene, *mGraphicsItem);
+    BI_Base::removeFromBoard(scene, mGraphicsItem.data());
 }
 
 XmlDomElement* BI_Polygon::serializeToXmlDomElement() const throw (Exception)
@@ -123,18 +132,19 @@ bool BI_Polygon::getAttributeValue(const QString& attrNS, const QString& attrKey
 
 QPainterPath BI_Polygon::getGrabAreaScenePx() const noexcept
 {
+    if (!mGraphicsItem) return QPainterPath();
     return mGraphicsItem->sceneTransform().map(mGraphicsItem->shape());
 }
 
 bool BI_Polygon::isSelectable() const noexcept
 {
-    return mGraphicsItem->isSelectable();
+    return mGraphicsItem && mGraphicsItem->isSelectable();
 }
 
 void BI_Polygon::setSelected(bool selected) noexcept
 {
     BI_Base::setSelected(selected);
-    mGraphicsItem->update();
+    if (mGraphicsItem) mGraphicsItem->update();
 }
 
 /*****************************************************************************************
@@ -143,7 +153,7 @@ void BI_Polygon::setSelected(bool selected) noexcept
 
 void BI_Polygon::boardAttributesChanged()
 {
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
 }
 
 /*****************************************************************************************
@@ -72,6 +72,7 @@ class BI_Polygon final : public BI_Base, public IF_XmlSerializableObject,
         bool isSelectable() const noexcept override;
 
         // General Methods
+        void createGraphicsItems() noexcept override;
         void addToBoard(GraphicsScene& scene) throw (Exception) override;
         void removeFromBoard(GraphicsScene& scene) throw (Exception) override;
 
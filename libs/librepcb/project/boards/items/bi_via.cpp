@@ -94,9 +94,7 @@ BI_Via::BI_Via(Board& board, const Point& position, Shape shape, const Length& s
 
 void BI_Via::init() throw (Exception)
 {
-    // create the graphics item
-    mGraphicsItem.reset(new BGI_Via(*this));
-    mGraphicsItem->setPos(mPosition.toPxQPointF());
+    if (mBoard.hasGraphicsItems()) createGraphicsItems();
 
     // connect to the "attributes changed" signal of the board
     connect(&mBoard, &Board::attributesChanged,
@@ -182,16 +180,20 @@ void BI_Via::setNetSignal(NetSignal* netsignal) throw (Exception)
             sgl.add([&](){netsignal->unregisterBoardVia(*this);});
         }
         sgl.dismiss();
+        mBoard.scheduleAirWiresRebuild(mNetSignal);
+        mBoard.scheduleAirWiresRebuild(netsignal);
     }
     mNetSignal = netsignal;
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
 }
 
 void BI_Via::setPosition(const Point& position) noexcept
 {
     if (position != mPosition) {
         mPosition = position;
-        mGraphicsItem->setPos(mPosition.toPxQPointF());
+        if (mGraphicsItem) mGraphicsItem->setPos(mPosition.toPxQPointF());
+        mBoard.itemGeometryChanged(*this);
+        mBoard.scheduleAirWiresRebuild(mNetSignal);
         updateNetPoints();
     }
 }
@@ -200,7 +202,8 @@ void BI_Via::setShape(Shape shape) noexcept
 {
     if (shape != mShape) {
         mShape = shape;
-        mGraphicsItem->updateCacheAndRepaint();
+        if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
+        mBoard.itemGeometryChanged(*this);
     }
 }
 
@@ -208,7 +211,8 @@ void BI_Via::setSize(const Length& size) noexcept
 {
     if (size != mSize) {
         mSize = size;
-        mGraphicsItem->updateCacheAndRepaint();
+        if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
+        mBoard.itemGeometryChanged(*this);
     }
 }
 
@@ -216,7 +220,7 @@ void BI_Via::setDrillDiameter(const Length& diameter) noexcept
 {
     if (diameter != mDrillDiameter) {
         mDrillDiameter = diameter;
-        mGraphicsItem->updateCacheAndRepaint();
+        if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
     }
 }
 
@@ -224,6 +228,15 @@ void BI_Via::setDrillDiameter(const Length& diameter) noexcept
  *  General Methods
  ****************************************************************************************/
 
+void BI_Via::createGraphicsItems() noexcept
+{
+    if (!mGraphicsItem) {
+        mGraphicsItem.reset(new BGI_Via(*this));
+        mGraphicsItem->setPos(mPosition.toPxQPointF());
+        BI_Base::graphicsItemCreated(*mGraphicsItem);
+    }
+}
+
 void BI_Via::addToBoard(GraphicsScene& scene) throw (Exception)
 {
     if (isAddedToBoard() || isUsed()) {
@@ -232,9 +245,11 @@ void BI_Via::addToBoard(GraphicsScene& scene) throw (Exception)
     if (mNetSignal) {
         mNetSignal->registerBoardVia(*this); // can throw
         mHighlightChangedConnection = connect(mNetSignal, &NetSignal::highlightedChanged,
-                                              [this](){mGraphicsItem->update();});
+                                              [this](){if (mGraphicsItem) mGraphicsItem->update();});
     }
-    BI_Base::addToBoard(scene, *mGraphicsItem);
+    if (mBoard.hasGraphicsItems()) createGraphicsItems();
+    BI_Base::addToBoard(scene, mGraphicsItem.data());
+    mBoard.scheduleAirWiresRebuild(mNetSignal);
 }
 
 void BI_Via::removeFromBoard(GraphicsScene& scene) throw (Exception)
@@ -246,7 +261,8 @@ void BI_Via::removeFromBoard(GraphicsScene& scene) throw (Exception)
         mNetSignal->unregisterBoardVia(*this); // can throw
         disconnect(mHighlightChangedConnection);
     }
-    BI_Base::removeFromBoard(scene, *mGraphicsItem);
+    BI_Base::removeFromBoard(scene, mGraphicsItem.data());
+    mBoard.scheduleAirWiresRebuild(mNetSignal);
 }
 
 void BI_Via::registerNetPoint(BI_NetPoint& netpoint) throw (Exception)
@@ -258,7 +274,7 @@ void BI_Via::registerNetPoint(BI_NetPoint& netpoint) throw (Exception)
     }
     mRegisteredNetPoints.insert(netpoint.getLayer().getId(), &netpoint);
     netpoint.updateLines();
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
 }
 
 void BI_Via::unregisterNetPoint(BI_NetPoint& netpoint) throw (Exception)
@@ -268,7 +284,7 @@ void BI_Via::unregisterNetPoint(BI_NetPoint& netpoint) throw (Exception)
     }
     mRegisteredNetPoints.remove(netpoint.getLayer().getId());
     netpoint.updateLines();
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
 }
 
 void BI_Via::updateNetPoints() const noexcept
@@ -305,18 +321,19 @@ XmlDomElement* BI_Via::serializeToXmlDomElement() const throw (Exception)
 
 QPainterPath BI_Via::getGrabAreaScenePx() const noexcept
 {
+    if (!mGraphicsItem) return QPainterPath();
     return mGraphicsItem->shape().translated(mPosition.toPxQPointF());
 }
 
 bool BI_Via::isSelectable() const noexcept
 {
-    return mGraphicsItem->isSelectable();
+    return mGraphicsItem && mGraphicsItem->isSelectable();
 }
 
 void BI_Via::setSelected(bool selected) noexcept
 {
     BI_Base::setSelected(selected);
-    mGraphicsItem->update();
+    if (mGraphicsItem) mGraphicsItem->update();
 }
 
 /*****************************************************************************************
@@ -325,7 +342,7 @@ void BI_Via::setSelected(bool selected) noexcept
 
 void BI_Via::boardAttributesChanged()
 {
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
 }
 
 bool BI_Via::checkAttributesValidity() const noexcept
@@ -90,6 +90,7 @@ class BI_Via final : public BI_Base, public IF_XmlSerializableObject
         void setDrillDiameter(const Length& diameter) noexcept;
 
         // General Methods
+        void createGraphicsItems() noexcept override;
         void addToBoard(GraphicsScene& scene) throw (Exception) override;
         void removeFromBoard(GraphicsScene& scene) throw (Exception) override;
         void registerNetPoint(BI_NetPoint& netpoint) throw (Exception);
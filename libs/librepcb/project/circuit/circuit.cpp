@@ -367,11 +367,17 @@ void Circuit::setComponentInstanceName(ComponentInstance& cmp, const QString& ne
  *  General Methods
  ****************************************************************************************/
 
+void Circuit::setModified() noexcept
+{
+    mXmlFile->setModified();
+}
+
 bool Circuit::save(bool toOriginal, QStringList& errors) noexcept
 {
     bool success = true;
 
-    // Save "core/circuit.xml"
+    // Save "core/circuit.xml" (only if modified since the last save)
+    if (!mXmlFile->isModified(toOriginal)) return true;
     try
     {
         XmlDomDocument doc(*serializeToXmlDomElement());
@@ -386,6 +392,28 @@ bool Circuit::save(bool toOriginal, QStringList& errors) noexcept
     return success;
 }
 
+bool Circuit::createBackupSnapshots(QList<SmartFileSnapshot>& snapshots,
+                                    QStringList& errors) noexcept
+{
+    bool success = true;
+
+    // Snapshot "core/circuit.xml" (only if modified since the last backup)
+    if (!mXmlFile->isModified(false)) return true;
+    try
+    {
+        QSharedPointer<const XmlDomDocument> doc(
+            new XmlDomDocument(*serializeToXmlDomElement()));
+        snapshots.append(mXmlFile->createBackupSnapshot(doc));
+    }
+    catch (Exception& e)
+    {
+        success = false;
+        errors.append(e.getUserMsg());
+    }
+
+    return success;
+}
+
 /*****************************************************************************************
  *  Private Methods
  ****************************************************************************************/
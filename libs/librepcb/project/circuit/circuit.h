@@ -35,6 +35,7 @@
 namespace librepcb {
 
 class SmartXmlFile;
+class SmartFileSnapshot;
 
 namespace library {
 class Component;
@@ -111,7 +112,9 @@ class Circuit final : public QObject, public IF_XmlSerializableObject
         void setComponentInstanceName(ComponentInstance& cmp, const QString& newName) throw (Exception);
 
         // General Methods
+        void setModified() noexcept;
         bool save(bool toOriginal, QStringList& errors) noexcept;
+        bool createBackupSnapshots(QList<SmartFileSnapshot>& snapshots, QStringList& errors) noexcept;
 
         // Operator Overloadings
         Circuit& operator=(const Circuit& rhs) = delete;
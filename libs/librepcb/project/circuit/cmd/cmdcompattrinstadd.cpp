@@ -22,6 +22,7 @@
  ****************************************************************************************/
 #include <QtCore>
 #include "cmdcompattrinstadd.h"
+#include "../circuit.h"
 #include "../componentinstance.h"
 #include "../componentattributeinstance.h"
 
@@ -63,11 +64,13 @@ bool CmdCompAttrInstAdd::performExecute() throw (Exception)
 
 void CmdCompAttrInstAdd::performUndo() throw (Exception)
 {
+    mComponentInstance.getCircuit().setModified();
     mComponentInstance.removeAttribute(*mAttrInstance); // can throw
 }
 
 void CmdCompAttrInstAdd::performRedo() throw (Exception)
 {
+    mComponentInstance.getCircuit().setModified();
     mComponentInstance.addAttribute(*mAttrInstance); // can throw
 }
 
@@ -22,6 +22,7 @@
  ****************************************************************************************/
 #include <QtCore>
 #include "cmdcompattrinstedit.h"
+#include "../circuit.h"
 #include "../componentinstance.h"
 #include "../componentattributeinstance.h"
 
@@ -54,6 +55,12 @@ CmdCompAttrInstEdit::~CmdCompAttrInstEdit() noexcept
  *  Inherited from UndoCommand
  ****************************************************************************************/
 
+qint64 CmdCompAttrInstEdit::getApproxMemoryUsage() const noexcept
+{
+    return UndoCommand::getApproxMemoryUsage() +
+           (mOldValue.capacity() + mNewValue.capacity()) * sizeof(QChar);
+}
+
 bool CmdCompAttrInstEdit::performExecute() throw (Exception)
 {
     performRedo(); // can throw
@@ -63,12 +70,14 @@ bool CmdCompAttrInstEdit::performExecute() throw (Exception)
 
 void CmdCompAttrInstEdit::performUndo() throw (Exception)
 {
+    mComponentInstance.getCircuit().setModified();
     mAttrInst.setTypeValueUnit(*mOldType, mOldValue, mOldUnit); // can throw
     emit mComponentInstance.attributesChanged();
 }
 
 void CmdCompAttrInstEdit::performRedo() throw (Exception)
 {
+    mComponentInstance.getCircuit().setModified();
     mAttrInst.setTypeValueUnit(*mNewType, mNewValue, mNewUnit); // can throw
     emit mComponentInstance.attributesChanged();
 }
@@ -56,6 +56,11 @@ class CmdCompAttrInstEdit final : public UndoCommand
                             const AttributeUnit* newUnit) noexcept;
         ~CmdCompAttrInstEdit() noexcept;
 
+        // Inherited from UndoCommand
+
+        /// @copydoc UndoCommand::getApproxMemoryUsage()
+        qint64 getApproxMemoryUsage() const noexcept override;
+
 
     private:
 
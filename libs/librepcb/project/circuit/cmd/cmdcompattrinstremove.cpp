@@ -22,6 +22,7 @@
  ****************************************************************************************/
 #include <QtCore>
 #include "cmdcompattrinstremove.h"
+#include "../circuit.h"
 #include "../componentinstance.h"
 #include "../componentattributeinstance.h"
 
@@ -59,11 +60,13 @@ bool CmdCompAttrInstRemove::performExecute() throw (Exception)
 
 void CmdCompAttrInstRemove::performUndo() throw (Exception)
 {
+    mComponentInstance.getCircuit().setModified();
     mComponentInstance.addAttribute(mAttrInstance); // can throw
 }
 
 void CmdCompAttrInstRemove::performRedo() throw (Exception)
 {
+    mComponentInstance.getCircuit().setModified();
     mComponentInstance.removeAttribute(mAttrInstance); // can throw
 }
 
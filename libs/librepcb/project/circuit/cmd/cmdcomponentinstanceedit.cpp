@@ -66,6 +66,12 @@ void CmdComponentInstanceEdit::setValue(const QString& value) noexcept
  *  Inherited from UndoCommand
  ****************************************************************************************/
 
+qint64 CmdComponentInstanceEdit::getApproxMemoryUsage() const noexcept
+{
+    return UndoCommand::getApproxMemoryUsage() + (mOldName.capacity() +
+           mNewName.capacity() + mOldValue.capacity() + mNewValue.capacity()) * sizeof(QChar);
+}
+
 bool CmdComponentInstanceEdit::performExecute() throw (Exception)
 {
     performRedo(); // can throw
@@ -75,12 +81,14 @@ bool CmdComponentInstanceEdit::performExecute() throw (Exception)
 
 void CmdComponentInstanceEdit::performUndo() throw (Exception)
 {
+    mCircuit.setModified();
     mCircuit.setComponentInstanceName(mComponentInstance, mOldName); // can throw
     mComponentInstance.setValue(mOldValue);
 }
 
 void CmdComponentInstanceEdit::performRedo() throw (Exception)
 {
+    mCircuit.setModified();
     mCircuit.setComponentInstanceName(mComponentInstance, mNewName); // can throw
     mComponentInstance.setValue(mNewValue);
 }
@@ -61,6 +61,11 @@ class CmdComponentInstanceEdit final : public UndoCommand
         void setName(const QString& name) noexcept;
         void setValue(const QString& value) noexcept;
 
+        // Inherited from UndoCommand
+
+        /// @copydoc UndoCommand::getApproxMemoryUsage()
+        qint64 getApproxMemoryUsage() const noexcept override;
+
 
     private:
 
@@ -59,6 +59,12 @@ void CmdNetClassEdit::setName(const QString& name) noexcept
  *  Inherited from UndoCommand
  ****************************************************************************************/
 
+qint64 CmdNetClassEdit::getApproxMemoryUsage() const noexcept
+{
+    return UndoCommand::getApproxMemoryUsage() +
+           (mOldName.capacity() + mNewName.capacity()) * sizeof(QChar);
+}
+
 bool CmdNetClassEdit::performExecute() throw (Exception)
 {
     performRedo(); // can throw
@@ -68,11 +74,13 @@ bool CmdNetClassEdit::performExecute() throw (Exception)
 
 void CmdNetClassEdit::performUndo() throw (Exception)
 {
+    mCircuit.setModified();
     mCircuit.setNetClassName(mNetClass, mOldName); // can throw
 }
 
 void CmdNetClassEdit::performRedo() throw (Exception)
 {
+    mCircuit.setModified();
     mCircuit.setNetClassName(mNetClass, mNewName); // can throw
 }
 
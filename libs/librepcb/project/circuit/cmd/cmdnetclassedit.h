@@ -53,6 +53,11 @@ class CmdNetClassEdit final : public UndoCommand
         // Setters
         void setName(const QString& name) noexcept;
 
+        // Inherited from UndoCommand
+
+        /// @copydoc UndoCommand::getApproxMemoryUsage()
+        qint64 getApproxMemoryUsage() const noexcept override;
+
 
     private:
 
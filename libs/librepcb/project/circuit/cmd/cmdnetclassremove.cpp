@@ -58,11 +58,13 @@ bool CmdNetClassRemove::performExecute() throw (Exception)
 
 void CmdNetClassRemove::performUndo() throw (Exception)
 {
+    mCircuit.setModified();
     mCircuit.addNetClass(mNetClass); // can throw
 }
 
 void CmdNetClassRemove::performRedo() throw (Exception)
 {
+    mCircuit.setModified();
     mCircuit.removeNetClass(mNetClass); // can throw
 }
 
@@ -71,11 +71,13 @@ bool CmdNetSignalAdd::performExecute() throw (Exception)
 
 void CmdNetSignalAdd::performUndo() throw (Exception)
 {
+    mCircuit.setModified();
     mCircuit.removeNetSignal(*mNetSignal); // can throw
 }
 
 void CmdNetSignalAdd::performRedo() throw (Exception)
 {
+    mCircuit.setModified();
     mCircuit.addNetSignal(*mNetSignal); // can throw
 }
 
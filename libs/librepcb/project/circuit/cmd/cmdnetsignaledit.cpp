@@ -61,6 +61,23 @@ void CmdNetSignalEdit::setName(const QString& name, bool isAutoName) noexcept
  *  Inherited from UndoCommand
  ****************************************************************************************/
 
+qint64 CmdNetSignalEdit::getApproxMemoryUsage() const noexcept
+{
+    return UndoCommand::getApproxMemoryUsage() +
+           (mOldName.capacity() + mNewName.capacity()) * sizeof(QChar);
+}
+
+bool CmdNetSignalEdit::mergeWith(const UndoCommand& other) noexcept
+{
+    // merge only consecutive edits of the same netsignal
+    const CmdNetSignalEdit* cmd = dynamic_cast<const CmdNetSignalEdit*>(&other);
+    if ((!cmd) || (&cmd->mNetSignal != &mNetSignal)) return false;
+    Q_ASSERT(wasEverExecuted() && cmd->wasEverExecuted());
+    mNewName = cmd->mNewName;
+    mNewIsAutoName = cmd->mNewIsAutoName;
+    return true;
+}
+
 bool CmdNetSignalEdit::performExecute() throw (Exception)
 {
     performRedo(); // can throw
@@ -70,11 +87,13 @@ bool CmdNetSignalEdit::performExecute() throw (Exception)
 
 void CmdNetSignalEdit::performUndo() throw (Exception)
 {
+    mCircuit.setModified();
     mCircuit.setNetSignalName(mNetSignal, mOldName, mOldIsAutoName); // can throw
 }
 
 void CmdNetSignalEdit::performRedo() throw (Exception)
 {
+    mCircuit.setModified();
     mCircuit.setNetSignalName(mNetSignal, mNewName, mNewIsAutoName); // can throw
 }
 
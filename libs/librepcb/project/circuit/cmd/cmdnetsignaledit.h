@@ -54,6 +54,15 @@ class CmdNetSignalEdit final : public UndoCommand
         void setName(const QString& name, bool isAutoName) noexcept;
 
 
+        // Inherited from UndoCommand
+
+        /// @copydoc UndoCommand::getApproxMemoryUsage()
+        qint64 getApproxMemoryUsage() const noexcept override;
+
+        /// @copydoc UndoCommand::mergeWith()
+        bool mergeWith(const UndoCommand& other) noexcept override;
+
+
     private:
 
         // Private Methods
@@ -58,11 +58,13 @@ bool CmdNetSignalRemove::performExecute() throw (Exception)
 
 void CmdNetSignalRemove::performUndo() throw (Exception)
 {
+    mCircuit.setModified();
     mCircuit.addNetSignal(mNetSignal); // can throw
 }
 
 void CmdNetSignalRemove::performRedo() throw (Exception)
 {
+    mCircuit.setModified();
     mCircuit.removeNetSignal(mNetSignal); // can throw
 }
 
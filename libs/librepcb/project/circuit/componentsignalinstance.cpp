@@ -33,6 +33,7 @@
 #include "../project.h"
 #include "../settings/projectsettings.h"
 #include "../schematics/items/si_symbolpin.h"
+#include "../boards/board.h"
 #include "../boards/items/bi_footprintpad.h"
 
 /*****************************************************************************************
@@ -182,6 +183,11 @@ void ComponentSignalInstance::setNetSignal(NetSignal* netsignal) throw (Exceptio
                       disconnect(netsignal, &NetSignal::nameChanged,
                       this, &ComponentSignalInstance::netSignalNameChanged);});
     }
+    foreach (BI_FootprintPad* pad, mRegisteredFootprintPads) {
+        // the pads of this signal are moved to another net, update their air wires
+        pad->getBoard().scheduleAirWiresRebuild(mNetSignal);
+        pad->getBoard().scheduleAirWiresRebuild(netsignal);
+    }
     mNetSignal = netsignal;
     updateErcMessages();
     sgl.dismiss();
@@ -73,6 +73,13 @@ void CmdProjectSetMetadata::setVersion(const QString& newVersion) noexcept
  *  Inherited from UndoCommand
  ****************************************************************************************/
 
+qint64 CmdProjectSetMetadata::getApproxMemoryUsage() const noexcept
+{
+    return UndoCommand::getApproxMemoryUsage() + (mOldName.capacity() +
+           mNewName.capacity() + mOldAuthor.capacity() + mNewAuthor.capacity() +
+           mOldVersion.capacity() + mNewVersion.capacity()) * sizeof(QChar);
+}
+
 bool CmdProjectSetMetadata::performExecute() throw (Exception)
 {
     performRedo(); // can throw
@@ -82,6 +89,7 @@ bool CmdProjectSetMetadata::performExecute() throw (Exception)
 
 void CmdProjectSetMetadata::performUndo() throw (Exception)
 {
+    mProject.setModified();
     mProject.setName(mOldName);
     mProject.setAuthor(mOldAuthor);
     mProject.setVersion(mOldVersion);
@@ -89,6 +97,7 @@ void CmdProjectSetMetadata::performUndo() throw (Exception)
 
 void CmdProjectSetMetadata::performRedo() throw (Exception)
 {
+    mProject.setModified();
     mProject.setName(mNewName);
     mProject.setAuthor(mNewAuthor);
     mProject.setVersion(mNewVersion);
@@ -54,6 +54,11 @@ class CmdProjectSetMetadata final : public UndoCommand
         void setAuthor(const QString& newAuthor) noexcept;
         void setVersion(const QString& newVersion) noexcept;
 
+        // Inherited from UndoCommand
+
+        /// @copydoc UndoCommand::getApproxMemoryUsage()
+        qint64 getApproxMemoryUsage() const noexcept override;
+
 
     private:
 
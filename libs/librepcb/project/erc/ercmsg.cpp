@@ -63,6 +63,7 @@ void ErcMsg::setVisible(bool visible) noexcept
 {
     if (visible == mIsVisible) return;
     mIsVisible = visible;
+    if (mIsIgnored) mErcMsgList.setModified();
     mIsIgnored = false; // changing the visibility will always reset the ignore flag!
 
     if (mIsVisible)
@@ -75,6 +76,7 @@ void ErcMsg::setIgnored(bool ignored) noexcept
 {
     if (ignored == mIsIgnored) return;
     mIsIgnored = ignored;
+    mErcMsgList.setModified();
     mErcMsgList.update(this);
 }
 
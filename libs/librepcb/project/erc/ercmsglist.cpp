@@ -41,7 +41,8 @@ namespace project {
 
 ErcMsgList::ErcMsgList(Project& project, bool restore, bool readOnly, bool create) throw (Exception) :
     QObject(&project), mProject(project),
-    mXmlFilepath(project.getPath().getPathTo("core/erc.xml")), mXmlFile(nullptr)
+    mXmlFilepath(project.getPath().getPathTo("core/erc.xml")), mXmlFile(nullptr),
+    mIsRestoringIgnoreState(false)
 {
     // try to create/open the XML file "erc.xml"
     if (create) {
@@ -94,6 +95,7 @@ void ErcMsgList::restoreIgnoreState() noexcept
 
     QSharedPointer<XmlDomDocument> doc = mXmlFile->parseFileAndBuildDomTree();
     XmlDomElement& root = doc->getRoot();
+    mIsRestoringIgnoreState = true;
 
     // reset all ignore attributes
     foreach (ErcMsg* ercMsg, mItems)
@@ -113,6 +115,13 @@ void ErcMsgList::restoreIgnoreState() noexcept
             }
         }
     }
+    mIsRestoringIgnoreState = false;
+}
+
+void ErcMsgList::setModified() noexcept
+{
+    // only the ignored messages are saved, so only changes of them are relevant
+    if (!mIsRestoringIgnoreState) mXmlFile->setModified();
 }
 
 bool ErcMsgList::save(bool toOriginal, QStringList& errors) noexcept
@@ -120,6 +129,7 @@ bool ErcMsgList::save(bool toOriginal, QStringList& errors) noexcept
     bool success = true;
 
     // Save "core/erc.xml"
+    if (!mXmlFile->isModified(toOriginal)) return true;
     try
     {
         XmlDomDocument doc(*serializeToXmlDomElement());
@@ -134,6 +144,28 @@ bool ErcMsgList::save(bool toOriginal, QStringList& errors) noexcept
     return success;
 }
 
+bool ErcMsgList::createBackupSnapshots(QList<SmartFileSnapshot>& snapshots,
+                                       QStringList& errors) noexcept
+{
+    bool success = true;
+
+    // Snapshot "core/erc.xml"
+    if (!mXmlFile->isModified(false)) return true;
+    try
+    {
+        QSharedPointer<const XmlDomDocument> doc(
+            new XmlDomDocument(*serializeToXmlDomElement()));
+        snapshots.append(mXmlFile->createBackupSnapshot(doc));
+    }
+    catch (Exception& e)
+    {
+        success = false;
+        errors.append(e.getUserMsg());
+    }
+
+    return success;
+}
+
 /*****************************************************************************************
  *  Private Methods
  ****************************************************************************************/
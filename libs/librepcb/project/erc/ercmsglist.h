@@ -34,6 +34,7 @@
 namespace librepcb {
 
 class SmartXmlFile;
+class SmartFileSnapshot;
 
 namespace project {
 
@@ -67,7 +68,9 @@ class ErcMsgList final : public QObject, public IF_XmlSerializableObject
         void remove(ErcMsg* ercMsg) noexcept;
         void update(ErcMsg* ercMsg) noexcept;
         void restoreIgnoreState() noexcept;
+        void setModified() noexcept;
         bool save(bool toOriginal, QStringList& errors) noexcept;
+        bool createBackupSnapshots(QList<SmartFileSnapshot>& snapshots, QStringList& errors) noexcept;
         
         // Operator Overloadings
         ErcMsgList& operator=(const ErcMsgList& rhs) = delete;
@@ -100,6 +103,7 @@ class ErcMsgList final : public QObject, public IF_XmlSerializableObject
 
         // Misc
         QList<ErcMsg*> mItems; ///< contains all visible ERC messages
+        bool mIsRestoringIgnoreState; ///< ignore state changes are not modifications then
 };
 
 /*****************************************************************************************
@@ -52,10 +52,11 @@ namespace project {
  *  Constructors / Destructor
  ****************************************************************************************/
 
-Project::Project(const FilePath& filepath, bool create, bool readOnly) throw (Exception) :
+Project::Project(const FilePath& filepath, bool create, bool readOnly,
+                 bool modelOnly) throw (Exception) :
     QObject(nullptr), IF_AttributeProvider(), mPath(filepath.getParentDir()),
     mFilepath(filepath), mLock(filepath.getParentDir()), mIsRestored(false),
-    mIsReadOnly(readOnly)
+    mIsReadOnly(readOnly), mIsModelOnly(modelOnly)
 {
     qDebug() << (create ? "create project:" : "open project:") << filepath.toNative();
 
@@ -121,6 +122,12 @@ Project::Project(const FilePath& filepath, bool create, bool readOnly) throw (Ex
             break;
         }
         case DirectoryLock::LockStatus::StaleLock: {
+            if (mIsReadOnly) {
+                // the lock is not touched in read-only mode, so just open the last saved
+                // state without asking (allows to open projects without user interaction)
+                mIsRestored = false;
+                break;
+            }
             // the application crashed while this project was open! ask the user what to do
             QMessageBox::StandardButton btn = QMessageBox::question(0, tr("Restore Project?"),
                 tr("It seems that the application was crashed while this project was open. "
@@ -542,6 +549,11 @@ void Project::removeBoard(Board& board, bool deleteBoard) throw (Exception)
  *  General Methods
  ****************************************************************************************/
 
+void Project::setModified() noexcept
+{
+    mXmlFile->setModified();
+}
+
 void Project::save(bool toOriginal) throw (Exception)
 {
     QStringList errors;
@@ -555,6 +567,21 @@ void Project::save(bool toOriginal) throw (Exception)
     Q_ASSERT(errors.isEmpty());
 }
 
+QList<SmartFileSnapshot> Project::createBackupSnapshots() throw (Exception)
+{
+    QList<SmartFileSnapshot> snapshots;
+    QStringList errors;
+
+    if (!createBackupSnapshots(snapshots, errors))
+    {
+        QString msg = QString(tr("The project could not be saved!\n\nError Message:\n%1",
+            "variable count of error messages", errors.count())).arg(errors.join("\n"));
+        throw RuntimeError(__FILE__, __LINE__, QString(), msg);
+    }
+    Q_ASSERT(errors.isEmpty());
+    return snapshots;
+}
+
 /*****************************************************************************************
  *  Helper Methods
  ****************************************************************************************/
@@ -646,7 +673,8 @@ bool Project::save(bool toOriginal, QStringList& errors) noexcept
     // Save version file
     try
     {
-        mVersionFile->save(toOriginal);
+        if (mVersionFile->isModified(toOriginal))
+            mVersionFile->save(toOriginal);
     }
     catch (Exception& e)
     {
@@ -657,9 +685,12 @@ bool Project::save(bool toOriginal, QStringList& errors) noexcept
     // Save *.lpp project file
     try
     {
-        setLastModified(QDateTime::currentDateTime());
-        XmlDomDocument doc(*serializeToXmlDomElement());
-        mXmlFile->save(doc, toOriginal);
+        if (mXmlFile->isModified(toOriginal))
+        {
+            setLastModified(QDateTime::currentDateTime());
+            XmlDomDocument doc(*serializeToXmlDomElement());
+            mXmlFile->save(doc, toOriginal);
+        }
     }
     catch (Exception& e)
     {
@@ -717,6 +748,79 @@ bool Project::save(bool toOriginal, QStringList& errors) noexcept
     return success;
 }
 
+bool Project::createBackupSnapshots(QList<SmartFileSnapshot>& snapshots,
+                                    QStringList& errors) noexcept
+{
+    bool success = true;
+
+    if (mIsReadOnly)
+    {
+        errors.append(tr("The project was opened in read-only mode."));
+        return false;
+    }
+
+    // Snapshot version file
+    try
+    {
+        if (mVersionFile->isModified(false))
+            snapshots.append(mVersionFile->createBackupSnapshot());
+    }
+    catch (Exception& e)
+    {
+        success = false;
+        errors.append(e.getUserMsg());
+    }
+
+    // Snapshot *.lpp project file
+    try
+    {
+        if (mXmlFile->isModified(false))
+        {
+            setLastModified(QDateTime::currentDateTime());
+            QSharedPointer<const XmlDomDocument> doc(
+                new XmlDomDocument(*serializeToXmlDomElement()));
+            snapshots.append(mXmlFile->createBackupSnapshot(doc));
+        }
+    }
+    catch (Exception& e)
+    {
+        success = false;
+        errors.append(e.getUserMsg());
+    }
+
+    // Snapshot circuit
+    if (!mCircuit->createBackupSnapshots(snapshots, errors))
+        success = false;
+
+    // Snapshot all removed and added schematics (*.xml files)
+    foreach (Schematic* schematic, mRemovedSchematics + mSchematics)
+    {
+        if (!schematic->createBackupSnapshots(snapshots, errors))
+            success = false;
+    }
+
+    // Snapshot all removed and added boards (*.xml files)
+    foreach (Board* board, mRemovedBoards + mBoards)
+    {
+        if (!board->createBackupSnapshots(snapshots, errors))
+            success = false;
+    }
+
+    // Save library (only moves directories of added elements, so it's done immediately)
+    if (!mProjectLibrary->save(false, errors))
+        success = false;
+
+    // Snapshot settings
+    if (!mProjectSettings->createBackupSnapshots(snapshots, errors))
+        success = false;
+
+    // Snapshot ERC messages list
+    if (!mErcMsgList->createBackupSnapshots(snapshots, errors))
+        success = false;
+
+    return success;
+}
+
 void Project::printSchematicPages(QPrinter& printer, QList<int>& pages) throw (Exception)
 {
     if (pages.isEmpty())
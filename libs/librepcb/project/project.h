@@ -32,6 +32,7 @@
 #include <librepcb/common/uuid.h>
 #include <librepcb/common/version.h>
 #include <librepcb/common/fileio/directorylock.h>
+#include <librepcb/common/fileio/smartfilesnapshot.h>
 
 /*****************************************************************************************
  *  Namespace / Forward Declarations
@@ -93,11 +94,13 @@ class Project final : public QObject, public IF_AttributeProvider,
          *
          * @param filepath      The filepath to the an existing *.lpp project file
          * @param readOnly      It true, the project will be opened in read-only mode
+         * @param modelOnly     If true, no graphics items are created while loading the
+         *                      schematics and boards (see #isModelOnly())
          *
          * @throw Exception     If the project could not be opened successfully
          */
-        Project(const FilePath& filepath, bool readOnly) throw (Exception) :
-            Project(filepath, false, readOnly) {}
+        Project(const FilePath& filepath, bool readOnly, bool modelOnly = false) throw (Exception) :
+            Project(filepath, false, readOnly, modelOnly) {}
 
         /**
          * @brief The destructor will close the whole project (without saving!)
@@ -128,6 +131,18 @@ class Project final : public QObject, public IF_AttributeProvider,
          */
         bool isReadOnly() const noexcept {return mIsReadOnly;}
 
+        /**
+         * @brief Check whether this project was opened in model-only mode or not
+         *
+         * In model-only mode, the graphics items of schematics and boards are not created
+         * while loading, but only when a schematic or board is shown the first time (see
+         * Schematic#createGraphicsItems() and Board#createGraphicsItems()). This saves
+         * a lot of time and memory for tools which do not need any graphics at all.
+         *
+         * @return See #mIsModelOnly
+         */
+        bool isModelOnly() const noexcept {return mIsModelOnly;}
+
         /**
          * @brief Check whether this project restored from temporary files or not
          *
@@ -433,9 +448,19 @@ class Project final : public QObject, public IF_AttributeProvider,
 
         // General Methods
 
+        /**
+         * @brief Mark the project file (*.lpp) as modified
+         *
+         * Must be called by all undo commands which modify the metadata or the list of
+         * schematics and boards. Otherwise #save() skips the project file.
+         */
+        void setModified() noexcept;
+
         /**
          * @brief Save the whole project to the harddisc
          *
+         * Only files which were modified since they were saved the last time are written.
+         *
          * @param toOriginal    If false, the project is saved only to temporary files
          *
          * @note The whole save procedere is described in @ref doc_project_save.
@@ -444,6 +469,25 @@ class Project final : public QObject, public IF_AttributeProvider,
          */
         void save(bool toOriginal) throw (Exception);
 
+        /**
+         * @brief Take snapshots of all modified files to save them to temporary files later
+         *
+         * This allows to make automatic backups without blocking the caller: Taking the
+         * snapshots only serializes the modified files to DOM trees, while generating
+         * the XML and writing the temporary files is done by SmartFileSnapshot#write(),
+         * which can be called from a worker thread. The project may be modified in the
+         * meantime. Afterwards, SmartFile#backupSnapshotWritten() has to be called in the
+         * thread of the project for every written snapshot. The project must not be
+         * destroyed until all snapshots are written.
+         *
+         * @return The snapshots of all files which were modified since the last backup
+         *
+         * @note The whole save procedere is described in @ref doc_project_save.
+         *
+         * @throw Exception on error
+         */
+        QList<SmartFileSnapshot> createBackupSnapshots() throw (Exception);
+
 
         // Helper Methods
 
@@ -461,7 +505,7 @@ class Project final : public QObject, public IF_AttributeProvider,
         // Static Methods
 
         static Project* create(const FilePath& filepath) throw (Exception)
-        {return new Project(filepath, true, false);}
+        {return new Project(filepath, true, false, false);}
 
         static bool isValidProjectDirectory(const FilePath& dir) noexcept;
         static Version getProjectFileFormatVersion(const FilePath& dir) throw (Exception);
@@ -512,10 +556,12 @@ class Project final : public QObject, public IF_AttributeProvider,
          * @param create        True if the specified project does not exist already and
          *                      must be created.
          * @param readOnly      If true, the project will be opened in read-only mode
+         * @param modelOnly     If true, the project will be opened in model-only mode
          *
          * @throw Exception     If the project could not be created/opened successfully
          */
-        explicit Project(const FilePath& filepath, bool create, bool readOnly) throw (Exception);
+        explicit Project(const FilePath& filepath, bool create, bool readOnly,
+                         bool modelOnly) throw (Exception);
 
         /// @copydoc IF_XmlSerializableObject#checkAttributesValidity()
         bool checkAttributesValidity() const noexcept override;
@@ -535,6 +581,17 @@ class Project final : public QObject, public IF_AttributeProvider,
          */
         bool save(bool toOriginal, QStringList& errors) noexcept;
 
+        /**
+         * @brief Take snapshots of all modified files (see #createBackupSnapshots())
+         *
+         * @param snapshots     All snapshots will be added to this list
+         * @param errors        All errors will be added to this string list (translated)
+         *
+         * @return True on success (then the error list should be empty), false otherwise
+         */
+        bool createBackupSnapshots(QList<SmartFileSnapshot>& snapshots,
+                                   QStringList& errors) noexcept;
+
         /**
          * @brief Print some schematics to a QPrinter (printer or file)
          *
@@ -554,6 +611,7 @@ class Project final : public QObject, public IF_AttributeProvider,
         DirectoryLock mLock; ///< Lock for the whole project directory (see @ref doc_project_lock)
         bool mIsRestored; ///< the constructor will set this to true if the project was restored
         bool mIsReadOnly; ///< the constructor will set this to true if the project was opened in read only mode
+        bool mIsModelOnly; ///< if true, graphics items are only created on demand
 
         // Attributes
         QString mName;              ///< the name of the project
@@ -60,11 +60,15 @@ bool CmdSchematicAdd::performExecute() throw (Exception)
 
 void CmdSchematicAdd::performUndo() throw (Exception)
 {
+    mProject.setModified();
+    mSchematic->setModified();
     mProject.removeSchematic(*mSchematic); // can throw
 }
 
 void CmdSchematicAdd::performRedo() throw (Exception)
 {
+    mProject.setModified();
+    mSchematic->setModified();
     mProject.addSchematic(*mSchematic, mPageIndex); // can throw
 }
 
@@ -22,6 +22,7 @@
  ****************************************************************************************/
 #include <QtCore>
 #include "cmdschematicnetlabeledit.h"
+#include "../schematic.h"
 #include "../items/si_netlabel.h"
 
 /*****************************************************************************************
@@ -109,6 +110,7 @@ bool CmdSchematicNetLabelEdit::performExecute() throw (Exception)
 
 void CmdSchematicNetLabelEdit::performUndo() throw (Exception)
 {
+    mNetLabel.getSchematic().setModified();
     mNetLabel.setNetSignal(*mOldNetSignal);
     mNetLabel.setPosition(mOldPos);
     mNetLabel.setRotation(mOldRotation);
@@ -116,6 +118,7 @@ void CmdSchematicNetLabelEdit::performUndo() throw (Exception)
 
 void CmdSchematicNetLabelEdit::performRedo() throw (Exception)
 {
+    mNetLabel.getSchematic().setModified();
     mNetLabel.setNetSignal(*mNewNetSignal);
     mNetLabel.setPosition(mNewPos);
     mNetLabel.setRotation(mNewRotation);
@@ -59,11 +59,13 @@ bool CmdSchematicNetLabelRemove::performExecute() throw (Exception)
 
 void CmdSchematicNetLabelRemove::performUndo() throw (Exception)
 {
+    mSchematic.setModified();
     mSchematic.addNetLabel(mNetLabel); // can throw
 }
 
 void CmdSchematicNetLabelRemove::performRedo() throw (Exception)
 {
+    mSchematic.setModified();
     mSchematic.removeNetLabel(mNetLabel); // can throw
 }
 
@@ -71,11 +71,13 @@ bool CmdSchematicNetLineAdd::performExecute() throw (Exception)
 
 void CmdSchematicNetLineAdd::performUndo() throw (Exception)
 {
+    mSchematic.setModified();
     mSchematic.removeNetLine(*mNetLine); // can throw
 }
 
 void CmdSchematicNetLineAdd::performRedo() throw (Exception)
 {
+    mSchematic.setModified();
     mSchematic.addNetLine(*mNetLine); // can throw
 }
 
@@ -58,11 +58,13 @@ bool CmdSchematicNetLineRemove::performExecute() throw (Exception)
 
 void CmdSchematicNetLineRemove::performUndo() throw (Exception)
 {
+    mSchematic.setModified();
     mSchematic.addNetLine(mNetLine); // can throw
 }
 
 void CmdSchematicNetLineRemove::performRedo() throw (Exception)
 {
+    mSchematic.setModified();
     mSchematic.removeNetLine(mNetLine); // can throw
 }
 
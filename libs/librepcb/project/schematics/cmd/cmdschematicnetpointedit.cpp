@@ -22,6 +22,7 @@
  ****************************************************************************************/
 #include <QtCore>
 #include "cmdschematicnetpointedit.h"
+#include "../schematic.h"
 #include <librepcb/common/scopeguardlist.h>
 #include "../items/si_netpoint.h"
 
@@ -93,6 +94,7 @@ bool CmdSchematicNetPointEdit::performExecute() throw (Exception)
 
 void CmdSchematicNetPointEdit::performUndo() throw (Exception)
 {
+    mNetPoint.getSchematic().setModified();
     ScopeGuardList sgl;
     mNetPoint.setNetSignal(*mOldNetSignal); // can throw
     sgl.add([&](){mNetPoint.setNetSignal(*mNewNetSignal);});
@@ -104,6 +106,7 @@ void CmdSchematicNetPointEdit::performUndo() throw (Exception)
 
 void CmdSchematicNetPointEdit::performRedo() throw (Exception)
 {
+    mNetPoint.getSchematic().setModified();
     ScopeGuardList sgl;
     mNetPoint.setNetSignal(*mNewNetSignal); // can throw
     sgl.add([&](){mNetPoint.setNetSignal(*mOldNetSignal);});
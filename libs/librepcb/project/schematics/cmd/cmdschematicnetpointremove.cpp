@@ -58,11 +58,13 @@ bool CmdSchematicNetPointRemove::performExecute() throw (Exception)
 
 void CmdSchematicNetPointRemove::performUndo() throw (Exception)
 {
+    mSchematic.setModified();
     mSchematic.addNetPoint(mNetPoint); // can throw
 }
 
 void CmdSchematicNetPointRemove::performRedo() throw (Exception)
 {
+    mSchematic.setModified();
     mSchematic.removeNetPoint(mNetPoint); // can throw
 }
 
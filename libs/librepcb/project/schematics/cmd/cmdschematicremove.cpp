@@ -60,11 +60,15 @@ bool CmdSchematicRemove::performExecute() throw (Exception)
 
 void CmdSchematicRemove::performUndo() throw (Exception)
 {
+    mProject.setModified();
+    mSchematic.setModified();
     mProject.addSchematic(mSchematic, mPageIndex); // can throw
 }
 
 void CmdSchematicRemove::performRedo() throw (Exception)
 {
+    mProject.setModified();
+    mSchematic.setModified();
     mProject.removeSchematic(mSchematic); // can throw
 }
 
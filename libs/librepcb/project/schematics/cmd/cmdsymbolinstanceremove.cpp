@@ -58,11 +58,13 @@ bool CmdSymbolInstanceRemove::performExecute() throw (Exception)
 
 void CmdSymbolInstanceRemove::performUndo() throw (Exception)
 {
+    mSchematic.setModified();
     mSchematic.addSymbol(mSymbol); // can throw
 }
 
 void CmdSymbolInstanceRemove::performRedo() throw (Exception)
 {
+    mSchematic.setModified();
     mSchematic.removeSymbol(mSymbol); // can throw
 }
 
@@ -75,20 +75,28 @@ void SI_Base::setSelected(bool selected) noexcept
  *  General Methods
  ****************************************************************************************/
 
-void SI_Base::addToSchematic(GraphicsScene& scene, SGI_Base& item) noexcept
+void SI_Base::addToSchematic(GraphicsScene& scene, SGI_Base* item) noexcept
 {
     Q_ASSERT(!mIsAddedToSchematic);
-    scene.addItem(item);
+    if (item) scene.addItem(*item);
     mIsAddedToSchematic = true;
 }
 
-void SI_Base::removeFromSchematic(GraphicsScene& scene, SGI_Base& item) noexcept
+void SI_Base::removeFromSchematic(GraphicsScene& scene, SGI_Base* item) noexcept
 {
     Q_ASSERT(mIsAddedToSchematic);
-    scene.removeItem(item);
+    if (item) scene.removeItem(*item);
     mIsAddedToSchematic = false;
 }
 
+void SI_Base::graphicsItemCreated(SGI_Base& item) noexcept
+{
+    if (mIsAddedToSchematic) {
+        mSchematic.getGraphicsScene().addItem(item);
+    }
+    mSchematic.itemGeometryChanged(*this); // the grab area depends on the graphics item
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
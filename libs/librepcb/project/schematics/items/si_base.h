@@ -83,6 +83,14 @@ class SI_Base : public QObject
         virtual void setSelected(bool selected) noexcept;
 
         // General Methods
+        /**
+         * @brief Create the graphics item(s) of this item if not done yet
+         *
+         * Projects opened in model-only mode do not create any graphics items while
+         * loading. They are created on demand by this method, which also adds them to
+         * the graphics scene of the schematic if the item is already added to it.
+         */
+        virtual void createGraphicsItems() noexcept = 0;
         virtual void addToSchematic(GraphicsScene& scene) throw (Exception) = 0;
         virtual void removeFromSchematic(GraphicsScene& scene) throw (Exception) = 0;
 
@@ -93,8 +101,9 @@ class SI_Base : public QObject
     protected:
 
         // General Methods
-        void addToSchematic(GraphicsScene& scene, SGI_Base& item) noexcept;
-        void removeFromSchematic(GraphicsScene& scene, SGI_Base& item) noexcept;
+        void addToSchematic(GraphicsScene& scene, SGI_Base* item) noexcept;
+        void removeFromSchematic(GraphicsScene& scene, SGI_Base* item) noexcept;
+        void graphicsItemCreated(SGI_Base& item) noexcept;
 
 
     protected:
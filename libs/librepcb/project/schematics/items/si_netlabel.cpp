@@ -69,10 +69,7 @@ void SI_NetLabel::init() throw (Exception)
 {
     connect(mNetSignal, &NetSignal::nameChanged, this, &SI_NetLabel::netSignalNameChanged);
 
-    // create the graphics item
-    mGraphicsItem.reset(new SGI_NetLabel(*this));
-    mGraphicsItem->setPos(mPosition.toPxQPointF());
-    mGraphicsItem->setRotation(-mRotation.toDeg());
+    if (mSchematic.hasGraphicsItems()) createGraphicsItems();
 
     if (!checkAttributesValidity()) throw LogicError(__FILE__, __LINE__);
 }
@@ -101,7 +98,8 @@ void SI_NetLabel::setNetSignal(NetSignal& netsignal) noexcept
         disconnect(mNetSignal, &NetSignal::nameChanged, this, &SI_NetLabel::netSignalNameChanged);
         connect(&netsignal, &NetSignal::nameChanged, this, &SI_NetLabel::netSignalNameChanged);
         mNetSignal = &netsignal;
-        mGraphicsItem->updateCacheAndRepaint();
+        if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
+        mSchematic.itemGeometryChanged(*this);
     }
 }
 
@@ -109,7 +107,8 @@ void SI_NetLabel::setPosition(const Point& position) noexcept
 {
     if (position != mPosition) {
         mPosition = position;
-        mGraphicsItem->setPos(mPosition.toPxQPointF());
+        if (mGraphicsItem) mGraphicsItem->setPos(mPosition.toPxQPointF());
+        mSchematic.itemGeometryChanged(*this);
     }
 }
 
@@ -117,8 +116,11 @@ void SI_NetLabel::setRotation(const Angle& rotation) noexcept
 {
     if (rotation != mRotation) {
         mRotation = rotation;
-        mGraphicsItem->setRotation(-mRotation.toDeg());
-        mGraphicsItem->updateCacheAndRepaint();
+        if (mGraphicsItem) {
+            mGraphicsItem->setRotation(-mRotation.toDeg());
+            mGraphicsItem->updateCacheAndRepaint();
+        }
+        mSchematic.itemGeometryChanged(*this);
     }
 }
 
@@ -126,6 +128,16 @@ void SI_NetLabel::setRotation(const Angle& rotation) noexcept
  *  General Methods
  ****************************************************************************************/
 
+void SI_NetLabel::createGraphicsItems() noexcept
+{
+    if (!mGraphicsItem) {
+        mGraphicsItem.reset(new SGI_NetLabel(*this));
+        mGraphicsItem->setPos(mPosition.toPxQPointF());
+        mGraphicsItem->setRotation(-mRotation.toDeg());
+        SI_Base::graphicsItemCreated(*mGraphicsItem);
+    }
+}
+
 void SI_NetLabel::addToSchematic(GraphicsScene& scene) throw (Exception)
 {
     if (isAddedToSchematic()) {
@@ -133,8 +145,9 @@ void SI_NetLabel::addToSchematic(GraphicsScene& scene) throw (Exception)
     }
     mNetSignal->registerSchematicNetLabel(*this); // can throw
     mHighlightChangedConnection = connect(mNetSignal, &NetSignal::highlightedChanged,
-                                          [this](){mGraphicsItem->update();});
-    SI_Base::addToSchematic(scene, *mGraphicsItem);
+                                          [this](){if (mGraphicsItem) mGraphicsItem->update();});
+    if (mSchematic.hasGraphicsItems()) createGraphicsItems();
+    SI_Base::addToSchematic(scene, mGraphicsItem.data());
 }
 
 void SI_NetLabel::removeFromSchematic(GraphicsScene& scene) throw (Exception)
@@ -144,7 +157,7 @@ void SI_NetLabel::removeFromSchematic(GraphicsScene& scene) throw (Exception)
     }
     mNetSignal->unregisterSchematicNetLabel(*this); // can throw
     disconnect(mHighlightChangedConnection);
-    SI_Base::removeFromSchematic(scene, *mGraphicsItem);
+    SI_Base::removeFromSchematic(scene, mGraphicsItem.data());
 }
 
 XmlDomElement* SI_NetLabel::serializeToXmlDomElement() const throw (Exception)
@@ -166,13 +179,14 @@ XmlDomElement* SI_NetLabel::serializeToXmlDomElement() const throw (Exception)
 
 QPainterPath SI_NetLabel::getGrabAreaScenePx() const noexcept
 {
+    if (!mGraphicsItem) return QPainterPath();
     return mGraphicsItem->sceneTransform().map(mGraphicsItem->shape());
 }
 
 void SI_NetLabel::setSelected(bool selected) noexcept
 {
     SI_Base::setSelected(selected);
-    mGraphicsItem->update();
+    if (mGraphicsItem) mGraphicsItem->update();
 }
 
 /*****************************************************************************************
@@ -182,7 +196,8 @@ void SI_NetLabel::setSelected(bool selected) noexcept
 void SI_NetLabel::netSignalNameChanged(const QString& newName) noexcept
 {
     Q_UNUSED(newName);
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
+    mSchematic.itemGeometryChanged(*this);
 }
 
 /*****************************************************************************************
@@ -69,6 +69,7 @@ class SI_NetLabel final : public SI_Base, public IF_XmlSerializableObject
         void setRotation(const Angle& rotation) noexcept;
 
         // General Methods
+        void createGraphicsItems() noexcept override;
         void addToSchematic(GraphicsScene& scene) throw (Exception) override;
         void removeFromSchematic(GraphicsScene& scene) throw (Exception) override;
 
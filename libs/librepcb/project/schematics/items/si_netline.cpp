@@ -95,7 +95,7 @@ void SI_NetLine::init() throw (Exception)
             tr("SI_NetLine: both endpoints are the same."));
     }
 
-    mGraphicsItem.reset(new SGI_NetLine(*this));
+    if (mSchematic.hasGraphicsItems()) createGraphicsItems();
     updateLine();
 
     if (!checkAttributesValidity()) throw LogicError(__FILE__, __LINE__);
@@ -130,7 +130,8 @@ void SI_NetLine::setWidth(const Length& width) noexcept
     Q_ASSERT(width >= 0);
     if ((width != mWidth) && (width >= 0)) {
         mWidth = width;
-        mGraphicsItem->updateCacheAndRepaint();
+        if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
+        mSchematic.itemGeometryChanged(*this);
     }
 }
 
@@ -138,6 +139,14 @@ void SI_NetLine::setWidth(const Length& width) noexcept
  *  General Methods
  ****************************************************************************************/
 
+void SI_NetLine::createGraphicsItems() noexcept
+{
+    if (!mGraphicsItem) {
+        mGraphicsItem.reset(new SGI_NetLine(*this));
+        SI_Base::graphicsItemCreated(*mGraphicsItem);
+    }
+}
+
 void SI_NetLine::addToSchematic(GraphicsScene& scene) throw (Exception)
 {
     if (isAddedToSchematic() || (&mStartPoint->getNetSignal() != &mEndPoint->getNetSignal())) {
@@ -147,8 +156,9 @@ void SI_NetLine::addToSchematic(GraphicsScene& scene) throw (Exception)
     auto sg = scopeGuard([&](){mStartPoint->unregisterNetLine(*this);});
     mEndPoint->registerNetLine(*this); // can throw
     mHighlightChangedConnection = connect(&getNetSignal(), &NetSignal::highlightedChanged,
-                                          [this](){mGraphicsItem->update();});
-    SI_Base::addToSchematic(scene, *mGraphicsItem);
+                                          [this](){if (mGraphicsItem) mGraphicsItem->update();});
+    if (mSchematic.hasGraphicsItems()) createGraphicsItems();
+    SI_Base::addToSchematic(scene, mGraphicsItem.data());
     sg.dismiss();
 }
 
@@ -161,14 +171,15 @@ void SI_NetLine::removeFromSchematic(GraphicsScene& scene) throw (Exception)
     auto sg = scopeGuard([&](){mEndPoint->registerNetLine(*this);});
     mStartPoint->unregisterNetLine(*this); // can throw
     disconnect(mHighlightChangedConnection);
-    SI_Base::removeFromSchematic(scene, *mGraphicsItem);
+    SI_Base::removeFromSchematic(scene, mGraphicsItem.data());
     sg.dismiss();
 }
 
 void SI_NetLine::updateLine() noexcept
 {
     mPosition = (mStartPoint->getPosition() + mEndPoint->getPosition()) / 2;
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
+    mSchematic.itemGeometryChanged(*this);
 }
 
 XmlDomElement* SI_NetLine::serializeToXmlDomElement() const throw (Exception)
@@ -189,13 +200,13 @@ XmlDomElement* SI_NetLine::serializeToXmlDomElement() const throw (Exception)
 
 QPainterPath SI_NetLine::getGrabAreaScenePx() const noexcept
 {
-    return mGraphicsItem->shape();
+    return mGraphicsItem ? mGraphicsItem->shape() : QPainterPath();
 }
 
 void SI_NetLine::setSelected(bool selected) noexcept
 {
     SI_Base::setSelected(selected);
-    mGraphicsItem->update();
+    if (mGraphicsItem) mGraphicsItem->update();
 }
 
 /*****************************************************************************************
@@ -70,6 +70,7 @@ class SI_NetLine final : public SI_Base, public IF_XmlSerializableObject
         void setWidth(const Length& width) noexcept;
 
         // General Methods
+        void createGraphicsItems() noexcept override;
         void addToSchematic(GraphicsScene& scene) throw (Exception) override;
         void removeFromSchematic(GraphicsScene& scene) throw (Exception) override;
         void updateLine() noexcept;
@@ -99,9 +99,7 @@ SI_NetPoint::SI_NetPoint(Schematic& schematic, NetSignal& netsignal, SI_SymbolPi
 
 void SI_NetPoint::init() throw (Exception)
 {
-    // create the graphics item
-    mGraphicsItem.reset(new SGI_NetPoint(*this));
-    mGraphicsItem->setPos(mPosition.toPxQPointF());
+    if (mSchematic.hasGraphicsItems()) createGraphicsItems();
 
     // create ERC messages
     mErcMsgDeadNetPoint.reset(new ErcMsg(mSchematic.getProject(), *this,
@@ -188,14 +186,16 @@ void SI_NetPoint::setPinToAttach(SI_SymbolPin* pin) throw (Exception)
         sgl.dismiss();
     }
     mSymbolPin = pin;
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
+    mSchematic.itemGeometryChanged(*this);
 }
 
 void SI_NetPoint::setPosition(const Point& position) noexcept
 {
     if (position != mPosition) {
         mPosition = position;
-        mGraphicsItem->setPos(mPosition.toPxQPointF());
+        if (mGraphicsItem) mGraphicsItem->setPos(mPosition.toPxQPointF());
+        mSchematic.itemGeometryChanged(*this);
         updateLines();
     }
 }
@@ -204,6 +204,15 @@ void SI_NetPoint::setPosition(const Point& position) noexcept
  *  General Methods
  ****************************************************************************************/
 
+void SI_NetPoint::createGraphicsItems() noexcept
+{
+    if (!mGraphicsItem) {
+        mGraphicsItem.reset(new SGI_NetPoint(*this));
+        mGraphicsItem->setPos(mPosition.toPxQPointF());
+        SI_Base::graphicsItemCreated(*mGraphicsItem);
+    }
+}
+
 void SI_NetPoint::addToSchematic(GraphicsScene& scene) throw (Exception)
 {
     if (isAddedToSchematic() || isUsed()) {
@@ -221,9 +230,10 @@ void SI_NetPoint::addToSchematic(GraphicsScene& scene) throw (Exception)
         sgl.add([&](){mSymbolPin->unregisterNetPoint(*this);});
     }
     mHighlightChangedConnection = connect(mNetSignal, &NetSignal::highlightedChanged,
-                                          [this](){mGraphicsItem->update();});
+                                          [this](){if (mGraphicsItem) mGraphicsItem->update();});
     mErcMsgDeadNetPoint->setVisible(true);
-    SI_Base::addToSchematic(scene, *mGraphicsItem);
+    if (mSchematic.hasGraphicsItems()) createGraphicsItems();
+    SI_Base::addToSchematic(scene, mGraphicsItem.data());
     sgl.dismiss();
 }
 
@@ -245,7 +255,7 @@ void SI_NetPoint::removeFromSchematic(GraphicsScene& scene) throw (Exception)
     sgl.add([&](){mNetSignal->registerSchematicNetPoint(*this);});
     disconnect(mHighlightChangedConnection);
     mErcMsgDeadNetPoint->setVisible(false);
-    SI_Base::removeFromSchematic(scene, *mGraphicsItem);
+    SI_Base::removeFromSchematic(scene, mGraphicsItem.data());
     sgl.dismiss();
 }
 
@@ -258,7 +268,8 @@ void SI_NetPoint::registerNetLine(SI_NetLine& netline) throw (Exception)
     }
     mRegisteredLines.append(&netline);
     netline.updateLine();
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
+    mSchematic.itemGeometryChanged(*this); // junction visibility may have changed
     mErcMsgDeadNetPoint->setVisible(mRegisteredLines.isEmpty());
 }
 
@@ -269,7 +280,8 @@ void SI_NetPoint::unregisterNetLine(SI_NetLine& netline) throw (Exception)
     }
     mRegisteredLines.removeOne(&netline);
     netline.updateLine();
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
+    mSchematic.itemGeometryChanged(*this); // junction visibility may have changed
     mErcMsgDeadNetPoint->setVisible(mRegisteredLines.isEmpty());
 }
 
@@ -304,13 +316,14 @@ XmlDomElement* SI_NetPoint::serializeToXmlDomElement() const throw (Exception)
 
 QPainterPath SI_NetPoint::getGrabAreaScenePx() const noexcept
 {
+    if (!mGraphicsItem) return QPainterPath();
     return mGraphicsItem->shape().translated(mPosition.toPxQPointF());
 }
 
 void SI_NetPoint::setSelected(bool selected) noexcept
 {
     SI_Base::setSelected(selected);
-    mGraphicsItem->update();
+    if (mGraphicsItem) mGraphicsItem->update();
 }
 
 /*****************************************************************************************
@@ -82,6 +82,7 @@ class SI_NetPoint final : public SI_Base, public IF_XmlSerializableObject,
         void setPosition(const Point& position) noexcept;
 
         // General Methods
+        void createGraphicsItems() noexcept override;
         void addToSchematic(GraphicsScene& scene) throw (Exception) override;
         void removeFromSchematic(GraphicsScene& scene) throw (Exception) override;
         void registerNetLine(SI_NetLine& netline) throw (Exception);
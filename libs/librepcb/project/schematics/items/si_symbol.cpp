@@ -85,9 +85,7 @@ void SI_Symbol::init(const Uuid& symbVarItemUuid) throw (Exception)
             .arg(mSymbVarItem->getSymbolUuid().toStr()));
     }
 
-    mGraphicsItem.reset(new SGI_Symbol(*this));
-    mGraphicsItem->setPos(mPosition.toPxQPointF());
-    mGraphicsItem->setRotation(-mRotation.toDeg());
+    if (mSchematic.hasGraphicsItems()) createGraphicsItems();
 
     foreach (const Uuid& libPinUuid, mSymbol->getPinUuids()) {
         const library::SymbolPin* libPin = mSymbol->getPinByUuid(libPinUuid);
@@ -136,8 +134,11 @@ void SI_Symbol::setPosition(const Point& newPos) noexcept
 {
     if (newPos != mPosition) {
         mPosition = newPos;
-        mGraphicsItem->setPos(newPos.toPxQPointF());
-        mGraphicsItem->updateCacheAndRepaint();
+        if (mGraphicsItem) {
+            mGraphicsItem->setPos(newPos.toPxQPointF());
+            mGraphicsItem->updateCacheAndRepaint();
+        }
+        mSchematic.itemGeometryChanged(*this);
         foreach (SI_SymbolPin* pin, mPins) {
             pin->updatePosition();
         }
@@ -148,8 +149,11 @@ void SI_Symbol::setRotation(const Angle& newRotation) noexcept
 {
     if (newRotation != mRotation) {
         mRotation = newRotation;
-        mGraphicsItem->setRotation(-newRotation.toDeg());
-        mGraphicsItem->updateCacheAndRepaint();
+        if (mGraphicsItem) {
+            mGraphicsItem->setRotation(-newRotation.toDeg());
+            mGraphicsItem->updateCacheAndRepaint();
+        }
+        mSchematic.itemGeometryChanged(*this);
         foreach (SI_SymbolPin* pin, mPins) {
             pin->updatePosition();
         }
@@ -160,6 +164,19 @@ void SI_Symbol::setRotation(const Angle& newRotation) noexcept
  *  General Methods
  ****************************************************************************************/
 
+void SI_Symbol::createGraphicsItems() noexcept
+{
+    if (!mGraphicsItem) {
+        mGraphicsItem.reset(new SGI_Symbol(*this));
+        mGraphicsItem->setPos(mPosition.toPxQPointF());
+        mGraphicsItem->setRotation(-mRotation.toDeg());
+        SI_Base::graphicsItemCreated(*mGraphicsItem);
+    }
+    foreach (SI_SymbolPin* pin, mPins) {
+        pin->createGraphicsItems();
+    }
+}
+
 void SI_Symbol::addToSchematic(GraphicsScene& scene) throw (Exception)
 {
     if (isAddedToSchematic()) {
@@ -172,7 +189,8 @@ void SI_Symbol::addToSchematic(GraphicsScene& scene) throw (Exception)
         pin->addToSchematic(scene); // can throw
         sgl.add([pin, &scene](){pin->removeFromSchematic(scene);});
     }
-    SI_Base::addToSchematic(scene, *mGraphicsItem);
+    if (mSchematic.hasGraphicsItems()) createGraphicsItems();
+    SI_Base::addToSchematic(scene, mGraphicsItem.data());
     sgl.dismiss();
 }
 
@@ -188,7 +206,7 @@ void SI_Symbol::removeFromSchematic(GraphicsScene& scene) throw (Exception)
     }
     mComponentInstance->unregisterSymbol(*this); // can throw
     sgl.add([&](){mComponentInstance->registerSymbol(*this);});
-    SI_Base::removeFromSchematic(scene, *mGraphicsItem);
+    SI_Base::removeFromSchematic(scene, mGraphicsItem.data());
     sgl.dismiss();
 }
 
@@ -240,13 +258,14 @@ bool SI_Symbol::getAttributeValue(const QString& attrNS, const QString& attrKey,
 
 QPainterPath SI_Symbol::getGrabAreaScenePx() const noexcept
 {
+    if (!mGraphicsItem) return QPainterPath();
     return mGraphicsItem->sceneTransform().map(mGraphicsItem->shape());
 }
 
 void SI_Symbol::setSelected(bool selected) noexcept
 {
     SI_Base::setSelected(selected);
-    mGraphicsItem->update();
+    if (mGraphicsItem) mGraphicsItem->update();
     foreach (SI_SymbolPin* pin, mPins) {
         pin->setSelected(selected);
     }
@@ -258,7 +277,8 @@ void SI_Symbol::setSelected(bool selected) noexcept
 
 void SI_Symbol::schematicOrComponentAttributesChanged()
 {
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) mGraphicsItem->updateCacheAndRepaint();
+    mSchematic.itemGeometryChanged(*this);
 }
 
 /*****************************************************************************************
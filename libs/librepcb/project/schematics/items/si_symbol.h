@@ -86,6 +86,7 @@ class SI_Symbol final : public SI_Base, public IF_XmlSerializableObject,
         void setRotation(const Angle& newRotation) noexcept;
 
         // General Methods
+        void createGraphicsItems() noexcept override;
         void addToSchematic(GraphicsScene& scene) throw (Exception) override;
         void removeFromSchematic(GraphicsScene& scene) throw (Exception) override;
 
@@ -68,7 +68,7 @@ SI_SymbolPin::SI_SymbolPin(SI_Symbol& symbol, const Uuid& pinUuid) :
     Uuid cmpSignalUuid = mPinSignalMapItem->getSignalUuid();
     mComponentSignalInstance = mSymbol.getComponentInstance().getSignalInstance(cmpSignalUuid);
 
-    mGraphicsItem.reset(new SGI_SymbolPin(*this));
+    if (mSchematic.hasGraphicsItems()) createGraphicsItems();
     updatePosition();
 
     // create ERC messages
@@ -145,6 +145,16 @@ bool SI_SymbolPin::isRequired() const noexcept
  *  General Methods
  ****************************************************************************************/
 
+void SI_SymbolPin::createGraphicsItems() noexcept
+{
+    if (!mGraphicsItem) {
+        mGraphicsItem.reset(new SGI_SymbolPin(*this));
+        mGraphicsItem->setPos(mPosition.toPxQPointF());
+        mGraphicsItem->setRotation(-mRotation.toDeg());
+        SI_Base::graphicsItemCreated(*mGraphicsItem);
+    }
+}
+
 void SI_SymbolPin::addToSchematic(GraphicsScene& scene) throw (Exception)
 {
     if (isAddedToSchematic() || isUsed()) {
@@ -155,9 +165,10 @@ void SI_SymbolPin::addToSchematic(GraphicsScene& scene) throw (Exception)
     }
     if (getCompSigInstNetSignal()) {
         mHighlightChangedConnection = connect(getCompSigInstNetSignal(), &NetSignal::highlightedChanged,
-                                              [this](){mGraphicsItem->update();});
+                                              [this](){if (mGraphicsItem) mGraphicsItem->update();});
     }
-    SI_Base::addToSchematic(scene, *mGraphicsItem);
+    if (mSchematic.hasGraphicsItems()) createGraphicsItems();
+    SI_Base::addToSchematic(scene, mGraphicsItem.data());
     updateErcMessages();
 }
 
@@ -172,7 +183,7 @@ void SI_SymbolPin::removeFromSchematic(GraphicsScene& scene) throw (Exception)
     if (getCompSigInstNetSignal()) {
         disconnect(mHighlightChangedConnection);
     }
-    SI_Base::removeFromSchematic(scene, *mGraphicsItem);
+    SI_Base::removeFromSchematic(scene, mGraphicsItem.data());
     updateErcMessages();
 }
 
@@ -204,9 +215,12 @@ void SI_SymbolPin::updatePosition() noexcept
 {
     mPosition = mSymbol.mapToScene(mSymbolPin->getPosition());
     mRotation = mSymbol.getRotation() + mSymbolPin->getRotation();
-    mGraphicsItem->setPos(mPosition.toPxQPointF());
-    mGraphicsItem->setRotation(-mRotation.toDeg());
-    mGraphicsItem->updateCacheAndRepaint();
+    if (mGraphicsItem) {
+        mGraphicsItem->setPos(mPosition.toPxQPointF());
+        mGraphicsItem->setRotation(-mRotation.toDeg());
+        mGraphicsItem->updateCacheAndRepaint();
+    }
+    mSchematic.itemGeometryChanged(*this);
     if (mRegisteredNetPoint) {
         mRegisteredNetPoint->setPosition(mPosition);
     }
@@ -218,13 +232,14 @@ void SI_SymbolPin::updatePosition() noexcept
 
 QPainterPath SI_SymbolPin::getGrabAreaScenePx() const noexcept
 {
+    if (!mGraphicsItem) return QPainterPath();
     return mGraphicsItem->sceneTransform().map(mGraphicsItem->shape());
 }
 
 void SI_SymbolPin::setSelected(bool selected) noexcept
 {
     SI_Base::setSelected(selected);
-    mGraphicsItem->update();
+    if (mGraphicsItem) mGraphicsItem->update();
 }
 
 /*****************************************************************************************
@@ -81,6 +81,7 @@ class SI_SymbolPin final : public SI_Base, public IF_ErcMsgProvider
         bool isUsed() const noexcept {return mRegisteredNetPoint ? true : false;}
 
         // General Methods
+        void createGraphicsItems() noexcept override;
         void addToSchematic(GraphicsScene& scene) throw (Exception) override;
         void removeFromSchematic(GraphicsScene& scene) throw (Exception) override;
         void registerNetPoint(SI_NetPoint& netpoint) throw (Exception);
@@ -44,6 +44,9 @@
 namespace librepcb {
 namespace project {
 
+// cell size of the spatial indexes (100mil, in pixels)
+static const qreal sSpatialIndexCellSize = Length(2540000).toPx();
+
 /*****************************************************************************************
  *  Constructors / Destructor
  ****************************************************************************************/
@@ -51,7 +54,12 @@ namespace project {
 Schematic::Schematic(Project& project, const FilePath& filepath, bool restore,
                      bool readOnly, bool create, const QString& newName) throw (Exception):
     QObject(&project), IF_AttributeProvider(), mProject(project), mFilePath(filepath),
-    mIsAddedToProject(false)
+    mIsAddedToProject(false), mHasGraphicsItems(!project.isModelOnly()),
+    mSymbolsIndex(sSpatialIndexCellSize, &getGrabAreaBoundingRect),
+    mSymbolPinsIndex(sSpatialIndexCellSize, &getGrabAreaBoundingRect),
+    mNetPointsIndex(sSpatialIndexCellSize, &getGrabAreaBoundingRect),
+    mNetLinesIndex(sSpatialIndexCellSize, &getGrabAreaBoundingRect),
+    mNetLabelsIndex(sSpatialIndexCellSize, &getGrabAreaBoundingRect)
 {
     try
     {
@@ -94,6 +102,8 @@ Schematic::Schematic(Project& project, const FilePath& filepath, bool restore,
                         .arg(symbol->getUuid().toStr()));
                 }
                 mSymbols.append(symbol);
+                mSymbolsByUuid.insert(symbol->getUuid(), symbol);
+                addToSpatialIndex(*symbol);
             }
 
             // Load all netpoints
@@ -107,6 +117,8 @@ Schematic::Schematic(Project& project, const FilePath& filepath, bool restore,
                         .arg(netpoint->getUuid().toStr()));
                 }
                 mNetPoints.append(netpoint);
+                mNetPointsByUuid.insert(netpoint->getUuid(), netpoint);
+                mNetPointsIndex.insert(netpoint);
             }
 
             // Load all netlines
@@ -120,6 +132,8 @@ Schematic::Schematic(Project& project, const FilePath& filepath, bool restore,
                         .arg(netline->getUuid().toStr()));
                 }
                 mNetLines.append(netline);
+                mNetLinesByUuid.insert(netline->getUuid(), netline);
+                mNetLinesIndex.insert(netline);
             }
 
             // Load all netlabels
@@ -133,6 +147,8 @@ Schematic::Schematic(Project& project, const FilePath& filepath, bool restore,
                         .arg(netlabel->getUuid().toStr()));
                 }
                 mNetLabels.append(netlabel);
+                mNetLabelsByUuid.insert(netlabel->getUuid(), netlabel);
+                mNetLabelsIndex.insert(netlabel);
             }
         }
 
@@ -285,34 +301,41 @@ QList<SI_Base*> Schematic::getItemsAtScenePos(const Point& pos) const noexcept
     QPointF scenePosPx = pos.toPxQPointF();
     QList<SI_Base*> list;   // Note: The order of adding the items is very important (the
                             // top most item must appear as the first item in the list)!
+    QList<SI_NetPoint*> netpoints = mNetPointsIndex.getItemsAt(scenePosPx);
     // visible netpoints
-    foreach (SI_NetPoint* netpoint, mNetPoints)
+    foreach (SI_NetPoint* netpoint, netpoints)
     {
         if (!netpoint->isVisibleJunction()) continue;
         if (netpoint->getGrabAreaScenePx().contains(scenePosPx))
             list.append(netpoint);
     }
     // hidden netpoints
-    foreach (SI_NetPoint* netpoint, mNetPoints)
+    foreach (SI_NetPoint* netpoint, netpoints)
     {
         if (netpoint->isVisibleJunction()) continue;
         if (netpoint->getGrabAreaScenePx().contains(scenePosPx))
             list.append(netpoint);
     }
     // netlines
-    foreach (SI_NetLine* netline, mNetLines)
+    foreach (SI_NetLine* netline, mNetLinesIndex.getItemsAt(scenePosPx))
     {
         if (netline->getGrabAreaScenePx().contains(scenePosPx))
             list.append(netline);
     }
     // netlabels
-    foreach (SI_NetLabel* netlabel, mNetLabels)
+    foreach (SI_NetLabel* netlabel, mNetLabelsIndex.getItemsAt(scenePosPx))
     {
         if (netlabel->getGrabAreaScenePx().contains(scenePosPx))
             list.append(netlabel);
     }
-    // symbols & pins
-    foreach (SI_Symbol* symbol, mSymbols)
+    // symbols & pins (pins always before their symbol)
+    QList<SI_Symbol*> symbols = mSymbolsIndex.getItemsAt(scenePosPx);
+    foreach (SI_SymbolPin* pin, mSymbolPinsIndex.getItemsAt(scenePosPx)) {
+        if (!symbols.contains(&pin->getSymbol())) {
+            symbols.append(&pin->getSymbol());
+        }
+    }
+    foreach (SI_Symbol* symbol, symbols)
     {
         foreach (SI_SymbolPin* pin, symbol->getPins())
         {
@@ -328,7 +351,7 @@ QList<SI_Base*> Schematic::getItemsAtScenePos(const Point& pos) const noexcept
 QList<SI_NetPoint*> Schematic::getNetPointsAtScenePos(const Point& pos) const noexcept
 {
     QList<SI_NetPoint*> list;
-    foreach (SI_NetPoint* netpoint, mNetPoints)
+    foreach (SI_NetPoint* netpoint, mNetPointsIndex.getItemsAt(pos.toPxQPointF()))
     {
         if (netpoint->getGrabAreaScenePx().contains(pos.toPxQPointF()))
             list.append(netpoint);
@@ -339,7 +362,7 @@ QList<SI_NetPoint*> Schematic::getNetPointsAtScenePos(const Point& pos) const no
 QList<SI_NetLine*> Schematic::getNetLinesAtScenePos(const Point& pos) const noexcept
 {
     QList<SI_NetLine*> list;
-    foreach (SI_NetLine* netline, mNetLines)
+    foreach (SI_NetLine* netline, mNetLinesIndex.getItemsAt(pos.toPxQPointF()))
     {
         if (netline->getGrabAreaScenePx().contains(pos.toPxQPointF()))
             list.append(netline);
@@ -350,13 +373,10 @@ QList<SI_NetLine*> Schematic::getNetLinesAtScenePos(const Point& pos) const noex
 QList<SI_SymbolPin*> Schematic::getPinsAtScenePos(const Point& pos) const noexcept
 {
     QList<SI_SymbolPin*> list;
-    foreach (SI_Symbol* symbol, mSymbols)
+    foreach (SI_SymbolPin* pin, mSymbolPinsIndex.getItemsAt(pos.toPxQPointF()))
     {
-        foreach (SI_SymbolPin* pin, symbol->getPins())
-        {
-            if (pin->getGrabAreaScenePx().contains(pos.toPxQPointF()))
-                list.append(pin);
-        }
+        if (pin->getGrabAreaScenePx().contains(pos.toPxQPointF()))
+            list.append(pin);
     }
     return list;
 }
@@ -382,6 +402,7 @@ QList<SI_Base*> Schematic::getAllItems() const noexcept
 void Schematic::setGridProperties(const GridProperties& grid) noexcept
 {
     *mGridProperties = grid;
+    setModified();
 }
 
 /*****************************************************************************************
@@ -390,16 +411,12 @@ void Schematic::setGridProperties(const GridProperties& grid) noexcept
 
 SI_Symbol* Schematic::getSymbolByUuid(const Uuid& uuid) const noexcept
 {
-    foreach (SI_Symbol* symbol, mSymbols) {
-        if (symbol->getUuid() == uuid)
-            return symbol;
-    }
-    return nullptr;
+    return mSymbolsByUuid.value(uuid, nullptr);
 }
 
 void Schematic::addSymbol(SI_Symbol& symbol) throw (Exception)
 {
-    if ((!mIsAddedToProject) || (mSymbols.contains(&symbol))
+    if ((!mIsAddedToProject) || (getSymbolByUuid(symbol.getUuid()) == &symbol)
         || (&symbol.getSchematic() != this))
     {
         throw LogicError(__FILE__, __LINE__);
@@ -413,16 +430,20 @@ void Schematic::addSymbol(SI_Symbol& symbol) throw (Exception)
     // add to schematic
     symbol.addToSchematic(*mGraphicsScene); // can throw
     mSymbols.append(&symbol);
+    mSymbolsByUuid.insert(symbol.getUuid(), &symbol);
+    addToSpatialIndex(symbol);
 }
 
 void Schematic::removeSymbol(SI_Symbol& symbol) throw (Exception)
 {
-    if ((!mIsAddedToProject) || (!mSymbols.contains(&symbol))) {
+    if ((!mIsAddedToProject) || (getSymbolByUuid(symbol.getUuid()) != &symbol)) {
         throw LogicError(__FILE__, __LINE__);
     }
     // remove from schematic
     symbol.removeFromSchematic(*mGraphicsScene); // can throw
     mSymbols.removeOne(&symbol);
+    mSymbolsByUuid.remove(symbol.getUuid());
+    removeFromSpatialIndex(symbol);
 }
 
 /*****************************************************************************************
@@ -431,16 +452,12 @@ void Schematic::removeSymbol(SI_Symbol& symbol) throw (Exception)
 
 SI_NetPoint* Schematic::getNetPointByUuid(const Uuid& uuid) const noexcept
 {
-    foreach (SI_NetPoint* netpoint, mNetPoints) {
-        if (netpoint->getUuid() == uuid)
-            return netpoint;
-    }
-    return nullptr;
+    return mNetPointsByUuid.value(uuid, nullptr);
 }
 
 void Schematic::addNetPoint(SI_NetPoint& netpoint) throw (Exception)
 {
-    if ((!mIsAddedToProject) || (mNetPoints.contains(&netpoint))
+    if ((!mIsAddedToProject) || (getNetPointByUuid(netpoint.getUuid()) == &netpoint)
         || (&netpoint.getSchematic() != this))
     {
         throw LogicError(__FILE__, __LINE__);
@@ -454,16 +471,20 @@ void Schematic::addNetPoint(SI_NetPoint& netpoint) throw (Exception)
     // add to schematic
     netpoint.addToSchematic(*mGraphicsScene); // can throw
     mNetPoints.append(&netpoint);
+    mNetPointsByUuid.insert(netpoint.getUuid(), &netpoint);
+    mNetPointsIndex.insert(&netpoint);
 }
 
 void Schematic::removeNetPoint(SI_NetPoint& netpoint) throw (Exception)
 {
-    if ((!mIsAddedToProject) || (!mNetPoints.contains(&netpoint))) {
+    if ((!mIsAddedToProject) || (getNetPointByUuid(netpoint.getUuid()) != &netpoint)) {
         throw LogicError(__FILE__, __LINE__);
     }
     // remove from schematic
     netpoint.removeFromSchematic(*mGraphicsScene); // can throw an exception
     mNetPoints.removeOne(&netpoint);
+    mNetPointsByUuid.remove(netpoint.getUuid());
+    mNetPointsIndex.remove(&netpoint);
 }
 
 /*****************************************************************************************
@@ -472,16 +493,12 @@ void Schematic::removeNetPoint(SI_NetPoint& netpoint) throw (Exception)
 
 SI_NetLine* Schematic::getNetLineByUuid(const Uuid& uuid) const noexcept
 {
-    foreach (SI_NetLine* netline, mNetLines) {
-        if (netline->getUuid() == uuid)
-            return netline;
-    }
-    return nullptr;
+    return mNetLinesByUuid.value(uuid, nullptr);
 }
 
 void Schematic::addNetLine(SI_NetLine& netline) throw (Exception)
 {
-    if ((!mIsAddedToProject) || (mNetLines.contains(&netline))
+    if ((!mIsAddedToProject) || (getNetLineByUuid(netline.getUuid()) == &netline)
         || (&netline.getSchematic() != this))
     {
         throw LogicError(__FILE__, __LINE__);
@@ -495,16 +512,20 @@ void Schematic::addNetLine(SI_NetLine& netline) throw (Exception)
     // add to schematic
     netline.addToSchematic(*mGraphicsScene); // can throw
     mNetLines.append(&netline);
+    mNetLinesByUuid.insert(netline.getUuid(), &netline);
+    mNetLinesIndex.insert(&netline);
 }
 
 void Schematic::removeNetLine(SI_NetLine& netline) throw (Exception)
 {
-    if ((!mIsAddedToProject) || (!mNetLines.contains(&netline))) {
+    if ((!mIsAddedToProject) || (getNetLineByUuid(netline.getUuid()) != &netline)) {
         throw LogicError(__FILE__, __LINE__);
     }
     // remove from schematic
     netline.removeFromSchematic(*mGraphicsScene); // can throw
     mNetLines.removeOne(&netline);
+    mNetLinesByUuid.remove(netline.getUuid());
+    mNetLinesIndex.remove(&netline);
 }
 
 /*****************************************************************************************
@@ -513,16 +534,12 @@ void Schematic::removeNetLine(SI_NetLine& netline) throw (Exception)
 
 SI_NetLabel* Schematic::getNetLabelByUuid(const Uuid& uuid) const noexcept
 {
-    foreach (SI_NetLabel* netlabel, mNetLabels) {
-        if (netlabel->getUuid() == uuid)
-            return netlabel;
-    }
-    return nullptr;
+    return mNetLabelsByUuid.value(uuid, nullptr);
 }
 
 void Schematic::addNetLabel(SI_NetLabel& netlabel) throw (Exception)
 {
-    if ((!mIsAddedToProject) || (mNetLabels.contains(&netlabel))
+    if ((!mIsAddedToProject) || (getNetLabelByUuid(netlabel.getUuid()) == &netlabel)
         || (&netlabel.getSchematic() != this))
     {
         throw LogicError(__FILE__, __LINE__);
@@ -536,22 +553,59 @@ void Schematic::addNetLabel(SI_NetLabel& netlabel) throw (Exception)
     // add to schematic
     netlabel.addToSchematic(*mGraphicsScene); // can throw
     mNetLabels.append(&netlabel);
+    mNetLabelsByUuid.insert(netlabel.getUuid(), &netlabel);
+    mNetLabelsIndex.insert(&netlabel);
 }
 
 void Schematic::removeNetLabel(SI_NetLabel& netlabel) throw (Exception)
 {
-    if ((!mIsAddedToProject) || (!mNetLabels.contains(&netlabel))) {
+    if ((!mIsAddedToProject) || (getNetLabelByUuid(netlabel.getUuid()) != &netlabel)) {
         throw LogicError(__FILE__, __LINE__);
     }
     // remove from schematic
     netlabel.removeFromSchematic(*mGraphicsScene); // can throw
     mNetLabels.removeOne(&netlabel);
+    mNetLabelsByUuid.remove(netlabel.getUuid());
+    mNetLabelsIndex.remove(&netlabel);
 }
 
 /*****************************************************************************************
  *  General Methods
  ****************************************************************************************/
 
+void Schematic::itemGeometryChanged(SI_Base& item) noexcept
+{
+    switch (item.getType()) {
+        case SI_Base::Type_t::Symbol:
+            mSymbolsIndex.invalidate(static_cast<SI_Symbol*>(&item));
+            break;
+        case SI_Base::Type_t::SymbolPin:
+            mSymbolPinsIndex.invalidate(static_cast<SI_SymbolPin*>(&item));
+            break;
+        case SI_Base::Type_t::NetPoint:
+            mNetPointsIndex.invalidate(static_cast<SI_NetPoint*>(&item));
+            break;
+        case SI_Base::Type_t::NetLine:
+            mNetLinesIndex.invalidate(static_cast<SI_NetLine*>(&item));
+            break;
+        case SI_Base::Type_t::NetLabel:
+            mNetLabelsIndex.invalidate(static_cast<SI_NetLabel*>(&item));
+            break;
+        default:
+            break;
+    }
+}
+
+void Schematic::createGraphicsItems() noexcept
+{
+    if (!mHasGraphicsItems) {
+        mHasGraphicsItems = true;
+        foreach (SI_Base* item, getAllItems()) {
+            item->createGraphicsItems();
+        }
+    }
+}
+
 void Schematic::addToProject() throw (Exception)
 {
     if (mIsAddedToProject) {
@@ -585,11 +639,17 @@ void Schematic::removeFromProject() throw (Exception)
     sgl.dismiss();
 }
 
+void Schematic::setModified() noexcept
+{
+    mXmlFile->setModified();
+}
+
 bool Schematic::save(bool toOriginal, QStringList& errors) noexcept
 {
     bool success = true;
 
-    // save schematic XML file
+    // save schematic XML file (only if modified since the last save)
+    if (!mXmlFile->isModified(toOriginal)) return true;
     try
     {
         if (mIsAddedToProject)
@@ -611,8 +671,38 @@ bool Schematic::save(bool toOriginal, QStringList& errors) noexcept
     return success;
 }
 
+bool Schematic::createBackupSnapshots(QList<SmartFileSnapshot>& snapshots,
+                                      QStringList& errors) noexcept
+{
+    bool success = true;
+
+    // Snapshot schematic XML file (only if modified since the last backup)
+    if (!mXmlFile->isModified(false)) return true;
+    try
+    {
+        if (mIsAddedToProject)
+        {
+            QSharedPointer<const XmlDomDocument> doc(
+                new XmlDomDocument(*serializeToXmlDomElement()));
+            snapshots.append(mXmlFile->createBackupSnapshot(doc));
+        }
+        else
+        {
+            mXmlFile->removeFile(false); // cheap, no need to defer it
+        }
+    }
+    catch (Exception& e)
+    {
+        success = false;
+        errors.append(e.getUserMsg());
+    }
+
+    return success;
+}
+
 void Schematic::showInView(GraphicsView& view) noexcept
 {
+    createGraphicsItems();
     view.setScene(mGraphicsScene.data());
 }
 
@@ -653,8 +743,9 @@ void Schematic::clearSelection() const noexcept
         netlabel->setSelected(false);
 }
 
-void Schematic::renderToQPainter(QPainter& painter) const noexcept
+void Schematic::renderToQPainter(QPainter& painter) noexcept
 {
+    createGraphicsItems();
     mGraphicsScene->render(&painter, QRectF(), mGraphicsScene->itemsBoundingRect(), Qt::KeepAspectRatio);
 }
 
@@ -703,6 +794,27 @@ void Schematic::updateIcon() noexcept
     mIcon = QIcon(pixmap);
 }
 
+void Schematic::addToSpatialIndex(SI_Symbol& symbol) noexcept
+{
+    mSymbolsIndex.insert(&symbol);
+    foreach (SI_SymbolPin* pin, symbol.getPins()) {
+        mSymbolPinsIndex.insert(pin);
+    }
+}
+
+void Schematic::removeFromSpatialIndex(SI_Symbol& symbol) noexcept
+{
+    mSymbolsIndex.remove(&symbol);
+    foreach (SI_SymbolPin* pin, symbol.getPins()) {
+        mSymbolPinsIndex.remove(pin);
+    }
+}
+
+QRectF Schematic::getGrabAreaBoundingRect(const SI_Base& item) noexcept
+{
+    return item.getGrabAreaScenePx().boundingRect();
+}
+
 bool Schematic::checkAttributesValidity() const noexcept
 {
     if (mUuid.isNull())     return false;
@@ -31,6 +31,7 @@
 #include <librepcb/common/units/all_length_units.h>
 #include <librepcb/common/fileio/filepath.h>
 #include <librepcb/common/exceptions.h>
+#include <librepcb/common/spatialindex.h>
 
 /*****************************************************************************************
  *  Namespace / Forward Declarations
@@ -41,6 +42,7 @@ class GridProperties;
 class GraphicsView;
 class GraphicsScene;
 class SmartXmlFile;
+class SmartFileSnapshot;
 
 namespace project {
 
@@ -112,6 +114,8 @@ class Schematic final : public QObject, public IF_AttributeProvider,
         const FilePath& getFilePath() const noexcept {return mFilePath;}
         const GridProperties& getGridProperties() const noexcept {return *mGridProperties;}
         bool isEmpty() const noexcept;
+        bool hasGraphicsItems() const noexcept {return mHasGraphicsItems;}
+        GraphicsScene& getGraphicsScene() const noexcept {return *mGraphicsScene;}
         QList<SI_Base*> getSelectedItems(bool symbolPins,
                                          bool floatingPoints,
                                          bool attachedPoints,
@@ -158,15 +162,34 @@ class Schematic final : public QObject, public IF_AttributeProvider,
         void removeNetLabel(SI_NetLabel& netlabel) throw (Exception);
 
         // General Methods
+
+        /**
+         * @brief Notify the schematic that the grab area of an item has changed
+         *
+         * Must be called by the schematic items whenever their position or shape changes
+         * to keep the spatial index used by #getItemsAtScenePos() and friends up to date.
+         */
+        void itemGeometryChanged(SI_Base& item) noexcept;
+
+        /**
+         * @brief Create the graphics items of all items of this schematic if not done yet
+         *
+         * Only needed if the project was opened in model-only mode (see
+         * Project#isModelOnly()), otherwise all graphics items already exist. Called
+         * automatically by #showInView().
+         */
+        void createGraphicsItems() noexcept;
         void addToProject() throw (Exception);
         void removeFromProject() throw (Exception);
+        void setModified() noexcept;
         bool save(bool toOriginal, QStringList& errors) noexcept;
+        bool createBackupSnapshots(QList<SmartFileSnapshot>& snapshots, QStringList& errors) noexcept;
         void showInView(GraphicsView& view) noexcept;
         void saveViewSceneRect(const QRectF& rect) noexcept {mViewRect = rect;}
         const QRectF& restoreViewSceneRect() const noexcept {return mViewRect;}
         void setSelectionRect(const Point& p1, const Point& p2, bool updateItems) noexcept;
         void clearSelection() const noexcept;
-        void renderToQPainter(QPainter& painter) const noexcept;
+        void renderToQPainter(QPainter& painter) noexcept;
 
         // Helper Methods
         bool getAttributeValue(const QString& attrNS, const QString& attrKey,
@@ -193,6 +216,9 @@ class Schematic final : public QObject, public IF_AttributeProvider,
         Schematic(Project& project, const FilePath& filepath, bool restore,
                   bool readOnly, bool create, const QString& newName) throw (Exception);
         void updateIcon() noexcept;
+        void addToSpatialIndex(SI_Symbol& symbol) noexcept;
+        void removeFromSpatialIndex(SI_Symbol& symbol) noexcept;
+        static QRectF getGrabAreaBoundingRect(const SI_Base& item) noexcept;
 
         /// @copydoc IF_XmlSerializableObject#checkAttributesValidity()
         bool checkAttributesValidity() const noexcept override;
@@ -206,6 +232,7 @@ class Schematic final : public QObject, public IF_AttributeProvider,
         FilePath mFilePath; ///< the filepath of the schematic *.xml file (from the ctor)
         QScopedPointer<SmartXmlFile> mXmlFile;
         bool mIsAddedToProject;
+        bool mHasGraphicsItems; ///< false until the graphics items are created
 
         QScopedPointer<GraphicsScene> mGraphicsScene;
         QScopedPointer<GridProperties> mGridProperties;
@@ -220,6 +247,19 @@ class Schematic final : public QObject, public IF_AttributeProvider,
         QList<SI_NetPoint*> mNetPoints;
         QList<SI_NetLine*> mNetLines;
         QList<SI_NetLabel*> mNetLabels;
+
+        // UUID lookup tables of the items above (same content as the lists)
+        QHash<Uuid, SI_Symbol*> mSymbolsByUuid;
+        QHash<Uuid, SI_NetPoint*> mNetPointsByUuid;
+        QHash<Uuid, SI_NetLine*> mNetLinesByUuid;
+        QHash<Uuid, SI_NetLabel*> mNetLabelsByUuid;
+
+        // spatial indexes of the items above (see #getItemsAtScenePos())
+        SpatialIndex<SI_Symbol> mSymbolsIndex;
+        SpatialIndex<SI_SymbolPin> mSymbolPinsIndex;
+        SpatialIndex<SI_NetPoint> mNetPointsIndex;
+        SpatialIndex<SI_NetLine> mNetLinesIndex;
+        SpatialIndex<SI_NetLabel> mNetLabelsIndex;
 };
 
 /*****************************************************************************************
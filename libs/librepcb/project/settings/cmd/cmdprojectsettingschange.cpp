@@ -72,6 +72,18 @@ void CmdProjectSettingsChange::setNormOrder(const QStringList& norms) noexcept
  *  Inherited from UndoCommand
  ****************************************************************************************/
 
+qint64 CmdProjectSettingsChange::getApproxMemoryUsage() const noexcept
+{
+    qint64 usage = UndoCommand::getApproxMemoryUsage();
+    for (const QStringList* list : {&mLocaleOrderOld, &mLocaleOrderNew,
+                                    &mNormOrderOld, &mNormOrderNew}) {
+        foreach (const QString& str, *list) {
+            usage += sizeof(QString) + str.capacity() * sizeof(QChar);
+        }
+    }
+    return usage;
+}
+
 bool CmdProjectSettingsChange::performExecute() throw (Exception)
 {
     performRedo(); // can throw
@@ -81,12 +93,14 @@ bool CmdProjectSettingsChange::performExecute() throw (Exception)
 
 void CmdProjectSettingsChange::performUndo() throw (Exception)
 {
+    mSettings.setModified();
     applyOldSettings(); // can throw
     mSettings.triggerSettingsChanged();
 }
 
 void CmdProjectSettingsChange::performRedo() throw (Exception)
 {
+    mSettings.setModified();
     applyNewSettings(); // can throw
     mSettings.triggerSettingsChanged();
 }
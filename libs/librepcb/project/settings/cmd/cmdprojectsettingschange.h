@@ -54,6 +54,11 @@ class CmdProjectSettingsChange final : public UndoCommand
         void setLocaleOrder(const QStringList& locales) noexcept;
         void setNormOrder(const QStringList& norms) noexcept;
 
+        // Inherited from UndoCommand
+
+        /// @copydoc UndoCommand::getApproxMemoryUsage()
+        qint64 getApproxMemoryUsage() const noexcept override;
+
 
     private:
 
@@ -111,11 +111,17 @@ void ProjectSettings::triggerSettingsChanged() noexcept
     emit settingsChanged();
 }
 
+void ProjectSettings::setModified() noexcept
+{
+    mXmlFile->setModified();
+}
+
 bool ProjectSettings::save(bool toOriginal, QStringList& errors) noexcept
 {
     bool success = true;
 
-    // Save "core/settings.xml"
+    // Save "core/settings.xml" (only if modified since the last save)
+    if (!mXmlFile->isModified(toOriginal)) return true;
     try
     {
         XmlDomDocument doc(*serializeToXmlDomElement());
@@ -130,6 +136,28 @@ bool ProjectSettings::save(bool toOriginal, QStringList& errors) noexcept
     return success;
 }
 
+bool ProjectSettings::createBackupSnapshots(QList<SmartFileSnapshot>& snapshots,
+                                            QStringList& errors) noexcept
+{
+    bool success = true;
+
+    // Snapshot "core/settings.xml" (only if modified since the last backup)
+    if (!mXmlFile->isModified(false)) return true;
+    try
+    {
+        QSharedPointer<const XmlDomDocument> doc(
+            new XmlDomDocument(*serializeToXmlDomElement()));
+        snapshots.append(mXmlFile->createBackupSnapshot(doc));
+    }
+    catch (Exception& e)
+    {
+        success = false;
+        errors.append(e.getUserMsg());
+    }
+
+    return success;
+}
+
 /*****************************************************************************************
  *  Private Methods
  ****************************************************************************************/
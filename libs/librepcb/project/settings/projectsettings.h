@@ -33,6 +33,7 @@
 namespace librepcb {
 
 class SmartXmlFile;
+class SmartFileSnapshot;
 
 namespace project {
 
@@ -72,7 +73,9 @@ class ProjectSettings final : public QObject, public IF_XmlSerializableObject
         // General Methods
         void restoreDefaults() noexcept;
         void triggerSettingsChanged() noexcept;
+        void setModified() noexcept;
         bool save(bool toOriginal, QStringList& errors) noexcept;
+        bool createBackupSnapshots(QList<SmartFileSnapshot>& snapshots, QStringList& errors) noexcept;
 
 
     signals:
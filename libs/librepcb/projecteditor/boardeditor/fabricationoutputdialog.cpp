@@ -75,6 +75,7 @@ void FabricationOutputDialog::on_btnGenerate_clicked()
     {
         FilePath filepath(mUi->edtOutputDirPath->text());
         BoardGerberExport grbExport(mBoard, filepath);
+        grbExport.setDrillPathOptimizationEnabled(mUi->cbxOptimizeDrillPath->isChecked());
         grbExport.exportAllLayers();
     }
     catch (Exception& e)
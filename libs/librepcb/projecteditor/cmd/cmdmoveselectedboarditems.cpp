@@ -44,9 +44,11 @@ namespace editor {
  *  Constructors / Destructor
  ****************************************************************************************/
 
-CmdMoveSelectedBoardItems::CmdMoveSelectedBoardItems(Board& board, const Point& startPos) noexcept :
+CmdMoveSelectedBoardItems::CmdMoveSelectedBoardItems(Board& board, const Point& startPos,
+                                                     bool mergeable) noexcept :
     UndoCommandGroup(tr("Move Board Elements")),
-    mBoard(board), mStartPos(startPos), mDeltaPos(0, 0)
+    mBoard(board), mStartPos(startPos), mDeltaPos(0, 0), mInteractiveMoveActive(false),
+    mMergeable(mergeable)
 {
     // get all selected items
     QList<BI_Base*> items = mBoard.getSelectedItems(true, false, true, false, true, false,
@@ -80,10 +82,15 @@ CmdMoveSelectedBoardItems::CmdMoveSelectedBoardItems(Board& board, const Point&
             }
         }
     }
+
+    // defer expensive graphics updates until the items are dropped
+    mBoard.beginInteractiveMove();
+    mInteractiveMoveActive = true;
 }
 
 CmdMoveSelectedBoardItems::~CmdMoveSelectedBoardItems() noexcept
 {
+    endInteractiveMove(); // if the command was never executed
 }
 
 /*****************************************************************************************
@@ -114,8 +121,32 @@ void CmdMoveSelectedBoardItems::setCurrentPosition(const Point& pos) noexcept
  *  Inherited from UndoCommand
  ****************************************************************************************/
 
+bool CmdMoveSelectedBoardItems::mergeWith(const UndoCommand& other) noexcept
+{
+    const CmdMoveSelectedBoardItems* cmd = dynamic_cast<const CmdMoveSelectedBoardItems*>(&other);
+    if ((!cmd) || (!mMergeable) || (!cmd->mMergeable) || (!hasSameItems(*cmd))) return false;
+
+    // the child commands edit the same items in the same order, so they can be merged
+    for (int i = 0; i < mDeviceEditCmds.count(); ++i) {
+        bool merged = mDeviceEditCmds.at(i)->mergeWith(*cmd->mDeviceEditCmds.at(i));
+        Q_ASSERT(merged); Q_UNUSED(merged);
+    }
+    for (int i = 0; i < mViaEditCmds.count(); ++i) {
+        bool merged = mViaEditCmds.at(i)->mergeWith(*cmd->mViaEditCmds.at(i));
+        Q_ASSERT(merged); Q_UNUSED(merged);
+    }
+    for (int i = 0; i < mNetPointEditCmds.count(); ++i) {
+        bool merged = mNetPointEditCmds.at(i)->mergeWith(*cmd->mNetPointEditCmds.at(i));
+        Q_ASSERT(merged); Q_UNUSED(merged);
+    }
+    mDeltaPos += cmd->mDeltaPos;
+    return true;
+}
+
 bool CmdMoveSelectedBoardItems::performExecute() throw (Exception)
 {
+    endInteractiveMove(); // apply all deferred graphics updates
+
     if (mDeltaPos.isOrigin()) {
         // no movement required --> discard all move commands
         qDeleteAll(mDeviceEditCmds);    mDeviceEditCmds.clear();
@@ -138,6 +169,42 @@ bool CmdMoveSelectedBoardItems::performExecute() throw (Exception)
     return UndoCommandGroup::performExecute(); // can throw
 }
 
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+void CmdMoveSelectedBoardItems::endInteractiveMove() noexcept
+{
+    if (mInteractiveMoveActive) {
+        mBoard.endInteractiveMove();
+        mInteractiveMoveActive = false;
+    }
+}
+
+bool CmdMoveSelectedBoardItems::hasSameItems(const CmdMoveSelectedBoardItems& other) const noexcept
+{
+    if ((&other.mBoard != &mBoard) ||
+        (other.mDeviceEditCmds.count() != mDeviceEditCmds.count()) ||
+        (other.mViaEditCmds.count() != mViaEditCmds.count()) ||
+        (other.mNetPointEditCmds.count() != mNetPointEditCmds.count()))
+    {
+        return false;
+    }
+    for (int i = 0; i < mDeviceEditCmds.count(); ++i) {
+        if (&other.mDeviceEditCmds.at(i)->getDevice() != &mDeviceEditCmds.at(i)->getDevice())
+            return false;
+    }
+    for (int i = 0; i < mViaEditCmds.count(); ++i) {
+        if (&other.mViaEditCmds.at(i)->getVia() != &mViaEditCmds.at(i)->getVia())
+            return false;
+    }
+    for (int i = 0; i < mNetPointEditCmds.count(); ++i) {
+        if (&other.mNetPointEditCmds.at(i)->getNetPoint() != &mNetPointEditCmds.at(i)->getNetPoint())
+            return false;
+    }
+    return true;
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
@@ -52,16 +52,42 @@ class CmdMoveSelectedBoardItems final : public UndoCommandGroup
     public:
 
         // Constructors / Destructor
-        CmdMoveSelectedBoardItems(Board& board, const Point& startPos) noexcept;
+
+        /**
+         * @brief Constructor
+         *
+         * @param board         The board whose selected items are moved
+         * @param startPos      The position where the move starts
+         * @param mergeable     Whether consecutive moves of the same items may be merged
+         *                      into a single undo step (e.g. for repeated nudges with the
+         *                      keyboard). Mouse drags must not be mergeable, so every drag
+         *                      can be undone separately.
+         */
+        CmdMoveSelectedBoardItems(Board& board, const Point& startPos,
+                                  bool mergeable = false) noexcept;
         ~CmdMoveSelectedBoardItems() noexcept;
 
         // General Methods
         void setCurrentPosition(const Point& pos) noexcept;
 
 
+        // Inherited from UndoCommand
+
+        /**
+         * @brief Merge repeated moves of exactly the same items into a single command
+         *
+         * Only commands which were created as mergeable are merged.
+         *
+         * @copydetails UndoCommand::mergeWith()
+         */
+        bool mergeWith(const UndoCommand& other) noexcept override;
+
+
     private:
 
         // Private Methods
+        void endInteractiveMove() noexcept;
+        bool hasSameItems(const CmdMoveSelectedBoardItems& other) const noexcept;
 
         /// @copydoc UndoCommand::performExecute()
         bool performExecute() throw (Exception) override;
@@ -71,6 +97,8 @@ class CmdMoveSelectedBoardItems final : public UndoCommandGroup
         Board& mBoard;
         Point mStartPos;
         Point mDeltaPos;
+        bool mInteractiveMoveActive; ///< see Board#beginInteractiveMove()
+        bool mMergeable;
 
         // Move commands
         QList<CmdDeviceInstanceEdit*> mDeviceEditCmds;
@@ -106,6 +106,25 @@ Uuid AddComponentDialog::getSelectedSymbVarUuid() const noexcept
  *  Private Slots
  ****************************************************************************************/
 
+void AddComponentDialog::on_edtSearch_textChanged(const QString& text)
+{
+    try
+    {
+        if (text.trimmed().isEmpty()) {
+            // show the components of the selected category again
+            Uuid categoryUuid = mSelectedCategoryUuid;
+            mSelectedCategoryUuid = Uuid();
+            setSelectedCategory(categoryUuid);
+        } else {
+            searchComponents(text.trimmed());
+        }
+    }
+    catch (Exception& e)
+    {
+        QMessageBox::critical(this, tr("Error"), e.getUserMsg());
+    }
+}
+
 void AddComponentDialog::treeCategories_currentItemChanged(const QModelIndex& current, const QModelIndex& previous)
 {
     Q_UNUSED(previous);
@@ -113,6 +132,9 @@ void AddComponentDialog::treeCategories_currentItemChanged(const QModelIndex& cu
     try
     {
         Uuid categoryUuid = Uuid(current.data(Qt::UserRole).toString());
+        mUi->edtSearch->blockSignals(true);
+        mUi->edtSearch->clear(); // leave the search mode
+        mUi->edtSearch->blockSignals(false);
         setSelectedCategory(categoryUuid);
     }
     catch (Exception& e)
@@ -156,12 +178,35 @@ void AddComponentDialog::on_cbxSymbVar_currentIndexChanged(int index)
  *  Private Methods
  ****************************************************************************************/
 
+void AddComponentDialog::searchComponents(const QString& input)
+{
+    setSelectedComponent(nullptr);
+    mUi->listComponents->clear();
+    mUi->listComponents->setSortingEnabled(false); // keep the order of relevance
+
+    const QStringList& localeOrder = mProject.getSettings().getLocaleOrder();
+    QString locale = localeOrder.isEmpty() ? QString("en_US") : localeOrder.first();
+
+    QList<workspace::WorkspaceLibraryDb::SearchResult> results =
+        mWorkspace.getLibraryDb().search(input, locale, workspace::WorkspaceLibraryDb::Components);
+    foreach (const workspace::WorkspaceLibraryDb::SearchResult& result, results)
+    {
+        FilePath cmpFp = mWorkspace.getLibraryDb().getLatestComponent(result.uuid);
+        if (!cmpFp.isValid()) continue;
+
+        QListWidgetItem* item = new QListWidgetItem(result.name);
+        item->setData(Qt::UserRole, cmpFp.toStr());
+        mUi->listComponents->addItem(item);
+    }
+}
+
 void AddComponentDialog::setSelectedCategory(const Uuid& categoryUuid)
 {
     if ((categoryUuid == mSelectedCategoryUuid) && (!categoryUuid.isNull())) return;
 
     setSelectedComponent(nullptr);
     mUi->listComponents->clear();
+    mUi->listComponents->setSortingEnabled(true);
     //mUi->listComponents->setEnabled(false);
 
     const QStringList& localeOrder = mProject.getSettings().getLocaleOrder();
@@ -23,6 +23,7 @@
 #include <QtCore>
 #include "projecteditor.h"
 #include <librepcb/common/undostack.h>
+#include <librepcb/common/fileio/smartfile.h>
 #include <librepcb/workspace/workspace.h>
 #include <librepcb/workspace/settings/workspacesettings.h>
 #include <librepcb/project/project.h>
@@ -38,6 +39,49 @@ namespace librepcb {
 namespace project {
 namespace editor {
 
+/*****************************************************************************************
+ *  Class AutosaveTask
+ ****************************************************************************************/
+
+/**
+ * @brief Writes the snapshots of an autosave in the worker thread
+ */
+class ProjectEditor::AutosaveTask final : public QRunnable
+{
+    public:
+        AutosaveTask(ProjectEditor& editor, const QList<SmartFileSnapshot>& snapshots) noexcept :
+            QRunnable(), mEditor(editor), mSnapshots(snapshots), mWrittenSnapshots(),
+            mErrors(), mFinished(0)
+        {
+            setAutoDelete(false); // owned by the editor
+        }
+
+        const QList<SmartFileSnapshot>& getWrittenSnapshots() const noexcept {return mWrittenSnapshots;}
+        const QStringList& getErrors() const noexcept {return mErrors;}
+        bool isFinished() const noexcept {return mFinished.loadAcquire() != 0;}
+
+        void run() noexcept override
+        {
+            foreach (const SmartFileSnapshot& snapshot, mSnapshots) {
+                try {
+                    snapshot.write(); // can throw
+                    mWrittenSnapshots.append(snapshot);
+                } catch (const Exception& e) {
+                    mErrors.append(e.getUserMsg());
+                }
+            }
+            mFinished.storeRelease(1);
+            QMetaObject::invokeMethod(&mEditor, "autosaveFinished", Qt::QueuedConnection);
+        }
+
+    private:
+        ProjectEditor& mEditor;
+        QList<SmartFileSnapshot> mSnapshots;
+        QList<SmartFileSnapshot> mWrittenSnapshots;
+        QStringList mErrors;
+        QAtomicInt mFinished;
+};
+
 /*****************************************************************************************
  *  Constructors / Destructor
  ****************************************************************************************/
@@ -46,9 +90,12 @@ ProjectEditor::ProjectEditor(workspace::Workspace& workspace, Project& project)
     QObject(nullptr), mWorkspace(workspace), mProject(project), mUndoStack(nullptr),
     mSchematicEditor(nullptr), mBoardEditor(nullptr)
 {
+    mAutosaveThreadPool.setMaxThreadCount(1);
+
     try
     {
         mUndoStack = new UndoStack();
+        mUndoStack->setMemoryLimit(64 * 1024 * 1024); // limit memory of long sessions
 
         // create the whole schematic/board editor GUI inclusive FSM and so on
         mSchematicEditor = new SchematicEditor(*this, mProject);
@@ -75,8 +122,9 @@ ProjectEditor::ProjectEditor(workspace::Workspace& workspace, Project& project)
 
 ProjectEditor::~ProjectEditor() noexcept
 {
-    // stop the autosave timer
+    // stop the autosave timer and wait until the last backup is written
     mAutoSaveTimer.stop();
+    waitForAutosave();
 
     // abort all active commands!
     mSchematicEditor->abortAllCommands();
@@ -157,6 +205,9 @@ void ProjectEditor::execNetClassesEditorDialog(QWidget* parent) noexcept
 
 bool ProjectEditor::saveProject() noexcept
 {
+    // temporary files must not be written concurrently
+    waitForAutosave();
+
     try
     {
         // step 1: save whole project to temporary files
@@ -196,11 +247,18 @@ bool ProjectEditor::autosaveProject() noexcept
         return false;
     }
 
+    if (mAutosaveTask)
+        return false; // the last backup is still being written, try it next time
+
     try
     {
-        qDebug() << "Begin autosaving the project to temporary files...";
-        mProject.save(false);
-        qDebug() << "Project successfully autosaved";
+        // serialize the modified files now, but write them in the worker thread
+        QList<SmartFileSnapshot> snapshots = mProject.createBackupSnapshots();
+        if (snapshots.isEmpty())
+            return false;
+        qDebug() << "Begin autosaving" << snapshots.count() << "files to temporary files...";
+        mAutosaveTask.reset(new AutosaveTask(*this, snapshots));
+        mAutosaveThreadPool.start(mAutosaveTask.data());
         return true;
     }
     catch (Exception& exc)
@@ -248,6 +306,29 @@ bool ProjectEditor::closeAndDestroy(bool askForSave, QWidget* msgBoxParent) noex
     }
 }
 
+/*****************************************************************************************
+ *  Private Slots
+ ****************************************************************************************/
+
+void ProjectEditor::autosaveFinished() noexcept
+{
+    // ignore notifications of tasks which were already handled by waitForAutosave()
+    if ((!mAutosaveTask) || (!mAutosaveTask->isFinished()))
+        return;
+
+    mAutosaveThreadPool.waitForDone(); // returns immediately, the task is finished
+    foreach (const SmartFileSnapshot& snapshot, mAutosaveTask->getWrittenSnapshots()) {
+        // files modified in the meantime are still considered as modified
+        snapshot.getFile().backupSnapshotWritten(snapshot);
+    }
+    if (mAutosaveTask->getErrors().isEmpty()) {
+        qDebug() << "Project successfully autosaved";
+    } else {
+        qWarning() << "Autosave failed:" << mAutosaveTask->getErrors();
+    }
+    mAutosaveTask.reset();
+}
+
 /*****************************************************************************************
  *  Private Methods
  ****************************************************************************************/
@@ -260,6 +341,14 @@ int ProjectEditor::getCountOfVisibleEditorWindows() const noexcept
     return count;
 }
 
+void ProjectEditor::waitForAutosave() noexcept
+{
+    if (mAutosaveTask) {
+        mAutosaveThreadPool.waitForDone();
+        autosaveFinished();
+    }
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
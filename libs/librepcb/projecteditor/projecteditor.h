@@ -169,9 +169,13 @@ class ProjectEditor final : public QObject
         /**
          * @brief Make a automatic backup of the project (save to temporary files)
          *
+         * Only the snapshots of the modified files are taken immediately (see
+         * Project#createBackupSnapshots()). Writing them to the temporary files is done
+         * in a worker thread, so the user can continue working in the meantime.
+         *
          * @note The whole save procedere is described in @ref doc_project_save.
          *
-         * @return true on success, false on failure
+         * @return true if the backup was started, false if not needed or on failure
          */
         bool autosaveProject() noexcept;
 
@@ -206,16 +210,39 @@ class ProjectEditor final : public QObject
         void projectEditorClosed();
 
 
+    private slots:
+
+        /**
+         * @brief Update the state of all files written by the autosave worker thread
+         */
+        void autosaveFinished() noexcept;
+
+
     private: // Methods
 
         int getCountOfVisibleEditorWindows() const noexcept;
 
+        /**
+         * @brief Block until a running autosave is finished (if any)
+         *
+         * Must be called before saving the project synchronously and before destroying
+         * the project, as the worker thread accesses the temporary files.
+         */
+        void waitForAutosave() noexcept;
+
+
+    private: // Types
+
+        class AutosaveTask;
+
 
     private: // Data
 
         workspace::Workspace& mWorkspace;
         Project& mProject;
         QTimer mAutoSaveTimer; ///< the timer for the periodically automatic saving functionality (see also @ref doc_project_save)
+        QThreadPool mAutosaveThreadPool; ///< a single worker thread to write the backups
+        QScopedPointer<AutosaveTask> mAutosaveTask; ///< the running autosave (if any)
         UndoStack* mUndoStack; ///< See @ref doc_project_undostack
         SchematicEditor* mSchematicEditor; ///< The schematic editor (GUI)
         BoardEditor* mBoardEditor; ///< The board editor (GUI)
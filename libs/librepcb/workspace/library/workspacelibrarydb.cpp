@@ -23,11 +23,13 @@
 #include <QtCore>
 #include <QtSql>
 #include <librepcb/common/sqlitedatabase.h>
+#include <librepcb/common/scopeguard.h>
 #include <librepcb/common/fileio/filepath.h>
 #include <librepcb/common/fileio/smartxmlfile.h>
 #include <librepcb/common/fileio/xmldomdocument.h>
 #include <librepcb/common/fileio/xmldomelement.h>
 #include <librepcb/library/library.h>
+#include <librepcb/library/libraryelementmetadata.h>
 #include <librepcb/library/cat/componentcategory.h>
 #include <librepcb/library/cat/packagecategory.h>
 #include <librepcb/library/sym/symbol.h>
@@ -51,7 +53,7 @@ using namespace library;
  ****************************************************************************************/
 
 WorkspaceLibraryDb::WorkspaceLibraryDb(Workspace& ws) throw (Exception):
-    QObject(nullptr), mWorkspace(ws)
+    QObject(nullptr), mWorkspace(ws), mFullTextSearchAvailable(false)
 {
     qDebug("Load workspace library database...");
 
@@ -62,6 +64,9 @@ WorkspaceLibraryDb::WorkspaceLibraryDb(Workspace& ws) throw (Exception):
     // create all tables which do not already exist
     createAllTables(); // can throw
 
+    // update the database schema (e.g. indexes) if it was created by an older version
+    migrateDatabase(); // can throw
+
     // create library scanner object
     mLibraryScanner.reset(new WorkspaceLibraryScanner(mWorkspace));
     connect(mLibraryScanner.data(), &WorkspaceLibraryScanner::started,
@@ -72,6 +77,8 @@ WorkspaceLibraryDb::WorkspaceLibraryDb(Workspace& ws) throw (Exception):
             this, &WorkspaceLibraryDb::scanSucceeded, Qt::QueuedConnection);
     connect(mLibraryScanner.data(), &WorkspaceLibraryScanner::failed,
             this, &WorkspaceLibraryDb::scanFailed, Qt::QueuedConnection);
+    connect(mLibraryScanner.data(), &WorkspaceLibraryScanner::statistics,
+            this, &WorkspaceLibraryDb::scanStatistics, Qt::QueuedConnection);
 
     qDebug("Workspace library database successfully loaded!");
 }
@@ -156,42 +163,48 @@ template <>
 void WorkspaceLibraryDb::getElementTranslations<ComponentCategory>(const FilePath& elemDir,
     const QStringList& localeOrder, QString* name, QString* desc, QString* keywords) const throw (Exception)
 {
-    getElementTranslations("component_categories", "cat_id", elemDir, localeOrder, name, desc, keywords);
+    getElementTranslations("component_categories", "cat_id", ComponentCategory::getShortElementName(),
+        ComponentCategory::getLongElementName(), elemDir, localeOrder, name, desc, keywords);
 }
 
 template <>
 void WorkspaceLibraryDb::getElementTranslations<PackageCategory>(const FilePath& elemDir,
     const QStringList& localeOrder, QString* name, QString* desc, QString* keywords) const throw (Exception)
 {
-    getElementTranslations("package_categories", "cat_id", elemDir, localeOrder, name, desc, keywords);
+    getElementTranslations("package_categories", "cat_id", PackageCategory::getShortElementName(),
+        PackageCategory::getLongElementName(), elemDir, localeOrder, name, desc, keywords);
 }
 
 template <>
 void WorkspaceLibraryDb::getElementTranslations<Symbol>(const FilePath& elemDir,
     const QStringList& localeOrder, QString* name, QString* desc, QString* keywords) const throw (Exception)
 {
-    getElementTranslations("symbols", "symbol_id", elemDir, localeOrder, name, desc, keywords);
+    getElementTranslations("symbols", "symbol_id", Symbol::getShortElementName(),
+        Symbol::getLongElementName(), elemDir, localeOrder, name, desc, keywords);
 }
 
 template <>
 void WorkspaceLibraryDb::getElementTranslations<Package>(const FilePath& elemDir,
     const QStringList& localeOrder, QString* name, QString* desc, QString* keywords) const throw (Exception)
 {
-    getElementTranslations("packages", "package_id", elemDir, localeOrder, name, desc, keywords);
+    getElementTranslations("packages", "package_id", Package::getShortElementName(),
+        Package::getLongElementName(), elemDir, localeOrder, name, desc, keywords);
 }
 
 template <>
 void WorkspaceLibraryDb::getElementTranslations<Component>(const FilePath& elemDir,
     const QStringList& localeOrder, QString* name, QString* desc, QString* keywords) const throw (Exception)
 {
-    getElementTranslations("components", "ccomponent_id", elemDir, localeOrder, name, desc, keywords);
+    getElementTranslations("components", "component_id", Component::getShortElementName(),
+        Component::getLongElementName(), elemDir, localeOrder, name, desc, keywords);
 }
 
 template <>
 void WorkspaceLibraryDb::getElementTranslations<Device>(const FilePath& elemDir,
     const QStringList& localeOrder, QString* name, QString* desc, QString* keywords) const throw (Exception)
 {
-    getElementTranslations("devices", "device_id", elemDir, localeOrder, name, desc, keywords);
+    getElementTranslations("devices", "device_id", Device::getShortElementName(),
+        Device::getLongElementName(), elemDir, localeOrder, name, desc, keywords);
 }
 
 void WorkspaceLibraryDb::getDeviceMetadata(const FilePath& devDir, Uuid* pkgUuid) const throw (Exception)
@@ -200,6 +213,7 @@ void WorkspaceLibraryDb::getDeviceMetadata(const FilePath& devDir, Uuid* pkgUuid
         "SELECT package_uuid FROM devices WHERE filepath = :filepath");
     query.bindValue(":filepath", devDir.toRelative(mWorkspace.getLibrariesPath()));
     mDb->exec(query);
+    auto finishGuard = scopeGuard([&query](){query.finish();});
 
     Uuid uuid = query.first() ? Uuid(query.value(0).toString()) : Uuid();
     if (uuid.isNull()) {
@@ -235,6 +249,7 @@ QSet<Uuid> WorkspaceLibraryDb::getDevicesOfComponent(const Uuid& component) cons
         "SELECT uuid FROM devices WHERE component_uuid = :uuid");
     query.bindValue(":uuid", component.toStr());
     mDb->exec(query);
+    auto finishGuard = scopeGuard([&query](){query.finish();});
 
     QSet<Uuid> elements;
     while (query.next()) {
@@ -248,13 +263,119 @@ QSet<Uuid> WorkspaceLibraryDb::getDevicesOfComponent(const Uuid& component) cons
     return elements;
 }
 
+/*****************************************************************************************
+ *  Search
+ ****************************************************************************************/
+
+QList<WorkspaceLibraryDb::SearchResult> WorkspaceLibraryDb::search(const QString& input,
+    const QString& locale, ElementTypes types, int limit) const throw (Exception)
+{
+    QList<SearchResult> results;
+
+    // split the input into words (the last word may be incomplete while typing), the
+    // unicode option is needed to not split at non-ASCII letters (e.g. umlauts)
+    QStringList words = input.split(QRegularExpression("\\W+",
+        QRegularExpression::UseUnicodePropertiesOption), QString::SkipEmptyParts);
+    if (words.isEmpty() || (limit <= 0)) return results;
+
+    // the tables to search in
+    QStringList tables;
+    foreach (ElementType type, getAllElementTypes()) {
+        if (types.testFlag(type)) tables.append("'" % getElementTable(type) % "'");
+    }
+    if (tables.isEmpty()) return results;
+
+    QSqlQuery query;
+    if (mFullTextSearchAvailable) {
+        // every word is used as a prefix, all words must match
+        QStringList terms;
+        foreach (const QString& word, words) {
+            terms.append("\"" % word % "\"*");
+        }
+        // weight the columns: name > keywords > description (bm25: lower is better)
+        query = mDb->prepareQuery(
+            "SELECT element_table, uuid, name, MIN(score) FROM ("
+            "SELECT search_entries.element_table AS element_table, "
+            "search_entries.uuid AS uuid, search_index.name AS name, "
+            "bm25(search_index, 10.0, 1.0, 5.0) AS score "
+            "FROM search_index "
+            "INNER JOIN search_entries ON search_entries.id = search_index.rowid "
+            "WHERE search_index MATCH :query "
+            "AND search_entries.locale IN (:locale, 'en_US') "
+            "AND search_entries.element_table IN (" % tables.join(", ") % ")"
+            ") GROUP BY element_table, uuid ORDER BY MIN(score) LIMIT :limit");
+        query.bindValue(":query", terms.join(" "));
+    } else {
+        // fallback without FTS5: substring search, sorted by name
+        QStringList conditions;
+        for (int i = 0; i < words.count(); ++i) {
+            conditions.append(QString("(search_index.name LIKE :word%1 "
+                                      "OR search_index.keywords LIKE :word%1 "
+                                      "OR search_index.description LIKE :word%1)").arg(i));
+        }
+        query = mDb->prepareQuery(
+            "SELECT search_entries.element_table, search_entries.uuid, "
+            "search_index.name FROM search_index "
+            "INNER JOIN search_entries ON search_entries.id = search_index.rowid "
+            "WHERE " % conditions.join(" AND ") % " "
+            "AND search_entries.locale IN (:locale, 'en_US') "
+            "AND search_entries.element_table IN (" % tables.join(", ") % ") "
+            "GROUP BY search_entries.element_table, search_entries.uuid "
+            "ORDER BY search_index.name LIMIT :limit");
+        for (int i = 0; i < words.count(); ++i) {
+            query.bindValue(QString(":word%1").arg(i), "%" % words.at(i) % "%");
+        }
+    }
+    query.bindValue(":locale", locale);
+    query.bindValue(":limit", limit);
+    mDb->exec(query);
+    auto finishGuard = scopeGuard([&query](){query.finish();});
+
+    while (query.next()) {
+        SearchResult result;
+        result.type = getElementType(query.value(0).toString());
+        result.uuid = Uuid(query.value(1).toString());
+        result.name = query.value(2).toString();
+        if (result.uuid.isNull()) throw LogicError(__FILE__, __LINE__);
+        results.append(result);
+    }
+    return results;
+}
+
+QString WorkspaceLibraryDb::getElementTable(ElementType type) noexcept
+{
+    switch (type) {
+        case ComponentCategories:   return QStringLiteral("component_categories");
+        case PackageCategories:     return QStringLiteral("package_categories");
+        case Symbols:               return QStringLiteral("symbols");
+        case Packages:              return QStringLiteral("packages");
+        case Components:            return QStringLiteral("components");
+        case Devices:               return QStringLiteral("devices");
+        default:                    Q_ASSERT(false); return QString();
+    }
+}
+
+WorkspaceLibraryDb::ElementType WorkspaceLibraryDb::getElementType(const QString& table) throw (Exception)
+{
+    foreach (ElementType type, getAllElementTypes()) {
+        if (getElementTable(type) == table) return type;
+    }
+    throw LogicError(__FILE__, __LINE__, table);
+}
+
+QList<WorkspaceLibraryDb::ElementType> WorkspaceLibraryDb::getAllElementTypes() noexcept
+{
+    return QList<ElementType>() << ComponentCategories << PackageCategories << Symbols
+                                << Packages << Components << Devices;
+}
+
 /*****************************************************************************************
  *  General Methods
  ****************************************************************************************/
 
-void WorkspaceLibraryDb::startLibraryRescan() noexcept
+void WorkspaceLibraryDb::startLibraryRescan(bool fullRescan) noexcept
 {
-    mLibraryScanner->start();
+    mLibraryScanner->startScan(fullRescan);
 }
 
 /*****************************************************************************************
@@ -262,7 +383,8 @@ void WorkspaceLibraryDb::startLibraryRescan() noexcept
  ****************************************************************************************/
 
 void WorkspaceLibraryDb::getElementTranslations(const QString& table,
-    const QString& idRow, const FilePath& elemDir, const QStringList& localeOrder,
+    const QString& idRow, const QString& shortElementName, const QString& longElementName,
+    const FilePath& elemDir, const QStringList& localeOrder,
     QString* name, QString* desc, QString* keywords) const throw (Exception)
 {
     QSqlQuery query = mDb->prepareQuery(
@@ -271,6 +393,7 @@ void WorkspaceLibraryDb::getElementTranslations(const QString& table,
         "WHERE " % table % ".filepath = :filepath");
     query.bindValue(":filepath", elemDir.toRelative(mWorkspace.getLibrariesPath()));
     mDb->exec(query);
+    auto finishGuard = scopeGuard([&query](){query.finish();});
 
     QMap<QString, QString> nameList;
     QMap<QString, QString> descriptionList;
@@ -285,6 +408,14 @@ void WorkspaceLibraryDb::getElementTranslations(const QString& table,
         if (!keywords.isNull())      keywordsList.insert(locale, keywords);
     }
 
+    if (nameList.isEmpty()) {
+        // the element is not (yet) indexed, so read its metadata directly from the file
+        LibraryElementMetadata metadata(elemDir, shortElementName, longElementName); // can throw
+        nameList = metadata.getNames();
+        descriptionList = metadata.getDescriptions();
+        keywordsList = metadata.getKeywords();
+    }
+
     if (name) *name = LibraryBaseElement::localeStringFromList(nameList, localeOrder);
     if (desc) *desc = LibraryBaseElement::localeStringFromList(descriptionList, localeOrder);
     if (keywords) *keywords = LibraryBaseElement::localeStringFromList(keywordsList, localeOrder);
@@ -297,6 +428,7 @@ QMultiMap<Version, FilePath> WorkspaceLibraryDb::getElementFilePathsFromDb(
         "SELECT version, filepath FROM " % tablename % " WHERE uuid = :uuid");
     query.bindValue(":uuid", uuid.toStr());
     mDb->exec(query);
+    auto finishGuard = scopeGuard([&query](){query.finish();});
 
     QMultiMap<Version, FilePath> elements;
     while (query.next()) {
@@ -324,8 +456,10 @@ QSet<Uuid> WorkspaceLibraryDb::getCategoryChilds(const QString& tablename, const
 {
     QSqlQuery query = mDb->prepareQuery(
         "SELECT uuid FROM " % tablename % " WHERE parent_uuid " %
-        (categoryUuid.isNull() ? QString("IS NULL") : "= '" % categoryUuid.toStr() % "'"));
+        (categoryUuid.isNull() ? QString("IS NULL") : QString("= :uuid")));
+    if (!categoryUuid.isNull()) query.bindValue(":uuid", categoryUuid.toStr());
     mDb->exec(query);
+    auto finishGuard = scopeGuard([&query](){query.finish();});
 
     QSet<Uuid> elements;
     while (query.next()) {
@@ -346,8 +480,10 @@ QSet<Uuid> WorkspaceLibraryDb::getElementsByCategory(const QString& tablename,
         "SELECT uuid FROM " % tablename % " LEFT JOIN " % tablename % "_cat "
         "ON " % tablename % ".id=" % tablename % "_cat." % idrowname % " "
         "WHERE category_uuid " %
-        (categoryUuid.isNull() ? QString("IS NULL") : "= '" % categoryUuid.toStr() % "'"));
+        (categoryUuid.isNull() ? QString("IS NULL") : QString("= :uuid")));
+    if (!categoryUuid.isNull()) query.bindValue(":uuid", categoryUuid.toStr());
     mDb->exec(query);
+    auto finishGuard = scopeGuard([&query](){query.finish();});
 
     QSet<Uuid> elements;
     while (query.next()) {
@@ -375,6 +511,14 @@ void WorkspaceLibraryDb::createAllTables() throw (Exception)
                         "`value_blob` BLOB "
                         ")");
 
+    // element files (used to detect modified elements on incremental rescans)
+    queries << QString( "CREATE TABLE IF NOT EXISTS element_files ("
+                        "`id` INTEGER PRIMARY KEY NOT NULL, "
+                        "`filepath` TEXT UNIQUE NOT NULL, "
+                        "`modified` INTEGER NOT NULL, "
+                        "`size` INTEGER NOT NULL"
+                        ")");
+
     // component categories
     queries << QString( "CREATE TABLE IF NOT EXISTS component_categories ("
                         "`id` INTEGER PRIMARY KEY NOT NULL, "
@@ -505,11 +649,91 @@ void WorkspaceLibraryDb::createAllTables() throw (Exception)
                         "UNIQUE(device_id, category_uuid)"
                         ")");
 
+    // search index (one entry per element and locale)
+    queries << QString( "CREATE TABLE IF NOT EXISTS search_entries ("
+                        "`id` INTEGER PRIMARY KEY NOT NULL, "
+                        "`filepath` TEXT NOT NULL, "
+                        "`element_table` TEXT NOT NULL, "
+                        "`uuid` TEXT NOT NULL, "
+                        "`locale` TEXT NOT NULL"
+                        ")");
+
     // execute queries
     foreach (const QString& string, queries) {
-        QSqlQuery query = mDb->prepareQuery(string); // can throw
+        QSqlQuery query = mDb->prepareQuery(string, false); // can throw
         mDb->exec(query); // can throw
     }
+
+    // full-text index of the search entries (rowid = search_entries.id), if the SQLite
+    // library does not support FTS5, use a normal table instead (searched with LIKE)
+    try {
+        QSqlQuery query = mDb->prepareQuery(
+            "CREATE VIRTUAL TABLE IF NOT EXISTS search_index USING fts5("
+            "name, description, keywords, prefix='2 3')", false); // can throw
+        mDb->exec(query); // can throw
+    } catch (const Exception& e) {
+        qWarning() << "SQLite FTS5 not available, library search will be slow:" << e.getDebugMsg();
+        QSqlQuery query = mDb->prepareQuery(
+            "CREATE TABLE IF NOT EXISTS search_index ("
+            "`name` TEXT, `description` TEXT, `keywords` TEXT)", false); // can throw
+        mDb->exec(query); // can throw
+    }
+    QSqlQuery query = mDb->prepareQuery(
+        "SELECT sql FROM sqlite_master WHERE name = 'search_index'", false); // can throw
+    mDb->exec(query); // can throw
+    mFullTextSearchAvailable = query.first() &&
+        query.value(0).toString().contains("fts5", Qt::CaseInsensitive);
+}
+
+void WorkspaceLibraryDb::migrateDatabase() throw (Exception)
+{
+    QSqlQuery versionQuery = mDb->prepareQuery("PRAGMA user_version", false); // can throw
+    mDb->exec(versionQuery); // can throw
+    int version = versionQuery.first() ? versionQuery.value(0).toInt() : 0;
+    versionQuery.finish();
+
+    if (version > sDatabaseVersion) {
+        qWarning() << "The workspace library database was created with a newer application "
+                      "version, schema version:" << version;
+        return;
+    }
+
+    QStringList queries;
+
+    // version 1: indexes for all columns used for lookups
+    if (version < 1) {
+        queries << QString("CREATE INDEX IF NOT EXISTS component_categories_uuid_index ON component_categories (uuid)");
+        queries << QString("CREATE INDEX IF NOT EXISTS component_categories_parent_uuid_index ON component_categories (parent_uuid)");
+        queries << QString("CREATE INDEX IF NOT EXISTS package_categories_uuid_index ON package_categories (uuid)");
+        queries << QString("CREATE INDEX IF NOT EXISTS package_categories_parent_uuid_index ON package_categories (parent_uuid)");
+        queries << QString("CREATE INDEX IF NOT EXISTS symbols_uuid_index ON symbols (uuid)");
+        queries << QString("CREATE INDEX IF NOT EXISTS symbols_cat_category_uuid_index ON symbols_cat (category_uuid)");
+        queries << QString("CREATE INDEX IF NOT EXISTS packages_uuid_index ON packages (uuid)");
+        queries << QString("CREATE INDEX IF NOT EXISTS packages_cat_category_uuid_index ON packages_cat (category_uuid)");
+        queries << QString("CREATE INDEX IF NOT EXISTS components_uuid_index ON components (uuid)");
+        queries << QString("CREATE INDEX IF NOT EXISTS components_cat_category_uuid_index ON components_cat (category_uuid)");
+        queries << QString("CREATE INDEX IF NOT EXISTS devices_uuid_index ON devices (uuid)");
+        queries << QString("CREATE INDEX IF NOT EXISTS devices_component_uuid_index ON devices (component_uuid)");
+        queries << QString("CREATE INDEX IF NOT EXISTS devices_cat_category_uuid_index ON devices_cat (category_uuid)");
+    }
+
+    // version 2: search index (forget all file fingerprints to reindex all elements)
+    if (version < 2) {
+        queries << QString("CREATE INDEX IF NOT EXISTS search_entries_filepath_index ON search_entries (filepath)");
+        queries << QString("DELETE FROM element_files");
+    }
+
+    if (version < sDatabaseVersion) {
+        qDebug() << "Migrate workspace library database from schema version" << version
+                 << "to" << sDatabaseVersion;
+        queries << QString("PRAGMA user_version = %1").arg(sDatabaseVersion);
+        SQLiteDatabase::TransactionScopeGuard transactionGuard(*mDb); // can throw
+        foreach (const QString& string, queries) {
+            QSqlQuery query = mDb->prepareQuery(string, false); // can throw
+            mDb->exec(query); // can throw
+        }
+        transactionGuard.commit(); // can throw
+    }
 }
 
 /*****************************************************************************************
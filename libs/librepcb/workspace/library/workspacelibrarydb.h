@@ -54,6 +54,25 @@ class WorkspaceLibraryDb final : public QObject
 
     public:
 
+        // Types
+        enum ElementType {
+            ComponentCategories = 0x01,
+            PackageCategories   = 0x02,
+            Symbols             = 0x04,
+            Packages            = 0x08,
+            Components          = 0x10,
+            Devices             = 0x20,
+            AllElementTypes     = 0x3F,
+        };
+        Q_DECLARE_FLAGS(ElementTypes, ElementType)
+
+        /// A single result of #search()
+        struct SearchResult {
+            ElementType type;
+            Uuid uuid;
+            QString name;   ///< in the requested locale or "en_US"
+        };
+
         // Constructors / Destructor
         WorkspaceLibraryDb() = delete;
         WorkspaceLibraryDb(const WorkspaceLibraryDb& other) = delete;
@@ -98,12 +117,36 @@ class WorkspaceLibraryDb final : public QObject
         QSet<Uuid> getComponentsByCategory(const Uuid& category) const throw (Exception);
         QSet<Uuid> getDevicesOfComponent(const Uuid& component) const throw (Exception);
 
+        // Search
+
+        /**
+         * @brief Search library elements by their names, keywords and descriptions
+         *
+         * Each word of the input is matched as a prefix (to support type-ahead), all words
+         * must match. If the SQLite library supports FTS5, the results are ranked by
+         * relevance (name matches first), otherwise they are sorted by name.
+         *
+         * @param input     The search string entered by the user
+         * @param locale    The locale to search in (in addition to "en_US")
+         * @param types     The element types to search for
+         * @param limit     The maximum number of results
+         *
+         * @return Matching elements (each UUID only once), best matches first
+         */
+        QList<SearchResult> search(const QString& input, const QString& locale,
+                                   ElementTypes types = AllElementTypes,
+                                   int limit = 100) const throw (Exception);
+
         // General Methods
 
         /**
          * @brief Rescan the whole library directory and update the SQLite database
+         *
+         * @param fullRescan    If false (default), only added, modified or removed
+         *                      elements are updated. If true, the database is rebuilt
+         *                      from scratch.
          */
-        void startLibraryRescan() noexcept;
+        void startLibraryRescan(bool fullRescan = false) noexcept;
 
         // Operator Overloadings
         WorkspaceLibraryDb& operator=(const WorkspaceLibraryDb& rhs) = delete;
@@ -115,13 +158,19 @@ class WorkspaceLibraryDb final : public QObject
         void scanProgressUpdate(int percent);
         void scanSucceeded(int elementCount);
         void scanFailed(QString errorMsg);
+        void scanStatistics(int skippedCount, int updatedCount, int removedCount);
 
 
     private:
 
         // Private Methods
+        static QString getElementTable(ElementType type) noexcept;
+        static ElementType getElementType(const QString& table) throw (Exception);
+        static QList<ElementType> getAllElementTypes() noexcept;
         void getElementTranslations(const QString& table, const QString& idRow,
-                                    const FilePath& elemDir, const QStringList& localeOrder,
+                                    const QString& shortElementName,
+                                    const QString& longElementName, const FilePath& elemDir,
+                                    const QStringList& localeOrder,
                                     QString* name, QString* desc, QString* keywords) const throw (Exception);
         QMultiMap<Version, FilePath> getElementFilePathsFromDb(const QString& tablename,
                                                                const Uuid& uuid) const throw (Exception);
@@ -130,13 +179,16 @@ class WorkspaceLibraryDb final : public QObject
         QSet<Uuid> getElementsByCategory(const QString& tablename, const QString& idrowname,
                                          const Uuid& categoryUuid) const throw (Exception);
         void createAllTables() throw (Exception);
+        void migrateDatabase() throw (Exception);
 
-
+        // Constants
+        static constexpr int sDatabaseVersion = 2; ///< see #migrateDatabase()
 
         // Attributes
         Workspace& mWorkspace;
         QScopedPointer<SQLiteDatabase> mDb; ///< the SQLite database "library_cache.sqlite"
         QScopedPointer<WorkspaceLibraryScanner> mLibraryScanner;
+        bool mFullTextSearchAvailable; ///< whether SQLite supports FTS5 (see #search())
 };
 
 /*****************************************************************************************
@@ -146,4 +198,6 @@ class WorkspaceLibraryDb final : public QObject
 } // namespace workspace
 } // namespace librepcb
 
+Q_DECLARE_OPERATORS_FOR_FLAGS(librepcb::workspace::WorkspaceLibraryDb::ElementTypes)
+
 #endif // LIBREPCB_WORKSPACE_WORKSPACELIBRARYDB_H
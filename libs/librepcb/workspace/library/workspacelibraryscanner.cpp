@@ -23,6 +23,7 @@
 #include <QtCore>
 #include "workspacelibraryscanner.h"
 #include <librepcb/common/sqlitedatabase.h>
+#include <librepcb/common/scopeguard.h>
 #include <librepcb/library/elements.h>
 #include "../workspace.h"
 
@@ -34,12 +35,46 @@ namespace workspace {
 
 using namespace library;
 
+/*****************************************************************************************
+ *  Class ParserTask
+ ****************************************************************************************/
+
+/**
+ * @brief Parses a single library element in a thread of the QThreadPool
+ */
+class WorkspaceLibraryScanner::ParserTask final : public QRunnable
+{
+    public:
+        ParserTask(WorkspaceLibraryScanner& scanner, const ElementEntryPtr& element) noexcept :
+            QRunnable(), mScanner(scanner), mElement(element) {}
+
+        void run() noexcept override
+        {
+            mElement->valid = false;
+            if (!mScanner.mAbort) {
+                try {
+                    mElement->metadata = LibraryElementMetadata(mElement->filepath,
+                        mElement->shortElementName, mElement->longElementName); // can throw
+                    mElement->valid = true;
+                } catch (const Exception& e) {
+                    qWarning() << "Failed to open library element:" << mElement->filepath.toNative();
+                }
+            }
+            mScanner.addParsedElement(mElement);
+        }
+
+    private:
+        WorkspaceLibraryScanner& mScanner;
+        ElementEntryPtr mElement;
+};
+
 /*****************************************************************************************
  *  Constructors / Destructor
  ****************************************************************************************/
 
 WorkspaceLibraryScanner::WorkspaceLibraryScanner(Workspace& ws) noexcept :
-    QThread(nullptr), mWorkspace(ws), mAbort(false)
+    QThread(nullptr), mWorkspace(ws), mAbort(false), mFullRescan(false), mSkippedCount(0),
+    mUpdatedCount(0), mLastProgressPercent(0)
 {
 }
 
@@ -55,6 +90,18 @@ WorkspaceLibraryScanner::~WorkspaceLibraryScanner() noexcept
     }
 }
 
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+void WorkspaceLibraryScanner::startScan(bool fullRescan) noexcept
+{
+    if (!isRunning()) {
+        mFullRescan = fullRescan;
+        start();
+    }
+}
+
 /*****************************************************************************************
  *  Private Methods
  ****************************************************************************************/
@@ -63,6 +110,10 @@ void WorkspaceLibraryScanner::run() noexcept
 {
     try {
         mAbort = false;
+        mScannedElements.clear();
+        mSkippedCount = 0;
+        mUpdatedCount = 0;
+        mLastProgressPercent = 0;
         emit started();
 
         // get a list of all available libraries
@@ -74,40 +125,58 @@ void WorkspaceLibraryScanner::run() noexcept
         FilePath dbFilePath = mWorkspace.getMetadataPath().getPathTo("library_cache.sqlite");
         SQLiteDatabase db(dbFilePath); // can throw
 
+        // the database is only a cache which can be rebuilt at any time, so trade
+        // durability for speed while writing it
+        SQLiteDatabase::FastRebuildScopeGuard fastRebuildGuard(db); // can throw
+
         // begin database transaction
         SQLiteDatabase::TransactionScopeGuard transactionGuard(db); // can throw
 
-        // clear all tables
-        clearAllTables(db);
+        // clear all tables if a full rescan is requested, otherwise only the modified
+        // elements will be updated
+        QHash<QString, FileFingerprint> knownFingerprints;
+        if (mFullRescan) {
+            clearAllTables(db);
+        } else {
+            knownFingerprints = getFingerprintsFromDb(db);
+        }
 
-        // scan all libraries
-        int count = 0;
-        qreal percent = 0;
+        // collect all elements of all libraries which need to be (re-)parsed
+        QList<ElementEntryPtr> outdated;
         foreach (const QSharedPointer<Library>& lib, libraries) {
             if (mAbort) break;
-            count += addCategoriesToDb<ComponentCategory>(  db, lib->searchForElements<ComponentCategory>(),    "component_categories", "cat_id");
-            emit progressUpdate(percent += qreal(100) / (libraries.count() * 6));
-            if (mAbort) break;
-            count += addCategoriesToDb<PackageCategory>(    db, lib->searchForElements<PackageCategory>(),      "package_categories",   "cat_id");
-            emit progressUpdate(percent += qreal(100) / (libraries.count() * 6));
-            if (mAbort) break;
-            count += addElementsToDb<Symbol>(               db, lib->searchForElements<Symbol>(),               "symbols",              "symbol_id");
-            emit progressUpdate(percent += qreal(100) / (libraries.count() * 6));
-            if (mAbort) break;
-            count += addElementsToDb<Package>(              db, lib->searchForElements<Package>(),              "packages",             "package_id");
-            emit progressUpdate(percent += qreal(100) / (libraries.count() * 6));
-            if (mAbort) break;
-            count += addElementsToDb<Component>(            db, lib->searchForElements<Component>(),            "components",           "component_id");
-            emit progressUpdate(percent += qreal(100) / (libraries.count() * 6));
-            if (mAbort) break;
-            count += addDevicesToDb(                        db, lib->searchForElements<Device>(),               "devices",              "device_id");
-            emit progressUpdate(percent += qreal(100) / (libraries.count() * 6));
+            collectElements<ComponentCategory>(lib->searchForElements<ComponentCategory>(), ElementKind::Category, "component_categories", "cat_id",       knownFingerprints, outdated);
+            collectElements<PackageCategory>(  lib->searchForElements<PackageCategory>(),   ElementKind::Category, "package_categories",   "cat_id",       knownFingerprints, outdated);
+            collectElements<Symbol>(           lib->searchForElements<Symbol>(),            ElementKind::Element,  "symbols",              "symbol_id",    knownFingerprints, outdated);
+            collectElements<Package>(          lib->searchForElements<Package>(),           ElementKind::Element,  "packages",             "package_id",   knownFingerprints, outdated);
+            collectElements<Component>(        lib->searchForElements<Component>(),         ElementKind::Element,  "components",           "component_id", knownFingerprints, outdated);
+            collectElements<Device>(           lib->searchForElements<Device>(),            ElementKind::Device,   "devices",              "device_id",    knownFingerprints, outdated);
+        }
+
+        // parse all outdated elements in parallel and write them into the database
+        if (!mAbort) {
+            parseAndAddElementsToDb(db, outdated, mSkippedCount + outdated.count()); // can throw
+        }
+
+        // remove elements which do not exist anymore
+        int removedCount = 0;
+        if (!mAbort) {
+            removedCount += removeStaleElementsFromDb(db, "component_categories", "cat_id",       false);
+            removedCount += removeStaleElementsFromDb(db, "package_categories",   "cat_id",       false);
+            removedCount += removeStaleElementsFromDb(db, "symbols",              "symbol_id",    true);
+            removedCount += removeStaleElementsFromDb(db, "packages",             "package_id",   true);
+            removedCount += removeStaleElementsFromDb(db, "components",           "component_id", true);
+            removedCount += removeStaleElementsFromDb(db, "devices",              "device_id",    true);
         }
 
         // commit transaction
         if (!mAbort) {
             transactionGuard.commit(); // can throw
-            emit succeeded(count);
+            qDebug() << "Library scan finished:" << mSkippedCount << "elements skipped,"
+                     << mUpdatedCount << "updated," << removedCount << "removed.";
+            emit progressUpdate(100);
+            emit statistics(mSkippedCount, mUpdatedCount, removedCount);
+            emit succeeded(mSkippedCount + mUpdatedCount);
         }
     } catch (const Exception& e) {
         emit failed(e.getUserMsg());
@@ -118,6 +187,9 @@ void WorkspaceLibraryScanner::clearAllTables(SQLiteDatabase& db) throw (Exceptio
 {
     // internal
     db.clearTable("internal");
+    db.clearTable("element_files");
+    db.clearTable("search_index");
+    db.clearTable("search_entries");
 
     // component categories
     db.clearTable("component_categories_tr");
@@ -149,136 +221,339 @@ void WorkspaceLibraryScanner::clearAllTables(SQLiteDatabase& db) throw (Exceptio
 }
 
 template <typename ElementType>
-int WorkspaceLibraryScanner::addCategoriesToDb(SQLiteDatabase& db, const QList<FilePath>& dirs,
-    const QString& table, const QString& idColumn) throw (Exception)
+void WorkspaceLibraryScanner::collectElements(const QList<FilePath>& dirs, ElementKind kind,
+    const QString& table, const QString& idColumn,
+    const QHash<QString, FileFingerprint>& knownFingerprints,
+    QList<ElementEntryPtr>& outdated) noexcept
 {
-    int count = 0;
     foreach (const FilePath& filepath, dirs) {
         if (mAbort) break;
-        try {
-            ElementType element(filepath, true); // can throw
-            QSqlQuery query = db.prepareQuery(
-                "INSERT INTO " % table % " "
-                "(filepath, uuid, version, parent_uuid) VALUES "
-                "(:filepath, :uuid, :version, :parent_uuid)");
-            query.bindValue(":filepath",    filepath.toRelative(mWorkspace.getLibrariesPath()));
-            query.bindValue(":uuid",        element.getUuid().toStr());
-            query.bindValue(":version",     element.getVersion().toStr());
-            query.bindValue(":parent_uuid", element.getParentUuid().isNull() ? QVariant(QVariant::String) : element.getParentUuid().toStr());
-            int id = db.insert(query);
-            foreach (const QString& locale, element.getAllAvailableLocales()) {
-                QSqlQuery query = db.prepareQuery(
-                    "INSERT INTO " % table % "_tr "
-                    "(" % idColumn % ", locale, name, description, keywords) VALUES "
-                    "(:element_id, :locale, :name, :description, :keywords)");
-                query.bindValue(":element_id",  id);
-                query.bindValue(":locale",      locale);
-                query.bindValue(":name",        element.getNames().value(locale));
-                query.bindValue(":description", element.getDescriptions().value(locale));
-                query.bindValue(":keywords",    element.getKeywords().value(locale));
-                db.insert(query);
-            }
-            count++;
-        } catch (const Exception& e) {
-            qWarning() << "Failed to open library element:" << filepath.toNative();
+        ElementEntryPtr element(new ElementEntry());
+        element->kind = kind;
+        element->table = table;
+        element->idColumn = idColumn;
+        element->shortElementName = ElementType::getShortElementName();
+        element->longElementName = ElementType::getLongElementName();
+        element->filepath = filepath;
+        element->relFilePath = filepath.toRelative(mWorkspace.getLibrariesPath());
+        element->fingerprint = getFileFingerprint(
+            filepath.getPathTo(ElementType::getLongElementName() % ".xml"));
+        element->valid = false;
+        mScannedElements[table].insert(element->relFilePath);
+
+        auto known = knownFingerprints.constFind(element->relFilePath);
+        if ((known != knownFingerprints.constEnd())
+            && (known->modified == element->fingerprint.modified)
+            && (known->size == element->fingerprint.size))
+        {
+            mSkippedCount++; // element is already up to date
+        } else {
+            outdated.append(element);
         }
     }
-    return count;
 }
 
-template <typename ElementType>
-int WorkspaceLibraryScanner::addElementsToDb(SQLiteDatabase& db, const QList<FilePath>& dirs,
-    const QString& table, const QString& idColumn) throw (Exception)
+void WorkspaceLibraryScanner::parseAndAddElementsToDb(SQLiteDatabase& db,
+    const QList<ElementEntryPtr>& elements, int totalCount) throw (Exception)
 {
-    int count = 0;
-    foreach (const FilePath& filepath, dirs) {
-        if (mAbort) break;
-        try {
-            ElementType element(filepath, true); // can throw
-            QSqlQuery query = db.prepareQuery(
-                "INSERT INTO " % table % " "
-                "(filepath, uuid, version) VALUES "
-                "(:filepath, :uuid, :version)");
-            query.bindValue(":filepath",    filepath.toRelative(mWorkspace.getLibrariesPath()));
-            query.bindValue(":uuid",        element.getUuid().toStr());
-            query.bindValue(":version",     element.getVersion().toStr());
-            int id = db.insert(query);
-            foreach (const QString& locale, element.getAllAvailableLocales()) {
-                QSqlQuery query = db.prepareQuery(
-                    "INSERT INTO " % table % "_tr "
-                    "(" % idColumn % ", locale, name, description, keywords) VALUES "
-                    "(:element_id, :locale, :name, :description, :keywords)");
-                query.bindValue(":element_id",  id);
-                query.bindValue(":locale",      locale);
-                query.bindValue(":name",        element.getNames().value(locale));
-                query.bindValue(":description", element.getDescriptions().value(locale));
-                query.bindValue(":keywords",    element.getKeywords().value(locale));
-                db.insert(query);
-            }
-            foreach (const Uuid& categoryUuid, element.getCategories()) {
-                Q_ASSERT(!categoryUuid.isNull());
-                QSqlQuery query = db.prepareQuery(
-                    "INSERT INTO " % table % "_cat "
-                    "(" % idColumn % ", category_uuid) VALUES "
-                    "(:element_id, :category_uuid)");
-                query.bindValue(":element_id",  id);
-                query.bindValue(":category_uuid", categoryUuid.toStr());
-                db.insert(query);
-            }
-            count++;
-        } catch (const Exception& e) {
-            qWarning() << "Failed to open library element:" << filepath.toNative();
+    {
+        QMutexLocker locker(&mParsedElementsMutex);
+        mParsedElements.clear();
+    }
+
+    // parse the elements on a thread pool (one thread per CPU core)
+    QThreadPool pool;
+    pool.setMaxThreadCount(qMax(QThread::idealThreadCount(), 1));
+    foreach (const ElementEntryPtr& element, elements) {
+        pool.start(new ParserTask(*this, element)); // takes ownership
+    }
+
+    // write the parsed elements into the database (in batches, as they get available)
+    try {
+        int written = 0;
+        while ((written < elements.count()) && (!mAbort)) {
+            QList<ElementEntryPtr> batch = takeParsedElements();
+            if (batch.isEmpty()) continue;
+            addElementsToDb(db, batch); // can throw
+            written += batch.count();
+            updateProgress(mSkippedCount + written, totalCount);
         }
+    } catch (const Exception& e) {
+        mAbort = true; // stop the parser threads as fast as possible
+        pool.clear();
+        pool.waitForDone();
+        throw;
+    }
+
+    if (mAbort) {
+        pool.clear(); // remove tasks which are not yet started
     }
-    return count;
+    pool.waitForDone();
 }
 
-int WorkspaceLibraryScanner::addDevicesToDb(SQLiteDatabase& db, const QList<FilePath>& dirs,
-    const QString& table, const QString& idColumn) throw (Exception)
+void WorkspaceLibraryScanner::addParsedElement(const ElementEntryPtr& element) noexcept
 {
-    int count = 0;
-    foreach (const FilePath& filepath, dirs) {
-        if (mAbort) break;
-        try {
-            Device element(filepath, true); // can throw
-            QSqlQuery query = db.prepareQuery(
-                "INSERT INTO " % table % " "
-                "(filepath, uuid, version, component_uuid, package_uuid) VALUES "
-                "(:filepath, :uuid, :version, :component_uuid, :package_uuid)");
-            query.bindValue(":filepath",        filepath.toRelative(mWorkspace.getLibrariesPath()));
-            query.bindValue(":uuid",            element.getUuid().toStr());
-            query.bindValue(":version",         element.getVersion().toStr());
-            query.bindValue(":component_uuid",  element.getComponentUuid().toStr());
-            query.bindValue(":package_uuid",    element.getPackageUuid().toStr());
-            int id = db.insert(query);
-            foreach (const QString& locale, element.getAllAvailableLocales()) {
-                QSqlQuery query = db.prepareQuery(
-                    "INSERT INTO " % table % "_tr "
-                    "(" % idColumn % ", locale, name, description, keywords) VALUES "
-                    "(:element_id, :locale, :name, :description, :keywords)");
-                query.bindValue(":element_id",  id);
-                query.bindValue(":locale",      locale);
-                query.bindValue(":name",        element.getNames().value(locale));
-                query.bindValue(":description", element.getDescriptions().value(locale));
-                query.bindValue(":keywords",    element.getKeywords().value(locale));
-                db.insert(query);
+    QMutexLocker locker(&mParsedElementsMutex);
+    mParsedElements.append(element);
+    mParsedElementsAvailable.wakeAll();
+}
+
+QList<WorkspaceLibraryScanner::ElementEntryPtr> WorkspaceLibraryScanner::takeParsedElements() noexcept
+{
+    QMutexLocker locker(&mParsedElementsMutex);
+    if (mParsedElements.isEmpty()) {
+        // use a timeout to keep the abort flag responsive
+        mParsedElementsAvailable.wait(&mParsedElementsMutex, 100);
+    }
+    QList<ElementEntryPtr> batch;
+    if (mParsedElements.count() <= sMaxBatchSize) {
+        batch.swap(mParsedElements);
+    } else {
+        batch = mParsedElements.mid(0, sMaxBatchSize);
+        mParsedElements.erase(mParsedElements.begin(), mParsedElements.begin() + sMaxBatchSize);
+    }
+    return batch;
+}
+
+void WorkspaceLibraryScanner::addElementsToDb(SQLiteDatabase& db,
+    const QList<ElementEntryPtr>& elements) throw (Exception)
+{
+    // group the elements by their table
+    QMap<QString, QList<ElementEntryPtr>> elementsByTable;
+    foreach (const ElementEntryPtr& element, elements) {
+        elementsByTable[element->table].append(element);
+    }
+
+    foreach (const QList<ElementEntryPtr>& tableElements, elementsByTable) {
+        const ElementEntry& first = *tableElements.first();
+        const QString& table = first.table;
+        const QString& idColumn = first.idColumn;
+
+        // remove outdated entries
+        QStringList filepaths;
+        foreach (const ElementEntryPtr& element, tableElements) {
+            filepaths.append(element->relFilePath);
+        }
+        removeElementsFromDb(db, table, idColumn, first.kind != ElementKind::Category, filepaths);
+
+        // collect the values of all rows to insert
+        QVariantList filepath, uuid, version, parentUuid, componentUuid, packageUuid;
+        QVariantList trFilepath, trLocale, trName, trDescription, trKeywords;
+        QVariantList catFilepath, catUuid;
+        QVariantList fileModified, fileSize;
+        QVariantList searchUuid, searchName, searchDescription, searchKeywords;
+        foreach (const ElementEntryPtr& element, tableElements) {
+            if (!element->valid) continue; // element could not be parsed
+            const LibraryElementMetadata& metadata = element->metadata;
+            filepath.append(element->relFilePath);
+            uuid.append(metadata.getUuid().toStr());
+            version.append(metadata.getVersion().toStr());
+            parentUuid.append(metadata.getParentUuid().isNull() ? QVariant(QVariant::String) : metadata.getParentUuid().toStr());
+            componentUuid.append(metadata.getComponentUuid().toStr());
+            packageUuid.append(metadata.getPackageUuid().toStr());
+            fileModified.append(element->fingerprint.modified);
+            fileSize.append(element->fingerprint.size);
+            foreach (const QString& locale, metadata.getAllAvailableLocales()) {
+                trFilepath.append(element->relFilePath);
+                trLocale.append(locale);
+                trName.append(metadata.getNames().value(locale));
+                trDescription.append(metadata.getDescriptions().value(locale));
+                trKeywords.append(metadata.getKeywords().value(locale));
+                // search index: fall back to "en_US" for missing translations
+                QStringList localeOrder(locale);
+                searchUuid.append(metadata.getUuid().toStr());
+                searchName.append(LibraryBaseElement::localeStringFromList(metadata.getNames(), localeOrder));
+                searchDescription.append(LibraryBaseElement::localeStringFromList(metadata.getDescriptions(), localeOrder));
+                searchKeywords.append(LibraryBaseElement::localeStringFromList(metadata.getKeywords(), localeOrder));
             }
-            foreach (const Uuid& categoryUuid, element.getCategories()) {
+            QSet<Uuid> categories; // avoid violating the UNIQUE constraint
+            foreach (const Uuid& categoryUuid, metadata.getCategories()) {
                 Q_ASSERT(!categoryUuid.isNull());
-                QSqlQuery query = db.prepareQuery(
-                    "INSERT INTO " % table % "_cat "
-                    "(" % idColumn % ", category_uuid) VALUES "
-                    "(:element_id, :category_uuid)");
-                query.bindValue(":element_id",  id);
-                query.bindValue(":category_uuid", categoryUuid.toStr());
-                db.insert(query);
+                if (categories.contains(categoryUuid)) continue;
+                categories.insert(categoryUuid);
+                catFilepath.append(element->relFilePath);
+                catUuid.append(categoryUuid.toStr());
             }
-            count++;
-        } catch (const Exception& e) {
-            qWarning() << "Failed to open library element:" << filepath.toNative();
         }
+        if (filepath.isEmpty()) continue;
+
+        // main table
+        QSqlQuery query;
+        switch (first.kind) {
+            case ElementKind::Category:
+                query = db.prepareQuery(
+                    "INSERT INTO " % table % " "
+                    "(filepath, uuid, version, parent_uuid) VALUES "
+                    "(:filepath, :uuid, :version, :parent_uuid)");
+                query.bindValue(":parent_uuid", parentUuid);
+                break;
+            case ElementKind::Element:
+                query = db.prepareQuery(
+                    "INSERT INTO " % table % " "
+                    "(filepath, uuid, version) VALUES "
+                    "(:filepath, :uuid, :version)");
+                break;
+            case ElementKind::Device:
+                query = db.prepareQuery(
+                    "INSERT INTO " % table % " "
+                    "(filepath, uuid, version, component_uuid, package_uuid) VALUES "
+                    "(:filepath, :uuid, :version, :component_uuid, :package_uuid)");
+                query.bindValue(":component_uuid",  componentUuid);
+                query.bindValue(":package_uuid",    packageUuid);
+                break;
+        }
+        query.bindValue(":filepath",    filepath);
+        query.bindValue(":uuid",        uuid);
+        query.bindValue(":version",     version);
+        db.execBatch(query);
+
+        // translations and search index
+        if (!trFilepath.isEmpty()) {
+            query = db.prepareQuery(
+                "INSERT INTO " % table % "_tr "
+                "(" % idColumn % ", locale, name, description, keywords) VALUES "
+                "((SELECT id FROM " % table % " WHERE filepath = :filepath), "
+                ":locale, :name, :description, :keywords)");
+            query.bindValue(":filepath",    trFilepath);
+            query.bindValue(":locale",      trLocale);
+            query.bindValue(":name",        trName);
+            query.bindValue(":description", trDescription);
+            query.bindValue(":keywords",    trKeywords);
+            db.execBatch(query);
+
+            QVariantList elementTable;
+            for (int i = 0; i < trFilepath.count(); ++i) elementTable.append(table);
+            query = db.prepareQuery(
+                "INSERT INTO search_entries "
+                "(filepath, element_table, uuid, locale) VALUES "
+                "(:filepath, :element_table, :uuid, :locale)");
+            query.bindValue(":filepath",        trFilepath);
+            query.bindValue(":element_table",   elementTable);
+            query.bindValue(":uuid",            searchUuid);
+            query.bindValue(":locale",          trLocale);
+            db.execBatch(query);
+
+            query = db.prepareQuery(
+                "INSERT INTO search_index "
+                "(rowid, name, description, keywords) VALUES "
+                "((SELECT id FROM search_entries WHERE filepath = :filepath AND locale = :locale), "
+                ":name, :description, :keywords)");
+            query.bindValue(":filepath",    trFilepath);
+            query.bindValue(":locale",      trLocale);
+            query.bindValue(":name",        searchName);
+            query.bindValue(":description", searchDescription);
+            query.bindValue(":keywords",    searchKeywords);
+            db.execBatch(query);
+        }
+
+        // categories
+        if (!catFilepath.isEmpty()) {
+            query = db.prepareQuery(
+                "INSERT INTO " % table % "_cat "
+                "(" % idColumn % ", category_uuid) VALUES "
+                "((SELECT id FROM " % table % " WHERE filepath = :filepath), :category_uuid)");
+            query.bindValue(":filepath",        catFilepath);
+            query.bindValue(":category_uuid",   catUuid);
+            db.execBatch(query);
+        }
+
+        // file fingerprints
+        query = db.prepareQuery(
+            "INSERT OR REPLACE INTO element_files "
+            "(filepath, modified, size) VALUES "
+            "(:filepath, :modified, :size)");
+        query.bindValue(":filepath",    filepath);
+        query.bindValue(":modified",    fileModified);
+        query.bindValue(":size",        fileSize);
+        db.execBatch(query);
+
+        mUpdatedCount += filepath.count();
+    }
+}
+
+WorkspaceLibraryScanner::FileFingerprint WorkspaceLibraryScanner::getFileFingerprint(
+    const FilePath& xmlFilePath) const noexcept
+{
+    QFileInfo info(xmlFilePath.toStr());
+    FileFingerprint fingerprint;
+    fingerprint.modified = info.exists() ? info.lastModified().toMSecsSinceEpoch() : -1;
+    fingerprint.size = info.exists() ? info.size() : -1;
+    return fingerprint;
+}
+
+QHash<QString, WorkspaceLibraryScanner::FileFingerprint>
+WorkspaceLibraryScanner::getFingerprintsFromDb(SQLiteDatabase& db) throw (Exception)
+{
+    QSqlQuery query = db.prepareQuery("SELECT filepath, modified, size FROM element_files");
+    db.exec(query);
+    auto finishGuard = scopeGuard([&query](){query.finish();});
+
+    QHash<QString, FileFingerprint> fingerprints;
+    while (query.next()) {
+        FileFingerprint fingerprint;
+        fingerprint.modified = query.value(1).toLongLong();
+        fingerprint.size = query.value(2).toLongLong();
+        fingerprints.insert(query.value(0).toString(), fingerprint);
+    }
+    return fingerprints;
+}
+
+void WorkspaceLibraryScanner::removeElementsFromDb(SQLiteDatabase& db, const QString& table,
+    const QString& idColumn, bool hasCategories, const QStringList& filepaths) throw (Exception)
+{
+    if (mFullRescan) return; // tables were cleared, nothing to remove
+    if (filepaths.isEmpty()) return;
+
+    QStringList queries;
+    queries << QString("DELETE FROM " % table % "_tr WHERE " % idColumn % " IN "
+                       "(SELECT id FROM " % table % " WHERE filepath = :filepath)");
+    if (hasCategories) {
+        queries << QString("DELETE FROM " % table % "_cat WHERE " % idColumn % " IN "
+                           "(SELECT id FROM " % table % " WHERE filepath = :filepath)");
+    }
+    queries << QString("DELETE FROM " % table % " WHERE filepath = :filepath");
+    queries << QString("DELETE FROM element_files WHERE filepath = :filepath");
+    queries << QString("DELETE FROM search_index WHERE rowid IN "
+                       "(SELECT id FROM search_entries WHERE filepath = :filepath)");
+    queries << QString("DELETE FROM search_entries WHERE filepath = :filepath");
+    QVariantList values;
+    foreach (const QString& filepath, filepaths) {
+        values.append(filepath);
+    }
+    foreach (const QString& string, queries) {
+        QSqlQuery query = db.prepareQuery(string);
+        query.bindValue(":filepath", values);
+        db.execBatch(query);
+    }
+}
+
+int WorkspaceLibraryScanner::removeStaleElementsFromDb(SQLiteDatabase& db,
+    const QString& table, const QString& idColumn, bool hasCategories) throw (Exception)
+{
+    if (mFullRescan) return 0; // tables were cleared, nothing to remove
+
+    QSqlQuery query = db.prepareQuery("SELECT filepath FROM " % table);
+    db.exec(query);
+    QStringList staleFilePaths;
+    const QSet<QString>& scannedFilePaths = mScannedElements[table];
+    while (query.next()) {
+        QString filepath = query.value(0).toString();
+        if (!scannedFilePaths.contains(filepath)) {
+            staleFilePaths.append(filepath);
+        }
+    }
+    query.finish();
+    removeElementsFromDb(db, table, idColumn, hasCategories, staleFilePaths);
+    return staleFilePaths.count();
+}
+
+void WorkspaceLibraryScanner::updateProgress(int processedCount, int totalCount) noexcept
+{
+    int percent = (totalCount > 0) ? ((processedCount * 100) / totalCount) : 100;
+    if (percent != mLastProgressPercent) {
+        mLastProgressPercent = percent;
+        emit progressUpdate(percent);
     }
-    return count;
 }
 
 /*****************************************************************************************
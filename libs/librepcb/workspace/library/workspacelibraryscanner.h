@@ -25,6 +25,8 @@
  ****************************************************************************************/
 #include <QtCore>
 #include <librepcb/common/exceptions.h>
+#include <librepcb/common/fileio/filepath.h>
+#include <librepcb/library/libraryelementmetadata.h>
 
 /*****************************************************************************************
  *  Namespace / Forward Declarations
@@ -45,6 +47,11 @@ class Workspace;
 /**
  * @brief The WorkspaceLibraryScanner class
  *
+ * The scanner runs as a pipeline: The #run() method (executed in this thread) collects
+ * all element directories, then the XML files of all outdated elements are parsed in
+ * parallel on a thread pool (sized to the number of CPU cores). The extracted metadata
+ * is passed back to this thread which is the only one writing into the database.
+ *
  * @warning Be very careful with dependencies to other objects as the #run() method is
  *          executed in a separate thread! Keep the number of dependencies as small as
  *          possible and consider thread synchronization and object lifetimes.
@@ -68,6 +75,18 @@ class WorkspaceLibraryScanner final : public QThread
         WorkspaceLibraryScanner(const WorkspaceLibraryScanner& other) = delete;
         ~WorkspaceLibraryScanner() noexcept;
 
+        // General Methods
+
+        /**
+         * @brief Start scanning all libraries in the worker thread
+         *
+         * @param fullRescan    If false (default), only elements which were added,
+         *                      modified or removed since the last scan are updated in the
+         *                      database. If true, the whole database is cleared and all
+         *                      elements are parsed again.
+         */
+        void startScan(bool fullRescan = false) noexcept;
+
         // Operator Overloadings
         WorkspaceLibraryScanner& operator=(const WorkspaceLibraryScanner& rhs) = delete;
 
@@ -78,6 +97,44 @@ class WorkspaceLibraryScanner final : public QThread
         void progressUpdate(int percent);
         void succeeded(int elementCount);
         void failed(QString errorMsg);
+        void statistics(int skippedCount, int updatedCount, int removedCount);
+
+
+    private: // Types
+
+        /**
+         * @brief Size and modification time of an element's XML file
+         *
+         * Used to detect which elements have changed since the last scan.
+         */
+        struct FileFingerprint {
+            qint64 modified;    ///< last modification time [ms since epoch]
+            qint64 size;        ///< file size [bytes]
+        };
+
+        enum class ElementKind {Category, Element, Device};
+
+        /**
+         * @brief A single library element to be added to the database
+         *
+         * Created by the scanner thread, filled by a worker thread (#ParserTask) and
+         * then written to the database by the scanner thread again.
+         */
+        struct ElementEntry {
+            ElementKind kind;
+            QString table;              ///< e.g. "symbols"
+            QString idColumn;           ///< e.g. "symbol_id"
+            QString shortElementName;   ///< e.g. "sym"
+            QString longElementName;    ///< e.g. "symbol"
+            FilePath filepath;
+            QString relFilePath;        ///< relative to the workspace libraries directory
+            FileFingerprint fingerprint;
+            bool valid;                 ///< false if the element could not be parsed
+            library::LibraryElementMetadata metadata;
+        };
+        typedef QSharedPointer<ElementEntry> ElementEntryPtr;
+
+        class ParserTask;
 
 
     private: // Methods
@@ -85,19 +142,43 @@ class WorkspaceLibraryScanner final : public QThread
         void run() noexcept override;
         void clearAllTables(SQLiteDatabase& db) throw (Exception);
         template <typename ElementType>
-        int addCategoriesToDb(SQLiteDatabase& db, const QList<FilePath>& dirs,
-                              const QString& table, const QString& idColumn) throw (Exception);
-        template <typename ElementType>
-        int addElementsToDb(SQLiteDatabase& db, const QList<FilePath>& dirs,
-                            const QString& table, const QString& idColumn) throw (Exception);
-        int addDevicesToDb(SQLiteDatabase& db, const QList<FilePath>& dirs,
-                           const QString& table, const QString& idColumn) throw (Exception);
+        void collectElements(const QList<FilePath>& dirs, ElementKind kind,
+                             const QString& table, const QString& idColumn,
+                             const QHash<QString, FileFingerprint>& knownFingerprints,
+                             QList<ElementEntryPtr>& outdated) noexcept;
+        void parseAndAddElementsToDb(SQLiteDatabase& db, const QList<ElementEntryPtr>& elements,
+                                     int totalCount) throw (Exception);
+        void addParsedElement(const ElementEntryPtr& element) noexcept;
+        QList<ElementEntryPtr> takeParsedElements() noexcept;
+        void addElementsToDb(SQLiteDatabase& db, const QList<ElementEntryPtr>& elements) throw (Exception);
+        FileFingerprint getFileFingerprint(const FilePath& xmlFilePath) const noexcept;
+        QHash<QString, FileFingerprint> getFingerprintsFromDb(SQLiteDatabase& db) throw (Exception);
+        void removeElementsFromDb(SQLiteDatabase& db, const QString& table,
+                                  const QString& idColumn, bool hasCategories,
+                                  const QStringList& filepaths) throw (Exception);
+        int removeStaleElementsFromDb(SQLiteDatabase& db, const QString& table,
+                                      const QString& idColumn, bool hasCategories) throw (Exception);
+        void updateProgress(int processedCount, int totalCount) noexcept;
 
 
     private: // Data
 
+        static constexpr int sMaxBatchSize = 500; ///< max. elements per database write
+
         Workspace& mWorkspace;
         volatile bool mAbort;
+        bool mFullRescan;
+
+        // Scan state (only accessed from within the scanner thread)
+        QHash<QString, QSet<QString>> mScannedElements; ///< key: table, value: filepaths
+        int mSkippedCount;
+        int mUpdatedCount;
+        int mLastProgressPercent;
+
+        // Parsed elements, handed over from the parser threads to the scanner thread
+        QMutex mParsedElementsMutex;
+        QWaitCondition mParsedElementsAvailable;
+        QList<ElementEntryPtr> mParsedElements;
 };
 
 /*****************************************************************************************
@@ -0,0 +1,165 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2016 The LibrePCB developers
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <librepcb/common/algorithm/airwiresbuilder.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+class AirWiresBuilderTest : public ::testing::Test
+{
+    protected:
+        static qreal getTotalLength(const AirWiresBuilder& builder,
+                                    const QVector<AirWiresBuilder::AirWire>& airwires) {
+            qreal length = 0;
+            foreach (const AirWiresBuilder::AirWire& airwire, airwires) {
+                Point diff = builder.getPoint(airwire.second) - builder.getPoint(airwire.first);
+                length += diff.getLength().toMm();
+            }
+            return length;
+        }
+
+        /**
+         * @brief Calculate the minimum spanning tree length with Prim's algorithm in O(n^2)
+         */
+        static qreal getMinimumTotalLength(const QVector<Point>& points) {
+            QVector<qreal> distances(points.count(), std::numeric_limits<qreal>::infinity());
+            QVector<bool> done(points.count(), false);
+            qreal length = 0;
+            distances[0] = 0;
+            for (int n = 0; n < points.count(); ++n) {
+                int next = -1;
+                for (int i = 0; i < points.count(); ++i) {
+                    if ((!done.at(i)) && ((next < 0) || (distances.at(i) < distances.at(next)))) {
+                        next = i;
+                    }
+                }
+                done[next] = true;
+                length += distances.at(next);
+                for (int i = 0; i < points.count(); ++i) {
+                    qreal dist = (points.at(i) - points.at(next)).getLength().toMm();
+                    if ((!done.at(i)) && (dist < distances.at(i))) distances[i] = dist;
+                }
+            }
+            return length;
+        }
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(AirWiresBuilderTest, testEmpty)
+{
+    AirWiresBuilder builder;
+    EXPECT_TRUE(builder.buildAirWires().isEmpty());
+    builder.addPoint(Point(0, 0));
+    EXPECT_TRUE(builder.buildAirWires().isEmpty());
+}
+
+TEST_F(AirWiresBuilderTest, testSquare)
+{
+    AirWiresBuilder builder;
+    int p0 = builder.addPoint(Point(0, 0));
+    int p1 = builder.addPoint(Point(Length(10000000), 0));
+    int p2 = builder.addPoint(Point(0, Length(10000000)));
+    int p3 = builder.addPoint(Point(Length(10000000), Length(10000000)));
+    QVector<AirWiresBuilder::AirWire> airwires = builder.buildAirWires();
+    EXPECT_EQ(3, airwires.count());
+    EXPECT_NEAR(30.0, getTotalLength(builder, airwires), 0.000001);
+
+    // existing connections reduce the number of air wires
+    builder.addEdge(p0, p3);
+    builder.addEdge(p1, p2);
+    airwires = builder.buildAirWires();
+    ASSERT_EQ(1, airwires.count());
+    EXPECT_NEAR(10.0, getTotalLength(builder, airwires), 0.000001);
+    builder.addEdge(p0, p1);
+    EXPECT_TRUE(builder.buildAirWires().isEmpty());
+}
+
+TEST_F(AirWiresBuilderTest, testCollinearAndDuplicatePoints)
+{
+    AirWiresBuilder builder;
+    for (int i = 9; i >= 0; --i) {
+        builder.addPoint(Point(Length(1000000) * i, Length(500000) * i));
+        builder.addPoint(Point(Length(1000000) * i, Length(500000) * i));
+    }
+    QVector<AirWiresBuilder::AirWire> airwires = builder.buildAirWires();
+    EXPECT_EQ(19, airwires.count());
+    EXPECT_NEAR(9.0 * std::sqrt(1.25), getTotalLength(builder, airwires), 0.0001);
+}
+
+TEST_F(AirWiresBuilderTest, testRandomPointsAreMinimal)
+{
+    qsrand(42);
+    for (int n = 2; n < 200; n += 7) {
+        AirWiresBuilder builder;
+        QVector<Point> points;
+        for (int i = 0; i < n; ++i) {
+            // use a coarse grid to get many collinear and duplicate points
+            points.append(Point(Length(1000000) * (qrand() % 20),
+                                Length(1000000) * (qrand() % 20)));
+            builder.addPoint(points.last());
+        }
+        QVector<AirWiresBuilder::AirWire> airwires = builder.buildAirWires();
+        EXPECT_EQ(n - 1, airwires.count());
+        EXPECT_NEAR(getMinimumTotalLength(points), getTotalLength(builder, airwires), 0.001);
+    }
+}
+
+TEST_F(AirWiresBuilderTest, testPerformance)
+{
+    const int pointCount = 100000;
+    qsrand(42);
+    AirWiresBuilder builder;
+    for (int i = 0; i < pointCount; ++i) {
+        builder.addPoint(Point(Length(1000) * (qrand() % 100000),
+                               Length(1000) * (qrand() % 100000)));
+    }
+    typedef std::chrono::high_resolution_clock Clock;
+    auto start = Clock::now();
+    QVector<AirWiresBuilder::AirWire> airwires = builder.buildAirWires();
+    std::chrono::duration<double> buildTime = Clock::now() - start;
+    EXPECT_EQ(pointCount - 1, airwires.count());
+
+    std::cout << "Needed " << buildTime.count() * 1000 << "ms to build the air wires of "
+              << pointCount << " points\n";
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace librepcb
@@ -0,0 +1,158 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2016 The LibrePCB developers
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <gtest/gtest.h>
+#include <QtCore>
+#include <librepcb/common/cam/excellongenerator.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+class ExcellonGeneratorTest : public ::testing::Test
+{
+    protected:
+
+        /**
+         * @brief Add a 40x40 grid of vias and a few larger holes in a random order
+         */
+        static void addDrills(ExcellonGenerator& gen) noexcept
+        {
+            QList<Point> positions;
+            for (int x = 0; x < 40; ++x) {
+                for (int y = 0; y < 40; ++y) {
+                    positions.append(Point(x * 800000, y * 800000));
+                }
+            }
+            qsrand(42);
+            for (int i = positions.count() - 1; i > 0; --i) {
+                positions.swap(i, qrand() % (i + 1));
+            }
+            foreach (const Point& pos, positions) {
+                gen.drill(pos, Length(300000));
+            }
+            for (int i = 0; i < 10; ++i) {
+                gen.drill(Point((i % 2) * 50000000, i * 3000000), Length(1000000));
+            }
+        }
+
+        static QStringList getDrillLines(const QString& output) noexcept
+        {
+            return output.split('\n').filter(QRegularExpression("^(X|T[0-9]+$)"));
+        }
+
+        static QStringList getSortedDrillLines(const QString& output) noexcept
+        {
+            QStringList lines = getDrillLines(output);
+            lines.sort();
+            return lines;
+        }
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(ExcellonGeneratorTest, testWithoutOptimization)
+{
+    ExcellonGenerator gen;
+    addDrills(gen);
+    gen.generate();
+    EXPECT_GT(gen.getTravelDistanceBeforeOptimization(), 0);
+    EXPECT_EQ(gen.getTravelDistanceBeforeOptimization(), gen.getTravelDistanceAfterOptimization());
+    EXPECT_TRUE(gen.toStr().contains("T1C0.300000\nT2C1.000000\n"));
+}
+
+TEST_F(ExcellonGeneratorTest, testOptimizationKeepsAllDrills)
+{
+    ExcellonGenerator original;
+    addDrills(original);
+    original.generate();
+    ExcellonGenerator optimized;
+    addDrills(optimized);
+    optimized.setDrillPathOptimizationEnabled(true, 20);
+    optimized.generate();
+    EXPECT_EQ(getSortedDrillLines(original.toStr()), getSortedDrillLines(optimized.toStr()));
+    EXPECT_EQ(original.getTravelDistanceBeforeOptimization(),
+              optimized.getTravelDistanceBeforeOptimization());
+
+    // the optimal path through the grid is 40*40*0.8mm long, the random order is ~30x longer
+    qreal after = optimized.getTravelDistanceAfterOptimization();
+    EXPECT_LT(after, optimized.getTravelDistanceBeforeOptimization() / 10);
+    std::cout << "Travel distance: " << optimized.getTravelDistanceBeforeOptimization()
+              << "mm before, " << after << "mm after optimization\n";
+}
+
+TEST_F(ExcellonGeneratorTest, testOptimizationWithoutTwoOpt)
+{
+    ExcellonGenerator gen;
+    addDrills(gen);
+    gen.setDrillPathOptimizationEnabled(true, 0);
+    gen.generate();
+    EXPECT_LE(gen.getTravelDistanceAfterOptimization(), gen.getTravelDistanceBeforeOptimization());
+}
+
+TEST_F(ExcellonGeneratorTest, testOptimizationIsReproducible)
+{
+    ExcellonGenerator first;
+    addDrills(first);
+    first.setDrillPathOptimizationEnabled(true);
+    first.generate();
+    ExcellonGenerator second;
+    addDrills(second);
+    second.setDrillPathOptimizationEnabled(true);
+    second.generate();
+    EXPECT_EQ(getDrillLines(first.toStr()), getDrillLines(second.toStr()));
+    EXPECT_EQ(first.getTravelDistanceAfterOptimization(),
+              second.getTravelDistanceAfterOptimization());
+}
+
+TEST_F(ExcellonGeneratorTest, testOptimizationOfManyDrills)
+{
+    // the full 2-opt over 50k drills took minutes, the windowed one must be fast
+    ExcellonGenerator gen;
+    qsrand(42);
+    for (int i = 0; i < 50000; ++i) {
+        gen.drill(Point((qrand() % 200000) * 1000, (qrand() % 200000) * 1000), Length(300000));
+    }
+    gen.setDrillPathOptimizationEnabled(true);
+    QElapsedTimer timer;
+    timer.start();
+    gen.generate();
+    qint64 elapsed = timer.elapsed();
+    EXPECT_LT(gen.getTravelDistanceAfterOptimization(),
+              gen.getTravelDistanceBeforeOptimization() / 10);
+    EXPECT_LT(elapsed, 10000);
+    std::cout << "Optimized 50000 drills in " << elapsed << "ms\n";
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace librepcb
@@ -0,0 +1,143 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2016 The LibrePCB developers
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <gtest/gtest.h>
+#include <chrono>
+#include <QtCore>
+#include <librepcb/common/cam/gerbergenerator.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+class GerberGeneratorTest : public ::testing::Test
+{
+    protected:
+
+        static void drawTraces(GerberGenerator& gen, int count) noexcept
+        {
+            for (int i = 0; i < count; ++i) {
+                gen.drawLine(Point(i * 1000, 0), Point(i * 1000, 5000000), Length(200000 + (i % 10)));
+            }
+        }
+
+        static QByteArray removeVolatileLines(const QByteArray& data) noexcept
+        {
+            QList<QByteArray> lines = data.split('\n');
+            for (int i = lines.count() - 1; i >= 0; --i) {
+                if (lines.at(i).startsWith("%TF.CreationDate") || lines.at(i).startsWith("%TF.MD5")) {
+                    lines.removeAt(i);
+                }
+            }
+            return lines.join('\n');
+        }
+
+        static bool isMd5Valid(const QByteArray& data) noexcept
+        {
+            int pos = data.indexOf("%TF.MD5,");
+            if (pos < 0) return false;
+            QByteArray content = data.left(pos).replace('\n', QByteArray());
+            QByteArray expected = QCryptographicHash::hash(content, QCryptographicHash::Md5).toHex();
+            return data.mid(pos + 8, 32) == expected;
+        }
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(GerberGeneratorTest, testStreamedOutputEqualsInMemoryOutput)
+{
+    GerberGenerator gen("project", Uuid::createRandom(), "1");
+    drawTraces(gen, 100);
+    gen.generate();
+    QByteArray inMemory = gen.toStr().toUtf8();
+    QBuffer buffer;
+    buffer.open(QIODevice::WriteOnly);
+    gen.generate(buffer);
+    EXPECT_TRUE(isMd5Valid(inMemory));
+    EXPECT_TRUE(isMd5Valid(buffer.data()));
+    EXPECT_EQ(removeVolatileLines(inMemory), removeVolatileLines(buffer.data()));
+    EXPECT_TRUE(buffer.data().endsWith("M02*\n"));
+}
+
+TEST_F(GerberGeneratorTest, testLargeLayer)
+{
+    // the body of this layer is large enough to be spilled to a temporary file
+    GerberGenerator gen("project", Uuid::createRandom(), "1");
+    drawTraces(gen, 200000);
+    QBuffer buffer;
+    buffer.open(QIODevice::WriteOnly);
+    gen.generate(buffer);
+    EXPECT_TRUE(isMd5Valid(buffer.data()));
+    EXPECT_EQ(400000, buffer.data().count("D01*\n") + buffer.data().count("D02*\n"));
+    EXPECT_EQ(10, buffer.data().count("%ADD"));
+}
+
+TEST_F(GerberGeneratorTest, testManyApertures)
+{
+    GerberGenerator gen("project", Uuid::createRandom(), "1");
+    std::chrono::time_point<std::chrono::high_resolution_clock> start, end;
+    start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < 100000; ++i) {
+        Length size(100000 + (i % 500) * 1000);
+        gen.flashRect(Point(i * 1000, 0), size, size, Angle::deg0(), Length(0));
+    }
+    end = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> elapsed_seconds = end-start;
+    std::cout << "Needed " << elapsed_seconds.count() << "s for 100000 flashes\n";
+    gen.generate();
+    QString output = gen.toStr();
+    EXPECT_EQ(500, output.count("%ADD"));
+    EXPECT_TRUE(output.contains("%ADD10R,0.100000X0.100000*%"));
+    EXPECT_TRUE(output.contains("%ADD509R,0.599000X0.599000*%"));
+}
+
+TEST_F(GerberGeneratorTest, testGenerateToFilePerformance)
+{
+    GerberGenerator gen("project", Uuid::createRandom(), "1");
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+    FilePath filepath(QString("%1/layer.gbr").arg(dir.path()));
+
+    std::chrono::time_point<std::chrono::high_resolution_clock> start, end;
+    start = std::chrono::high_resolution_clock::now();
+    drawTraces(gen, 1000000);
+    gen.generateToFile(filepath);
+    end = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> elapsed_seconds = end-start;
+    std::cout << "Needed " << elapsed_seconds.count() << "s to write "
+              << QFileInfo(filepath.toStr()).size() << " bytes\n";
+    EXPECT_TRUE(filepath.isExistingFile());
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace librepcb
@@ -0,0 +1,236 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+
+#include <QtCore>
+#include <gtest/gtest.h>
+#include <chrono>
+#include <limits>
+#include <random>
+#include <librepcb/common/units/length.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Data Type
+ ****************************************************************************************/
+
+typedef struct {
+    QString mm;
+    bool valid;
+    LengthBase_t nm;
+} LengthTestData_t;
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+class LengthTest : public ::testing::TestWithParam<LengthTestData_t>
+{
+    protected:
+        // the implementations which were used before the integer based ones
+        static LengthBase_t legacyMmStringToNm(const QString& mm, bool& ok) {
+            return qRound(QLocale::c().toDouble(mm, &ok) * 1e6);
+        }
+        static QString legacyToMmString(const Length& length) {
+            return QLocale::c().toString(length.toMm(), 'f', 6);
+        }
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_P(LengthTest, testFromMmString)
+{
+    const LengthTestData_t& data = GetParam();
+
+    if (data.valid) {
+        EXPECT_EQ(data.nm, Length::fromMm(data.mm).toNm());
+        QByteArray latin1 = data.mm.toLatin1();
+        EXPECT_EQ(data.nm, Length::fromMm(latin1.constData(), latin1.size()).toNm());
+    } else {
+        EXPECT_THROW(Length::fromMm(data.mm), Exception);
+        QByteArray latin1 = data.mm.toLatin1();
+        EXPECT_THROW(Length::fromMm(latin1.constData(), latin1.size()), Exception);
+    }
+}
+
+TEST_P(LengthTest, testToMmStringRoundTrip)
+{
+    const LengthTestData_t& data = GetParam();
+
+    if (data.valid) {
+        Length length(data.nm);
+        EXPECT_EQ(length, Length::fromMm(length.toMmString()));
+        char buffer[Length::sMaxCharCount];
+        EXPECT_EQ(length, Length::fromMm(buffer, length.toMmChars(buffer)));
+        EXPECT_EQ(QString::number(data.nm), length.toNmString());
+    }
+}
+
+TEST(LengthTest, testToMmString)
+{
+    EXPECT_EQ(QString("0.000000"), Length(0).toMmString());
+    EXPECT_EQ(QString("0.000001"), Length(1).toMmString());
+    EXPECT_EQ(QString("-0.000001"), Length(-1).toMmString());
+    EXPECT_EQ(QString("1.500000"), Length(1500000).toMmString());
+    EXPECT_EQ(QString("-1234.567891"), Length(-1234567891).toMmString());
+#ifndef USE_32BIT_LENGTH_UNITS
+    EXPECT_EQ(QString("9223372036854.775807"),
+              Length(std::numeric_limits<LengthBase_t>::max()).toMmString());
+    EXPECT_EQ(QString("-9223372036854.775808"),
+              Length(std::numeric_limits<LengthBase_t>::min()).toMmString());
+    EXPECT_EQ(QString("-9223372036854775808"),
+              Length(std::numeric_limits<LengthBase_t>::min()).toNmString());
+#endif
+}
+
+TEST(LengthTest, testFuzzAgainstLegacyImplementation)
+{
+    std::mt19937 generator(42);
+    // the legacy parser used qRound() which returns an int, so the range is limited
+    std::uniform_int_distribution<qint32> distribution(-2000000000, 2000000000);
+    // note: no notations with more than six decimals because the legacy parser didn't
+    // round ties exactly, and no values above ~2000mm because of the int overflow
+    const char* formats[] = {"%1", "%1.%2", ".%2", "-%1.%2", "+%1.%2", " %1.%2 ",
+                             "%1.%2E1", "-%1e-6", "%1.%2e+1", "%2e-3"};
+    for (int i = 0; i < 100000; i++) {
+        Length length(distribution(generator));
+        EXPECT_EQ(legacyToMmString(length), length.toMmString());
+
+        // build random strings in different notations and compare the parsed values
+        QString intPart = QString::number(qAbs(distribution(generator)) % 100);
+        QString fracPart = QString::number(qAbs(distribution(generator)) % 1000000);
+        QString format = formats[i % (sizeof(formats) / sizeof(formats[0]))];
+        QString str = format.replace("%1", intPart).replace("%2", fracPart);
+        bool ok = false;
+        LengthBase_t legacy = legacyMmStringToNm(str, ok);
+        ASSERT_TRUE(ok) << qPrintable(str);
+        EXPECT_EQ(legacy, Length::fromMm(str).toNm()) << qPrintable(str);
+    }
+}
+
+TEST(LengthTest, testPerformance)
+{
+    const int count = 1000000;
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<qint32> distribution(-2000000000, 2000000000);
+    QVector<Length> lengths;
+    lengths.reserve(count);
+    for (int i = 0; i < count; i++) {
+        lengths.append(Length(distribution(generator)));
+    }
+
+    typedef std::chrono::high_resolution_clock Clock;
+    auto start = Clock::now();
+    QStringList legacyStrings;
+    legacyStrings.reserve(count);
+    foreach (const Length& length, lengths) {
+        legacyStrings.append(legacyToMmString(length));
+    }
+    std::chrono::duration<double> legacyFormatTime = Clock::now() - start;
+
+    start = Clock::now();
+    QStringList strings;
+    strings.reserve(count);
+    foreach (const Length& length, lengths) {
+        strings.append(length.toMmString());
+    }
+    std::chrono::duration<double> formatTime = Clock::now() - start;
+
+    start = Clock::now();
+    qint64 legacySum = 0;
+    foreach (const QString& str, strings) {
+        bool ok;
+        legacySum += legacyMmStringToNm(str, ok);
+    }
+    std::chrono::duration<double> legacyParseTime = Clock::now() - start;
+
+    start = Clock::now();
+    qint64 sum = 0;
+    foreach (const QString& str, strings) {
+        sum += Length::fromMm(str).toNm();
+    }
+    std::chrono::duration<double> parseTime = Clock::now() - start;
+
+    EXPECT_EQ(legacyStrings, strings);
+    EXPECT_EQ(legacySum, sum);
+    std::cout << "Needed " << formatTime.count() << "s (legacy: " << legacyFormatTime.count()
+              << "s) to format and " << parseTime.count() << "s (legacy: "
+              << legacyParseTime.count() << "s) to parse " << count << " lengths\n";
+}
+
+/*****************************************************************************************
+ *  Test Data
+ ****************************************************************************************/
+
+INSTANTIATE_TEST_CASE_P(LengthTest, LengthTest, ::testing::Values(
+    //               {mm,                       valid, nm}
+    LengthTestData_t({"0",                      true,  0}),
+    LengthTestData_t({"-0.0",                   true,  0}),
+    LengthTestData_t({"1.5",                    true,  1500000}),
+    LengthTestData_t({"-1.5",                   true,  -1500000}),
+    LengthTestData_t({"+.000001",               true,  1}),
+    LengthTestData_t({"2.",                     true,  2000000}),
+    LengthTestData_t({" 12.345678 ",            true,  12345678}),
+    LengthTestData_t({"0.0000005",              true,  1}),  // rounded away from zero
+    LengthTestData_t({"-0.0000005",             true,  -1}), // rounded away from zero
+    LengthTestData_t({"0.00000049999",          true,  0}),
+    LengthTestData_t({"1.5e3",                  true,  1500000000}),
+    LengthTestData_t({"1500E-3",                true,  1500000}),
+    LengthTestData_t({"1e-7",                   true,  0}),
+    LengthTestData_t({"0e99999",                true,  0}),
+    LengthTestData_t({"000000000000000000000000001.0", true, 1000000}),
+#ifndef USE_32BIT_LENGTH_UNITS
+    LengthTestData_t({"9223372036854.775807",   true,  std::numeric_limits<LengthBase_t>::max()}),
+    LengthTestData_t({"-9223372036854.775808",  true,  std::numeric_limits<LengthBase_t>::min()}),
+    LengthTestData_t({"9007199254740.993",      true,  Q_INT64_C(9007199254740993000)}),
+    LengthTestData_t({"9223372036854.775808",   false, 0}), // overflow
+    LengthTestData_t({"-9223372036854.775809",  false, 0}), // overflow
+    LengthTestData_t({"9223372036854.7758075",  false, 0}), // overflow after rounding
+#endif
+    LengthTestData_t({"1e99999",                false, 0}),
+    LengthTestData_t({"",                       false, 0}),
+    LengthTestData_t({" ",                      false, 0}),
+    LengthTestData_t({"-",                      false, 0}),
+    LengthTestData_t({".",                      false, 0}),
+    LengthTestData_t({"1.2.3",                  false, 0}),
+    LengthTestData_t({"1 2",                    false, 0}),
+    LengthTestData_t({"1e",                     false, 0}),
+    LengthTestData_t({"e5",                     false, 0}),
+    LengthTestData_t({"0x10",                   false, 0}),
+    LengthTestData_t({"1,5",                    false, 0}),
+    LengthTestData_t({"nan",                    false, 0}),
+    LengthTestData_t({"inf",                    false, 0})
+));
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace librepcb
@@ -0,0 +1,194 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2016 The LibrePCB developers
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cmath>
+#include <librepcb/common/spatialindex.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+class SpatialIndexTest : public ::testing::Test
+{
+    protected:
+        struct Item {
+            QRectF rect;
+        };
+        typedef SpatialIndex<Item> Index;
+
+        static QRectF getRect(const Item& item) noexcept {return item.rect;}
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(SpatialIndexTest, testGetItemsAt)
+{
+    Item a{QRectF(0, 0, 10, 10)};
+    Item b{QRectF(5, 5, 10, 10)};
+    Item c{QRectF(-500, -500, 1000, 1000)}; // covers many cells
+    Index index(3, &getRect);
+    index.insert(&c);
+    index.insert(&a);
+    index.insert(&b);
+    EXPECT_EQ(3, index.count());
+    EXPECT_EQ(QList<Item*>({&c, &a}), index.getItemsAt(QPointF(1, 1)));
+    EXPECT_EQ(QList<Item*>({&c, &a, &b}), index.getItemsAt(QPointF(7, 7)));
+    EXPECT_EQ(QList<Item*>({&c, &b}), index.getItemsAt(QPointF(14, 14)));
+    EXPECT_EQ(QList<Item*>({&c}), index.getItemsAt(QPointF(-100, 100)));
+    EXPECT_EQ(QList<Item*>(), index.getItemsAt(QPointF(1000, 1000)));
+}
+
+TEST_F(SpatialIndexTest, testInvalidate)
+{
+    Item a{QRectF(0, 0, 10, 10)};
+    Index index(3, &getRect);
+    index.insert(&a);
+    EXPECT_EQ(QList<Item*>({&a}), index.getItemsAt(QPointF(1, 1)));
+    a.rect.translate(100, 100);
+    index.invalidate(&a);
+    EXPECT_EQ(QList<Item*>(), index.getItemsAt(QPointF(1, 1)));
+    EXPECT_EQ(QList<Item*>({&a}), index.getItemsAt(QPointF(101, 101)));
+    a.rect = QRectF(-1000, -1000, 2000, 2000);
+    index.invalidate(&a);
+    EXPECT_EQ(QList<Item*>({&a}), index.getItemsAt(QPointF(1, 1)));
+}
+
+TEST_F(SpatialIndexTest, testRemove)
+{
+    Item a{QRectF(0, 0, 10, 10)};
+    Item b{QRectF(-1000, -1000, 2000, 2000)};
+    Index index(3, &getRect);
+    index.insert(&a);
+    index.insert(&b);
+    index.invalidate(&a); // removing dirty items must work too
+    index.remove(&a);
+    EXPECT_FALSE(index.contains(&a));
+    EXPECT_EQ(QList<Item*>({&b}), index.getItemsAt(QPointF(1, 1)));
+    index.remove(&b);
+    index.invalidate(&b); // must be ignored
+    EXPECT_EQ(0, index.count());
+    EXPECT_EQ(QList<Item*>(), index.getItemsAt(QPointF(1, 1)));
+}
+
+TEST_F(SpatialIndexTest, testNullRect)
+{
+    Item a{QRectF(5, 5, 0, 0)};
+    Item b{QRectF(0, 0, 10, 10)};
+    Index index(3, &getRect);
+    index.insert(&a);
+    index.insert(&b);
+    EXPECT_EQ(2, index.count());
+    EXPECT_EQ(QList<Item*>({&b}), index.getItemsAt(QPointF(5, 5)));
+    a.rect = QRectF(4, 4, 2, 2);
+    index.invalidate(&a);
+    EXPECT_EQ(QList<Item*>({&a, &b}), index.getItemsAt(QPointF(5, 5)));
+    a.rect = QRectF();
+    index.invalidate(&a);
+    EXPECT_EQ(QList<Item*>({&b}), index.getItemsAt(QPointF(5, 5)));
+    index.remove(&a);
+    EXPECT_EQ(1, index.count());
+}
+
+TEST_F(SpatialIndexTest, testPerformance)
+{
+    // 20'000 items on a 200x100 grid, each 2x2 units large
+    QVector<Item> items(20000);
+    Index index(5, &getRect);
+    for (int i = 0; i < items.count(); ++i) {
+        items[i].rect = QRectF((i % 200) * 3, (i / 200) * 3, 2, 2);
+        index.insert(&items[i]);
+    }
+    EXPECT_EQ(1, index.getItemsAt(QPointF(1, 1)).count()); // builds the index
+
+    std::chrono::time_point<std::chrono::high_resolution_clock> start, end;
+    int hits = 0;
+    start = std::chrono::high_resolution_clock::now();
+    for (int n = 0; n < 100000; ++n) {
+        hits += index.getItemsAt(QPointF((n % 600) + 0.5, (n % 300) + 0.5)).count();
+    }
+    end = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> elapsed_seconds = end-start;
+    std::cout << "Needed " << elapsed_seconds.count() << "s for 100000 queries ("
+              << hits << " hits)\n";
+}
+
+TEST_F(SpatialIndexTest, testQueryLatencyVsItemCount)
+{
+    typedef std::chrono::high_resolution_clock Clock;
+    const int queryCount = 1000;
+    const int maxLinearItemCount = 1000; // keeps the brute force cross-check fast
+    for (int itemCount : {1000, 10000, 50000}) {
+        // items of 2x2 units on a grid with a pitch of 3 units, 200 items per row
+        QVector<Item> items(itemCount);
+        Index index(5, &getRect);
+        for (int i = 0; i < items.count(); ++i) {
+            items[i].rect = QRectF((i % 200) * 3, (i / 200) * 3, 2, 2);
+            index.insert(&items[i]);
+        }
+        index.getItemsAt(QPointF(0, 0)); // build the index
+        qreal height = (itemCount / 200) * 3;
+
+        // query the index
+        int indexHits = 0;
+        auto start = Clock::now();
+        for (int n = 0; n < queryCount; ++n) {
+            QPointF pos((n * 7) % 600 + 0.5, std::fmod(n * 0.37, height) + 0.5);
+            indexHits += index.getItemsAt(pos).count();
+        }
+        std::chrono::duration<double> indexTime = Clock::now() - start;
+        std::cout << itemCount << " items: "
+                  << (indexTime.count() * 1e6 / queryCount) << "us per query (index)";
+
+        // compare with a linear search over all items
+        if (itemCount <= maxLinearItemCount) {
+            int linearHits = 0;
+            start = Clock::now();
+            for (int n = 0; n < queryCount; ++n) {
+                QPointF pos((n * 7) % 600 + 0.5, std::fmod(n * 0.37, height) + 0.5);
+                foreach (const Item& item, items) {
+                    if (item.rect.contains(pos)) ++linearHits;
+                }
+            }
+            std::chrono::duration<double> linearTime = Clock::now() - start;
+            EXPECT_EQ(linearHits, indexHits);
+            std::cout << ", " << (linearTime.count() * 1e6 / queryCount)
+                      << "us per query (linear)";
+        }
+        std::cout << "\n";
+    }
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace librepcb
@@ -0,0 +1,228 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2016 The LibrePCB developers
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/common/undostack.h>
+#include <librepcb/common/undocommand.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Command
+ ****************************************************************************************/
+
+/**
+ * @brief Sets an integer to a new value, edits of the same integer can be merged
+ */
+class SetValueCmd final : public UndoCommand
+{
+    public:
+        SetValueCmd(int& value, int newValue, qint64 memoryUsage = 100) noexcept :
+            UndoCommand("set value"), mValue(value), mOldValue(value),
+            mNewValue(newValue), mMemoryUsage(memoryUsage) {}
+
+        qint64 getApproxMemoryUsage() const noexcept override {return mMemoryUsage;}
+
+        bool mergeWith(const UndoCommand& other) noexcept override
+        {
+            const SetValueCmd* cmd = dynamic_cast<const SetValueCmd*>(&other);
+            if ((!cmd) || (&cmd->mValue != &mValue)) return false;
+            mNewValue = cmd->mNewValue;
+            mMemoryUsage += cmd->mMemoryUsage; // simulate a command which grows by merging
+            return true;
+        }
+
+    private:
+        bool performExecute() throw (Exception) override {performRedo(); return true;}
+        void performUndo() throw (Exception) override {mValue = mOldValue;}
+        void performRedo() throw (Exception) override {mValue = mNewValue;}
+
+        int& mValue;
+        int mOldValue;
+        int mNewValue;
+        qint64 mMemoryUsage;
+};
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+class UndoStackTest : public ::testing::Test
+{
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST(UndoStackTest, testMergeConsecutiveCommands)
+{
+    int a = 0, b = 0;
+    UndoStack stack;
+    stack.execCmd(new SetValueCmd(a, 1));
+    stack.execCmd(new SetValueCmd(a, 2));
+    stack.execCmd(new SetValueCmd(a, 3));
+    EXPECT_EQ(1, stack.getCommandCount());
+    stack.execCmd(new SetValueCmd(b, 1));
+    EXPECT_EQ(2, stack.getCommandCount());
+    EXPECT_EQ(3, a);
+
+    // undo must revert all merged commands at once
+    stack.undo();
+    stack.undo();
+    EXPECT_EQ(0, a);
+    EXPECT_EQ(0, b);
+    EXPECT_FALSE(stack.canUndo());
+    stack.redo();
+    EXPECT_EQ(3, a);
+}
+
+TEST(UndoStackTest, testNoMergeIntoCleanState)
+{
+    int a = 0;
+    UndoStack stack;
+    stack.execCmd(new SetValueCmd(a, 1));
+    stack.setClean();
+    stack.execCmd(new SetValueCmd(a, 2));
+    EXPECT_EQ(2, stack.getCommandCount());
+    EXPECT_FALSE(stack.isClean());
+    stack.undo();
+    EXPECT_TRUE(stack.isClean());
+    EXPECT_EQ(1, a);
+}
+
+TEST(UndoStackTest, testUndoLimit)
+{
+    int values[10] = {};
+    UndoStack stack;
+    stack.setUndoLimit(3);
+    stack.setClean();
+    for (int i = 0; i < 10; ++i) {
+        stack.execCmd(new SetValueCmd(values[i], i + 1));
+    }
+    EXPECT_EQ(3, stack.getCommandCount());
+    while (stack.canUndo()) stack.undo();
+    EXPECT_EQ(7, values[6]); // evicted commands can no longer be undone
+    EXPECT_EQ(0, values[7]);
+    EXPECT_FALSE(stack.isClean()); // the clean state was evicted
+}
+
+TEST(UndoStackTest, testCleanIndexAfterEviction)
+{
+    int values[5] = {};
+    UndoStack stack;
+    stack.setUndoLimit(3);
+    for (int i = 0; i < 3; ++i) {
+        stack.execCmd(new SetValueCmd(values[i], i + 1));
+    }
+    stack.setClean();
+    stack.execCmd(new SetValueCmd(values[3], 4));
+    stack.execCmd(new SetValueCmd(values[4], 5));
+    EXPECT_EQ(3, stack.getCommandCount());
+    EXPECT_FALSE(stack.isClean());
+    stack.undo();
+    stack.undo();
+    EXPECT_TRUE(stack.isClean());
+    EXPECT_EQ(3, values[2]);
+}
+
+TEST(UndoStackTest, testMemoryLimit)
+{
+    int values[10] = {};
+    UndoStack stack;
+    stack.setMemoryLimit(1000);
+    for (int i = 0; i < 10; ++i) {
+        stack.execCmd(new SetValueCmd(values[i], i + 1, 300));
+    }
+    EXPECT_EQ(3, stack.getCommandCount());
+    EXPECT_EQ(900, stack.getApproxMemoryUsage());
+
+    // the newest command is kept even if it exceeds the limit
+    stack.execCmd(new SetValueCmd(values[0], 0, 5000));
+    EXPECT_EQ(1, stack.getCommandCount());
+    EXPECT_EQ(5000, stack.getApproxMemoryUsage());
+    EXPECT_TRUE(stack.canUndo());
+}
+
+TEST(UndoStackTest, testMemoryUsageIsKeptUpToDate)
+{
+    int values[3] = {};
+    UndoStack stack;
+    stack.execCmd(new SetValueCmd(values[0], 1, 100));
+    stack.execCmd(new SetValueCmd(values[1], 1, 200));
+    EXPECT_EQ(300, stack.getApproxMemoryUsage());
+
+    // merged commands
+    stack.execCmd(new SetValueCmd(values[1], 2, 50));
+    EXPECT_EQ(2, stack.getCommandCount());
+    EXPECT_EQ(350, stack.getApproxMemoryUsage());
+
+    // command groups (committed and aborted)
+    stack.beginCmdGroup("group");
+    stack.appendToCmdGroup(new SetValueCmd(values[2], 1, 1000));
+    stack.appendToCmdGroup(new SetValueCmd(values[2], 2, 1000));
+    stack.commitCmdGroup();
+    qint64 usageWithGroup = stack.getApproxMemoryUsage();
+    EXPECT_GE(usageWithGroup, 2350);
+    stack.beginCmdGroup("aborted group");
+    stack.appendToCmdGroup(new SetValueCmd(values[2], 3, 1000));
+    stack.abortCmdGroup();
+    EXPECT_EQ(usageWithGroup, stack.getApproxMemoryUsage());
+
+    // discarded redo commands
+    stack.undo();
+    stack.undo();
+    EXPECT_EQ(usageWithGroup, stack.getApproxMemoryUsage());
+    stack.execCmd(new SetValueCmd(values[0], 5, 10));
+    EXPECT_EQ(110, stack.getApproxMemoryUsage());
+
+    stack.clear();
+    EXPECT_EQ(0, stack.getApproxMemoryUsage());
+}
+
+TEST(UndoStackTest, testLimitsIgnoreRedoCommands)
+{
+    int values[5] = {};
+    UndoStack stack;
+    for (int i = 0; i < 5; ++i) {
+        stack.execCmd(new SetValueCmd(values[i], i + 1));
+    }
+    stack.undo();
+    stack.undo();
+    stack.setUndoLimit(2);
+    EXPECT_EQ(3, stack.getCommandCount()); // the last undoable and both redoable ones
+    EXPECT_EQ(3, values[2]);
+    stack.redo();
+    stack.redo();
+    EXPECT_EQ(5, values[4]);
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace librepcb
@@ -23,6 +23,7 @@
 
 #include <QtCore>
 #include <gtest/gtest.h>
+#include <chrono>
 #include <librepcb/common/uuid.h>
 
 /*****************************************************************************************
@@ -217,6 +218,79 @@ TEST(UuidTest, testCreateRandom)
     }
 }
 
+TEST(UuidTest, testToStrAndSetUuidRoundTrip)
+{
+    for (int i = 0; i < 1000; i++) {
+        Uuid uuid = Uuid::createRandom();
+        Uuid copy(uuid.toStr());
+        EXPECT_EQ(uuid, copy);
+        EXPECT_EQ(QUuid(uuid.toStr()), QUuid(copy.toStr()));
+    }
+}
+
+TEST(UuidTest, testConstexprComparisons)
+{
+    constexpr Uuid null1;
+    constexpr Uuid null2;
+    static_assert(null1.isNull(), "default constructed Uuid must be NULL");
+    static_assert(!(null1 == null2), "NULL UUIDs must never be equal");
+    static_assert(null1 != null2, "NULL UUIDs must always be unequal");
+    static_assert(!(null1 < null2), "NULL UUIDs must not be ordered");
+    EXPECT_TRUE(null1.isNull());
+}
+
+TEST(UuidTest, testPerformance)
+{
+    const int count = 100000;
+    QStringList strings;
+    for (int i = 0; i < count; i++) {
+        strings.append(Uuid::createRandom().toStr());
+    }
+
+    typedef std::chrono::high_resolution_clock Clock;
+    auto start = Clock::now();
+    QVector<Uuid> uuids;
+    uuids.reserve(count);
+    foreach (const QString& str, strings) {
+        uuids.append(Uuid(str));
+    }
+    std::chrono::duration<double> parseTime = Clock::now() - start;
+
+    start = Clock::now();
+    int equal = 0;
+    for (int i = 0; i < count; i++) {
+        if (uuids.at(i) == uuids.at((i * 7919) % count)) ++equal;
+        if (uuids.at(i) < uuids.at((i + 1) % count)) ++equal;
+    }
+    std::chrono::duration<double> compareTime = Clock::now() - start;
+
+    start = Clock::now();
+    QHash<Uuid, int> hash;
+    hash.reserve(count);
+    for (int i = 0; i < count; i++) {
+        hash.insert(uuids.at(i), i);
+    }
+    int found = 0;
+    foreach (const Uuid& uuid, uuids) {
+        if (hash.contains(uuid)) ++found;
+    }
+    std::chrono::duration<double> hashTime = Clock::now() - start;
+
+    start = Clock::now();
+    int length = 0;
+    foreach (const Uuid& uuid, uuids) {
+        length += uuid.toStr().length();
+    }
+    std::chrono::duration<double> formatTime = Clock::now() - start;
+
+    EXPECT_GE(equal, 1);
+    EXPECT_EQ(count, found);
+    EXPECT_EQ(count * 36, length);
+    std::cout << "Needed " << parseTime.count() << "s to parse, " << compareTime.count()
+              << "s to compare, " << hashTime.count() << "s to hash and "
+              << formatTime.count() << "s to format " << count << " UUIDs\n";
+}
+
 /*****************************************************************************************
  *  Test Data
  ****************************************************************************************/
@@ -0,0 +1,177 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2016 The LibrePCB developers
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <gtest/gtest.h>
+#include <chrono>
+#include <QtCore>
+#include <librepcb/common/fileio/xmldomdocument.h>
+#include <librepcb/common/fileio/xmldomelement.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+class XmlDomDocumentTest : public ::testing::Test
+{
+    protected:
+
+        static XmlDomElement* createBoardLikeTree(int netLineCount) noexcept
+        {
+            XmlDomElement* root = new XmlDomElement("board");
+            root->setAttribute<QString>("version", "0.1");
+            XmlDomElement* netlines = root->appendChild("netlines");
+            for (int i = 0; i < netLineCount; ++i) {
+                XmlDomElement* netline = netlines->appendChild("netline");
+                netline->setAttribute("uuid", QString("c3fd4ab5-d2a0-4e5b-9d7e-%1").arg(i, 12, 10, QChar('0')));
+                netline->setAttribute("width", QString::number(i % 7 * 0.1));
+            }
+            return root;
+        }
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(XmlDomDocumentTest, testParse)
+{
+    QByteArray xml =
+        "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\"?>\n"
+        "<!-- comment -->\n"
+        "<root a=\"1\" b=\"&lt;&amp;&quot;\">\n"
+        " <child>\n"
+        "  <text>Some Text</text>\n"
+        "  <cdata><![CDATA[<raw>]]></cdata>\n"
+        "  <empty/>\n"
+        " </child>\n"
+        "</root>\n";
+    XmlDomDocument doc(xml, FilePath());
+    XmlDomElement& root = doc.getRoot("root");
+    EXPECT_EQ(QString("1"), root.getAttribute<QString>("a", true));
+    EXPECT_EQ(QString("<&\""), root.getAttribute<QString>("b", true));
+    XmlDomElement* child = root.getFirstChild("child", true);
+    EXPECT_TRUE(child->hasChilds());
+    EXPECT_EQ(QString("Some Text"), child->getFirstChild("text", true)->getText<QString>(true));
+    EXPECT_EQ(QString("<raw>"), child->getFirstChild("cdata", true)->getText<QString>(true));
+    EXPECT_FALSE(child->getFirstChild("empty", true)->hasChilds());
+    EXPECT_EQ(QString(), child->getFirstChild("empty", true)->getText<QString>(false));
+}
+
+TEST_F(XmlDomDocumentTest, testParseErrors)
+{
+    EXPECT_THROW(XmlDomDocument("", FilePath()), Exception);
+    EXPECT_THROW(XmlDomDocument("<root><child></root>", FilePath()), Exception);
+    EXPECT_THROW(XmlDomDocument("<root/><second/>", FilePath()), Exception);
+}
+
+TEST_F(XmlDomDocumentTest, testSaveAndReload)
+{
+    XmlDomElement* root = new XmlDomElement("root");
+    root->setAttribute<QString>("attr", "a \"quoted\" <value>\nwith newline");
+    root->appendTextChild<QString>("text", " leading and trailing spaces ");
+    root->appendChild("empty");
+    XmlDomDocument doc(*root);
+    QByteArray xml = doc.toByteArray();
+    EXPECT_TRUE(xml.startsWith("<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\"?>\n"));
+
+    XmlDomDocument loaded(xml, FilePath());
+    XmlDomElement& loadedRoot = loaded.getRoot("root");
+    EXPECT_EQ(root->getAttribute<QString>("attr", true),
+              loadedRoot.getAttribute<QString>("attr", true));
+    EXPECT_EQ(QString(" leading and trailing spaces "),
+              loadedRoot.getFirstChild("text", true)->getText<QString>(true));
+    EXPECT_NE(nullptr, loadedRoot.getFirstChild("empty", true));
+    EXPECT_EQ(xml, loaded.toByteArray());
+}
+
+TEST_F(XmlDomDocumentTest, testWhitespaceOnlyText)
+{
+    XmlDomElement* root = new XmlDomElement("root");
+    root->appendTextChild<QString>("space", " ");
+    root->appendTextChild<QString>("newline", "\n");
+    root->appendChild("parent")->appendTextChild<QString>("text", "value");
+    XmlDomDocument doc(*root);
+    QByteArray xml = doc.toByteArray();
+
+    XmlDomDocument loaded(xml, FilePath());
+    XmlDomElement& loadedRoot = loaded.getRoot("root");
+    EXPECT_EQ(QString(" "), loadedRoot.getFirstChild("space", true)->getText<QString>(false));
+    EXPECT_EQ(QString("\n"), loadedRoot.getFirstChild("newline", true)->getText<QString>(false));
+    XmlDomElement* parent = loadedRoot.getFirstChild("parent", true);
+    EXPECT_TRUE(parent->hasChilds());
+    EXPECT_EQ(QString("value"), parent->getFirstChild("text", true)->getText<QString>(true));
+    EXPECT_EQ(xml, loaded.toByteArray());
+}
+
+TEST_F(XmlDomDocumentTest, testAttributesKeepInsertionOrder)
+{
+    XmlDomElement* root = new XmlDomElement("root");
+    root->setAttribute<QString>("z", "1");
+    root->setAttribute<QString>("a", "2");
+    root->setAttribute<QString>("m", "3");
+    root->setAttribute<QString>("a", "4"); // overwrite keeps the position
+    XmlDomDocument doc(*root);
+    EXPECT_TRUE(doc.toByteArray().contains("<root z=\"1\" a=\"4\" m=\"3\"/>"));
+    EXPECT_TRUE(root->hasAttribute("m"));
+    EXPECT_FALSE(root->hasAttribute("b"));
+    EXPECT_EQ(QString("4"), root->getAttribute<QString>("a", true));
+    EXPECT_THROW(root->getAttribute<QString>("b", false), Exception);
+}
+
+TEST_F(XmlDomDocumentTest, testLargeDocumentPerformance)
+{
+    const int netLineCount = 100000;
+    XmlDomDocument doc(*createBoardLikeTree(netLineCount));
+
+    typedef std::chrono::high_resolution_clock Clock;
+    auto start = Clock::now();
+    QByteArray xml = doc.toByteArray();
+    std::chrono::duration<double> writeTime = Clock::now() - start;
+
+    start = Clock::now();
+    QScopedPointer<XmlDomDocument> loaded(new XmlDomDocument(xml, FilePath()));
+    std::chrono::duration<double> readTime = Clock::now() - start;
+
+    XmlDomElement* netlines = loaded->getRoot("board").getFirstChild("netlines", true);
+    EXPECT_EQ(netLineCount, netlines->getChildCount());
+
+    start = Clock::now();
+    loaded.reset();
+    std::chrono::duration<double> destroyTime = Clock::now() - start;
+
+    std::cout << "Needed " << writeTime.count() << "s to write, " << readTime.count()
+              << "s to read and " << destroyTime.count() << "s to destroy a document with "
+              << netLineCount << " elements (" << xml.size() / 1024 << "kB)\n";
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace librepcb
@@ -0,0 +1,450 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cmath>
+#include <librepcb/common/boardlayer.h>
+#include <librepcb/common/graphics/graphicsscene.h>
+#include <librepcb/project/project.h>
+#include <librepcb/project/circuit/circuit.h>
+#include <librepcb/project/circuit/netclass.h>
+#include <librepcb/project/circuit/netsignal.h>
+#include <librepcb/project/boards/board.h>
+#include <librepcb/project/boards/boardlayerstack.h>
+#include <librepcb/project/boards/boardgerberexport.h>
+#include <librepcb/project/boards/items/bi_netpoint.h>
+#include <librepcb/project/boards/items/bi_netline.h>
+#include <librepcb/project/boards/items/bi_via.h>
+#include <librepcb/project/boards/items/bi_airwire.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace project {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+class BoardTest : public ::testing::Test
+{
+    protected:
+        FilePath mProjectDir;
+        FilePath mProjectFile;
+
+        BoardTest() {
+            mProjectDir = FilePath::getRandomTempPath().getPathTo("test project dir");
+            mProjectFile = mProjectDir.getPathTo("test project.lpp");
+        }
+
+        virtual ~BoardTest() {
+            QDir(mProjectDir.getParentDir().toStr()).removeRecursively();
+        }
+
+        /**
+         * @brief Create a project with a board containing a long chain of traces and
+         *        optionally some vias (placed in a random order)
+         */
+        void createProjectWithLargeBoard(int netLineCount, int viaCount = 0) {
+            QScopedPointer<Project> project(Project::create(mProjectFile));
+            Circuit& circuit = project->getCircuit();
+            NetClass* netclass = new NetClass(circuit, "default");
+            circuit.addNetClass(*netclass);
+            NetSignal* netsignal = new NetSignal(circuit, *netclass, "GND", false);
+            circuit.addNetSignal(*netsignal);
+            Board* board = project->createBoard("large board");
+            project->addBoard(*board);
+            BoardLayer* layer = board->getLayerStack().getBoardLayer(BoardLayer::TopCopper);
+            ASSERT_TRUE(layer);
+            BI_NetPoint* start = new BI_NetPoint(*board, *layer, *netsignal, Point(0, 0));
+            board->addNetPoint(*start);
+            for (int i = 1; i <= netLineCount; ++i) {
+                Point pos(Length(254000) * (i % 1000), Length(254000) * (i / 1000));
+                BI_NetPoint* end = new BI_NetPoint(*board, *layer, *netsignal, pos);
+                board->addNetPoint(*end);
+                board->addNetLine(*new BI_NetLine(*board, *start, *end, Length(200000)));
+                start = end;
+            }
+            qsrand(42);
+            for (int i = 0; i < viaCount; ++i) {
+                Point pos(Length(127000) * (qrand() % 2000), Length(127000) * (qrand() % 2000));
+                board->addVia(*new BI_Via(*board, pos, BI_Via::Shape::Round, Length(700000),
+                                          Length(300000) + Length(100000) * (i % 3), netsignal));
+            }
+            project->save(true);
+        }
+
+        /**
+         * @brief Get the air wires of a net signal
+         */
+        static QList<BI_AirWire*> getAirWires(const Board& board, const NetSignal& netsignal) {
+            QList<BI_AirWire*> airwires;
+            foreach (BI_AirWire* airwire, board.getAirWires()) {
+                if (airwire->getNetSignal() == &netsignal) airwires.append(airwire);
+            }
+            return airwires;
+        }
+
+        /**
+         * @brief Get the total length of air wires in millimeters
+         */
+        static qreal getTotalLength(const QList<BI_AirWire*>& airwires) {
+            qreal length = 0;
+            foreach (const BI_AirWire* airwire, airwires) {
+                length += airwire->getLength().toMm();
+            }
+            return length;
+        }
+
+        /**
+         * @brief Read all files of a directory, without lines containing the current time
+         */
+        static QMap<QString, QByteArray> readOutputFiles(const FilePath& dir) {
+            QMap<QString, QByteArray> files;
+            foreach (const QFileInfo& info, QDir(dir.toStr()).entryInfoList(QDir::Files)) {
+                QFile file(info.absoluteFilePath());
+                file.open(QIODevice::ReadOnly);
+                QList<QByteArray> lines = file.readAll().split('\n');
+                for (int i = lines.count() - 1; i >= 0; --i) {
+                    if (lines.at(i).contains("Date") || lines.at(i).startsWith("%TF.MD5")) {
+                        lines.removeAt(i);
+                    }
+                }
+                files.insert(info.fileName(), lines.join('\n'));
+            }
+            return files;
+        }
+
+        /**
+         * @brief Get the resident set size of this process in kB (-1 if not available)
+         */
+        static qint64 getResidentSetSize() {
+            QFile file("/proc/self/status");
+            if (!file.open(QIODevice::ReadOnly)) return -1;
+            foreach (const QByteArray& line, file.readAll().split('\n')) {
+                if (line.startsWith("VmRSS:")) {
+                    return line.mid(6).trimmed().split(' ').first().toLongLong();
+                }
+            }
+            return -1;
+        }
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(BoardTest, testLoadAndCopyLargeBoard)
+{
+    const int netLineCount = 50000;
+    createProjectWithLargeBoard(netLineCount, 100);
+
+    typedef std::chrono::high_resolution_clock Clock;
+    auto start = Clock::now();
+    QScopedPointer<Project> project(new Project(mProjectFile, true));
+    std::chrono::duration<double> loadTime = Clock::now() - start;
+    ASSERT_EQ(1, project->getBoards().count());
+    Board& board = *project->getBoards().first();
+    EXPECT_EQ(netLineCount, board.getNetLines().count());
+
+    start = Clock::now();
+    QScopedPointer<Board> copy(project->createBoard(board, "copy"));
+    std::chrono::duration<double> copyTime = Clock::now() - start;
+    EXPECT_EQ(netLineCount, copy->getNetLines().count());
+    foreach (const BI_NetLine* netline, copy->getNetLines()) {
+        EXPECT_EQ(netline, copy->getNetLineByUuid(netline->getUuid()));
+    }
+
+    std::cout << "Needed " << loadTime.count() << "s to load and " << copyTime.count()
+              << "s to copy a board with " << netLineCount << " netlines\n";
+}
+
+TEST_F(BoardTest, testParallelGerberExport)
+{
+    const int netLineCount = 20000;
+    const int viaCount = 2000;
+    createProjectWithLargeBoard(netLineCount, viaCount);
+    QScopedPointer<Project> project(new Project(mProjectFile, true));
+    ASSERT_EQ(1, project->getBoards().count());
+    const Board& board = *project->getBoards().first();
+    ASSERT_EQ(viaCount, board.getVias().count());
+
+    typedef std::chrono::high_resolution_clock Clock;
+    FilePath sequentialDir = mProjectDir.getPathTo("output/sequential");
+    auto start = Clock::now();
+    BoardGerberExport(board, sequentialDir).exportAllLayers(1);
+    std::chrono::duration<double> sequentialTime = Clock::now() - start;
+
+    FilePath parallelDir = mProjectDir.getPathTo("output/parallel");
+    start = Clock::now();
+    BoardGerberExport(board, parallelDir).exportAllLayers();
+    std::chrono::duration<double> parallelTime = Clock::now() - start;
+
+    QMap<QString, QByteArray> sequentialFiles = readOutputFiles(sequentialDir);
+    EXPECT_EQ(8, sequentialFiles.count());
+    QString drillFile = FilePath::cleanFileName(project->getName(),
+        FilePath::ReplaceSpaces | FilePath::KeepCase) % "_DRILLS-PTH.drl";
+    ASSERT_TRUE(sequentialFiles.contains(drillFile));
+    EXPECT_EQ(viaCount, sequentialFiles.value(drillFile).count("\nX"));
+    EXPECT_EQ(sequentialFiles, readOutputFiles(parallelDir));
+
+    // the optimized drill order must not depend on the timing of the jobs either
+    FilePath optimizedSequentialDir = mProjectDir.getPathTo("output/optimized_sequential");
+    BoardGerberExport optimizedSequential(board, optimizedSequentialDir);
+    optimizedSequential.setDrillPathOptimizationEnabled(true);
+    optimizedSequential.exportAllLayers(1);
+    FilePath optimizedParallelDir = mProjectDir.getPathTo("output/optimized_parallel");
+    BoardGerberExport optimizedParallel(board, optimizedParallelDir);
+    optimizedParallel.setDrillPathOptimizationEnabled(true);
+    optimizedParallel.exportAllLayers();
+    QMap<QString, QByteArray> optimizedFiles = readOutputFiles(optimizedSequentialDir);
+    EXPECT_NE(sequentialFiles.value(drillFile), optimizedFiles.value(drillFile));
+    EXPECT_EQ(optimizedFiles, readOutputFiles(optimizedParallelDir));
+
+    std::cout << "Needed " << sequentialTime.count() << "s for sequential and "
+              << parallelTime.count() << "s for parallel export of a board with "
+              << netLineCount << " netlines\n";
+}
+
+TEST_F(BoardTest, testLoadModelOnly)
+{
+    const int netLineCount = 50000;
+    createProjectWithLargeBoard(netLineCount, 100);
+
+    typedef std::chrono::high_resolution_clock Clock;
+    qint64 rss = getResidentSetSize();
+    auto start = Clock::now();
+    QScopedPointer<Project> modelOnly(new Project(mProjectFile, true, true));
+    std::chrono::duration<double> modelOnlyTime = Clock::now() - start;
+    qint64 modelOnlyRss = getResidentSetSize() - rss;
+    EXPECT_TRUE(modelOnly->isModelOnly());
+    ASSERT_EQ(1, modelOnly->getBoards().count());
+    Board& modelOnlyBoard = *modelOnly->getBoards().first();
+    EXPECT_FALSE(modelOnlyBoard.hasGraphicsItems());
+    EXPECT_EQ(netLineCount, modelOnlyBoard.getNetLines().count());
+    EXPECT_TRUE(modelOnlyBoard.getGraphicsScene().items().isEmpty());
+    EXPECT_TRUE(modelOnlyBoard.getAirWires().isEmpty());
+
+    rss = getResidentSetSize();
+    start = Clock::now();
+    QScopedPointer<Project> full(new Project(mProjectFile, true));
+    std::chrono::duration<double> fullTime = Clock::now() - start;
+    qint64 fullRss = getResidentSetSize() - rss;
+    EXPECT_FALSE(full->isModelOnly());
+    ASSERT_EQ(1, full->getBoards().count());
+    Board& fullBoard = *full->getBoards().first();
+    EXPECT_TRUE(fullBoard.hasGraphicsItems());
+    EXPECT_FALSE(fullBoard.getAirWires().isEmpty());
+
+    // creating the graphics items later must lead to the same scene
+    modelOnlyBoard.createGraphicsItems();
+    EXPECT_TRUE(modelOnlyBoard.hasGraphicsItems());
+    EXPECT_EQ(fullBoard.getAirWires().count(), modelOnlyBoard.getAirWires().count());
+    EXPECT_EQ(fullBoard.getGraphicsScene().items().count(),
+              modelOnlyBoard.getGraphicsScene().items().count());
+    Point pos(Length(254000) * 500, 0);
+    EXPECT_EQ(fullBoard.getItemsAtScenePos(pos).count(),
+              modelOnlyBoard.getItemsAtScenePos(pos).count());
+    EXPECT_FALSE(modelOnlyBoard.getItemsAtScenePos(pos).isEmpty());
+
+    std::cout << "Needed " << modelOnlyTime.count() << "s and " << modelOnlyRss
+              << "kB to load a board with " << netLineCount << " netlines in model-only "
+              << "mode, and " << fullTime.count() << "s and " << fullRss << "kB with "
+              << "graphics items\n";
+}
+
+TEST_F(BoardTest, testInteractiveMove)
+{
+    const int netLineCount = 2000;
+    const int steps = 20;
+    const Point step(Length(254000), Length(0));
+    createProjectWithLargeBoard(netLineCount);
+    QScopedPointer<Project> project(new Project(mProjectFile, true));
+    ASSERT_EQ(1, project->getBoards().count());
+    Board& board = *project->getBoards().first();
+    QHash<BI_NetPoint*, Point> startPositions;
+    foreach (BI_NetLine* netline, board.getNetLines()) {
+        startPositions.insert(&netline->getStartPoint(), netline->getStartPoint().getPosition());
+        startPositions.insert(&netline->getEndPoint(), netline->getEndPoint().getPosition());
+    }
+
+    typedef std::chrono::high_resolution_clock Clock;
+    auto start = Clock::now();
+    for (int i = 1; i <= steps; ++i) {
+        foreach (BI_NetPoint* netpoint, startPositions.keys()) {
+            netpoint->setPosition(startPositions.value(netpoint) + step * i);
+        }
+    }
+    std::chrono::duration<double> immediateTime = Clock::now() - start;
+
+    // during an interactive move, the graphics items of the netlines are not updated
+    BI_NetLine& netline = *board.getNetLines().first();
+    QRectF grabArea = netline.getGrabAreaScenePx().boundingRect();
+    start = Clock::now();
+    board.beginInteractiveMove();
+    EXPECT_TRUE(board.isInteractiveMoveActive());
+    for (int i = 1; i <= steps; ++i) {
+        foreach (BI_NetPoint* netpoint, startPositions.keys()) {
+            netpoint->setPosition(startPositions.value(netpoint) - step * i);
+        }
+    }
+    std::chrono::duration<double> interactiveTime = Clock::now() - start;
+    EXPECT_EQ(grabArea, netline.getGrabAreaScenePx().boundingRect());
+
+    // ending the interactive move applies all deferred updates
+    start = Clock::now();
+    board.endInteractiveMove();
+    std::chrono::duration<double> endTime = Clock::now() - start;
+    EXPECT_FALSE(board.isInteractiveMoveActive());
+    foreach (const BI_NetLine* line, board.getNetLines()) {
+        QPointF center = line->getGrabAreaScenePx().boundingRect().center();
+        EXPECT_NEAR(line->getPosition().toPxQPointF().x(), center.x(), 0.001);
+        EXPECT_NEAR(line->getPosition().toPxQPointF().y(), center.y(), 0.001);
+    }
+    Point pos = startPositions.value(&netline.getStartPoint()) - step * steps;
+    EXPECT_TRUE(board.getItemsAtScenePos(pos).contains(&netline));
+
+    std::cout << "Needed " << immediateTime.count() << "s to move " << netLineCount
+              << " netlines " << steps << " times, and " << interactiveTime.count()
+              << "s + " << endTime.count() << "s in interactive move mode\n";
+}
+
+TEST_F(BoardTest, testAirWires)
+{
+    QScopedPointer<Project> project(Project::create(mProjectFile));
+    Circuit& circuit = project->getCircuit();
+    NetClass* netclass = new NetClass(circuit, "default");
+    circuit.addNetClass(*netclass);
+    NetSignal* gnd = new NetSignal(circuit, *netclass, "GND", false);
+    circuit.addNetSignal(*gnd);
+    NetSignal* vcc = new NetSignal(circuit, *netclass, "VCC", false);
+    circuit.addNetSignal(*vcc);
+    Board* board = project->createBoard("board");
+    project->addBoard(*board);
+    BoardLayer* layer = board->getLayerStack().getBoardLayer(BoardLayer::TopCopper);
+    ASSERT_TRUE(layer);
+
+    // four unconnected vias in the corners of a 10x10mm square need three air wires
+    QList<BI_Via*> vias;
+    for (int i = 0; i < 4; ++i) {
+        Point pos(Length(10000000) * (i % 2), Length(10000000) * (i / 2));
+        vias.append(new BI_Via(*board, pos, BI_Via::Shape::Round, Length(700000),
+                               Length(300000), gnd));
+        board->addVia(*vias.last());
+    }
+    BI_Via* vccVia1 = new BI_Via(*board, Point(0, Length(-5000000)), BI_Via::Shape::Round,
+                                 Length(700000), Length(300000), vcc);
+    board->addVia(*vccVia1);
+    BI_Via* vccVia2 = new BI_Via(*board, Point(Length(3000000), Length(-1000000)),
+                                 BI_Via::Shape::Round, Length(700000), Length(300000), vcc);
+    board->addVia(*vccVia2);
+    board->triggerAirWiresRebuild();
+    EXPECT_EQ(3, getAirWires(*board, *gnd).count());
+    EXPECT_NEAR(30.0, getTotalLength(getAirWires(*board, *gnd)), 0.000001);
+    ASSERT_EQ(1, getAirWires(*board, *vcc).count());
+    BI_AirWire* vccAirWire = getAirWires(*board, *vcc).first();
+    EXPECT_NEAR(5.0, vccAirWire->getLength().toMm(), 0.000001);
+
+    // a trace between two vias replaces the air wire between them
+    BI_NetPoint* p1 = new BI_NetPoint(*board, *layer, *gnd, *vias.at(0));
+    board->addNetPoint(*p1);
+    BI_NetPoint* p2 = new BI_NetPoint(*board, *layer, *gnd, *vias.at(3));
+    board->addNetPoint(*p2);
+    board->addNetLine(*new BI_NetLine(*board, *p1, *p2, Length(200000)));
+    board->triggerAirWiresRebuild();
+    EXPECT_EQ(2, getAirWires(*board, *gnd).count());
+    EXPECT_NEAR(20.0, getTotalLength(getAirWires(*board, *gnd)), 0.000001);
+
+    // moving a via only rebuilds the air wires of its own net signal
+    vias.at(1)->setPosition(Point(Length(20000000), 0));
+    board->triggerAirWiresRebuild();
+    EXPECT_EQ(2, getAirWires(*board, *gnd).count());
+    EXPECT_NEAR(10.0 + std::sqrt(200.0), getTotalLength(getAirWires(*board, *gnd)),
+                0.000001); // via2->via0 and via1->via3
+    ASSERT_EQ(1, getAirWires(*board, *vcc).count());
+    EXPECT_EQ(vccAirWire, getAirWires(*board, *vcc).first());
+
+    // during an interactive move, air wires are updated with the next frame
+    board->beginInteractiveMove();
+    vccVia2->setPosition(Point(0, Length(-6000000)));
+    EXPECT_EQ(vccAirWire, getAirWires(*board, *vcc).first());
+    board->endInteractiveMove();
+    ASSERT_EQ(1, getAirWires(*board, *vcc).count());
+    EXPECT_NEAR(1.0, getAirWires(*board, *vcc).first()->getLength().toMm(), 0.000001);
+
+    // removing the board from the project removes all air wires
+    project->removeBoard(*board);
+    EXPECT_TRUE(board->getAirWires().isEmpty());
+    project->addBoard(*board);
+    EXPECT_EQ(3, board->getAirWires().count());
+}
+
+TEST_F(BoardTest, testAirWiresOfDenseNet)
+{
+    const int viaCount = 10000;
+    QScopedPointer<Project> project(Project::create(mProjectFile));
+    Circuit& circuit = project->getCircuit();
+    NetClass* netclass = new NetClass(circuit, "default");
+    circuit.addNetClass(*netclass);
+    NetSignal* netsignal = new NetSignal(circuit, *netclass, "GND", false);
+    circuit.addNetSignal(*netsignal);
+    Board* board = project->createBoard("board");
+    project->addBoard(*board);
+    QList<BI_Via*> vias;
+    for (int i = 0; i < viaCount; ++i) {
+        Point pos(Length(1270000) * (i % 100), Length(1270000) * (i / 100));
+        vias.append(new BI_Via(*board, pos, BI_Via::Shape::Round, Length(700000),
+                               Length(300000), netsignal));
+        board->addVia(*vias.last());
+    }
+    board->triggerAirWiresRebuild();
+    EXPECT_EQ(viaCount - 1, board->getAirWires().count());
+
+    // simulate dragging a via over the board, once per frame
+    const int frames = 20;
+    typedef std::chrono::high_resolution_clock Clock;
+    auto start = Clock::now();
+    board->beginInteractiveMove();
+    for (int i = 1; i <= frames; ++i) {
+        vias.first()->setPosition(Point(Length(-635000) * i, Length(317500) * i));
+        board->endInteractiveMove(); // processes the deferred updates like a frame
+        board->beginInteractiveMove();
+    }
+    board->endInteractiveMove();
+    std::chrono::duration<double> frameTime = (Clock::now() - start) / frames;
+    EXPECT_EQ(viaCount - 1, board->getAirWires().count());
+
+    std::cout << "Needed " << frameTime.count() * 1000 << "ms per frame to update the air "
+              << "wires of a net with " << viaCount << " vias\n";
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace project
+} // namespace librepcb
@@ -23,7 +23,14 @@
 #include <QtCore>
 #include <gtest/gtest.h>
 #include <librepcb/common/systeminfo.h>
+#include <librepcb/common/fileio/fileutils.h>
+#include <librepcb/common/fileio/smartfile.h>
 #include <librepcb/project/project.h>
+#include <librepcb/project/circuit/circuit.h>
+#include <librepcb/project/circuit/netclass.h>
+#include <librepcb/project/boards/board.h>
+#include <librepcb/project/boards/cmd/cmdboardviaadd.h>
+#include <librepcb/project/schematics/schematic.h>
 
 /*****************************************************************************************
  *  Namespace
@@ -51,6 +58,39 @@ class ProjectTest : public ::testing::Test
         virtual ~ProjectTest() {
             QDir(mProjectDir.getParentDir().toStr()).removeRecursively();
         }
+
+        /**
+         * @brief Overwrite all files of the project directory with a marker content
+         */
+        void markAllFiles() {
+            QDirIterator it(mProjectDir.toStr(), QDir::Files | QDir::Hidden,
+                            QDirIterator::Subdirectories);
+            while (it.hasNext()) {
+                QFile file(it.next());
+                if (it.fileName() == ".lock") continue;
+                file.open(QIODevice::WriteOnly | QIODevice::Truncate);
+                file.write("untouched");
+            }
+        }
+
+        /**
+         * @brief Get the relative paths of all files which no longer contain the marker
+         */
+        QStringList getModifiedFiles() const {
+            QStringList files;
+            QDirIterator it(mProjectDir.toStr(), QDir::Files | QDir::Hidden,
+                            QDirIterator::Subdirectories);
+            while (it.hasNext()) {
+                QFile file(it.next());
+                if (it.fileName() == ".lock") continue;
+                file.open(QIODevice::ReadOnly);
+                if (file.readAll() != "untouched") {
+                    files.append(QDir(mProjectDir.toStr()).relativeFilePath(file.fileName()));
+                }
+            }
+            files.sort();
+            return files;
+        }
 };
 
 /*****************************************************************************************
@@ -166,6 +206,80 @@ TEST_F(ProjectTest, testSettersGetters)
     EXPECT_NE(lastModified, project->getLastModified()); // not equal!
 }
 
+TEST_F(ProjectTest, testSaveOnlyModifiedFiles)
+{
+    // create new project with some schematics and boards
+    QScopedPointer<Project> project(Project::create(mProjectFile));
+    Circuit& circuit = project->getCircuit();
+    circuit.addNetClass(*new NetClass(circuit, "default"));
+    for (int i = 0; i < 3; ++i) {
+        project->addSchematic(*project->createSchematic(QString("schematic %1").arg(i)));
+        project->addBoard(*project->createBoard(QString("board %1").arg(i)));
+    }
+    project->save(false);
+    project->save(true);
+
+    // without any modification, nothing must be written
+    markAllFiles();
+    project->save(false);
+    project->save(true);
+    EXPECT_EQ(QStringList(), getModifiedFiles());
+
+    // after modifying one board, only this board file must be written
+    Board& board = *project->getBoards().at(1);
+    QString boardFile = QDir(mProjectDir.toStr()).relativeFilePath(board.getFilePath().toStr());
+    CmdBoardViaAdd cmd(board, Point(0, 0), BI_Via::Shape::Round, Length(700000),
+                       Length(300000), nullptr);
+    cmd.execute();
+    project->save(false);
+    EXPECT_EQ(QStringList(boardFile + "~"), getModifiedFiles());
+    project->save(true);
+    EXPECT_EQ(QStringList({boardFile, boardFile + "~"}), getModifiedFiles());
+
+    // undo must mark the board as modified again
+    markAllFiles();
+    cmd.undo();
+    project->save(true);
+    EXPECT_EQ(QStringList(boardFile), getModifiedFiles());
+}
+
+TEST_F(ProjectTest, testBackupSnapshots)
+{
+    // create new project with a board
+    QScopedPointer<Project> project(Project::create(mProjectFile));
+    project->getCircuit().addNetClass(*new NetClass(project->getCircuit(), "default"));
+    project->addBoard(*project->createBoard("board"));
+    project->save(false);
+    project->save(true);
+    EXPECT_TRUE(project->createBackupSnapshots().isEmpty());
+
+    // take a snapshot of the modified board
+    Board& board = *project->getBoards().first();
+    FilePath backupFile(board.getFilePath().toStr() % '~');
+    CmdBoardViaAdd cmd(board, Point(0, 0), BI_Via::Shape::Round, Length(700000),
+                       Length(300000), nullptr);
+    cmd.execute();
+    QList<SmartFileSnapshot> snapshots = project->createBackupSnapshots();
+    ASSERT_EQ(1, snapshots.count());
+    EXPECT_EQ(backupFile, snapshots.first().getFilePath());
+
+    // modify the board again before the snapshot is written
+    cmd.undo();
+    snapshots.first().write();
+    snapshots.first().getFile().backupSnapshotWritten(snapshots.first());
+    EXPECT_TRUE(FileUtils::readFile(backupFile).contains("<via "));
+    EXPECT_TRUE(snapshots.first().getFile().isModified(false));
+
+    // the next snapshot must contain the latest modification
+    snapshots = project->createBackupSnapshots();
+    ASSERT_EQ(1, snapshots.count());
+    snapshots.first().write();
+    snapshots.first().getFile().backupSnapshotWritten(snapshots.first());
+    EXPECT_FALSE(FileUtils::readFile(backupFile).contains("<via "));
+    EXPECT_FALSE(snapshots.first().getFile().isModified(false));
+    EXPECT_TRUE(project->createBackupSnapshots().isEmpty());
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
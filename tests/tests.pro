@@ -46,9 +46,16 @@ PRE_TARGETDEPS += \
     $${DESTDIR}/libquazip.a
 
 SOURCES += main.cpp \
+    common/excellongeneratortest.cpp \
     common/filepathtest.cpp \
+    common/gerbergeneratortest.cpp \
+    common/lengthtest.cpp \
     common/pointtest.cpp \
     common/scopeguardtest.cpp \
+    common/spatialindextest.cpp \
+    common/airwiresbuildertest.cpp \
+    common/undostacktest.cpp \
+    common/xmldomdocumenttest.cpp \
     common/applicationtest.cpp \
     common/versiontest.cpp \
     common/systeminfotest.cpp \
@@ -56,6 +63,7 @@ SOURCES += main.cpp \
     common/uuidtest.cpp \
     common/filedownloadtest.cpp \
     common/networkrequesttest.cpp \
+    project/boardtest.cpp \
     project/projecttest.cpp
 
 HEADERS += \